@@ -106,6 +106,21 @@ bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint1
     return touched;
 }
 
+bool esp_lcd_touch_get_points(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *track_id, uint8_t *point_num, uint8_t max_point_num)
+{
+    assert(tp != NULL);
+    assert(track_id != NULL);
+
+    /* Track IDs first, getting the coordinates consumes the points */
+    portENTER_CRITICAL(&tp->data.lock);
+    for (int i = 0; i < max_point_num && i < CONFIG_ESP_LCD_TOUCH_MAX_POINTS; i++) {
+        track_id[i] = tp->data.coords[i].track_id;
+    }
+    portEXIT_CRITICAL(&tp->data.lock);
+
+    return esp_lcd_touch_get_coordinates(tp, x, y, strength, point_num, max_point_num);
+}
+
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 esp_err_t esp_lcd_touch_get_button_state(esp_lcd_touch_handle_t tp, uint8_t n, uint8_t *state)
 {
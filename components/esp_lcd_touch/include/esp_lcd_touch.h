@@ -73,6 +73,7 @@ typedef struct {
         uint16_t x; /*!< X coordinate */
         uint16_t y; /*!< Y coordinate */
         uint16_t strength; /*!< Strength */
+        uint8_t track_id; /*!< ID the controller keeps for a finger while it stays down */
     } coords[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
 
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
@@ -284,6 +285,25 @@ esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp);
  */
 bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 
+/**
+ * @brief Read coordinates and track IDs from touch controller
+ *
+ * Same as esp_lcd_touch_get_coordinates, with the track ID of each point. Controllers without
+ * track IDs report the point index.
+ *
+ * @param tp: Touch handler
+ * @param x: Array of X coordinates
+ * @param y: Array of Y coordinates
+ * @param strength: Array of the strengths (can be NULL)
+ * @param track_id: Array of the track IDs
+ * @param point_num: Count of points touched (equals with count of items in x and y array)
+ * @param max_point_num: Maximum count of touched points to return (equals with max size of x and y array)
+ *
+ * @return
+ *      - Returns true, when touched and coordinates readed. Otherwise returns false.
+ */
+bool esp_lcd_touch_get_points(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *track_id, uint8_t *point_num, uint8_t max_point_num);
+
 
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 /**
@@ -8,14 +8,17 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_system.h"
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
-#include "driver/i2c.h"
+#include "driver/i2c_master.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_touch.h"
+#include "esp_lcd_touch_gt911.h"
 
 static const char *TAG = "GT911";
 
@@ -25,14 +28,57 @@ static const char *TAG = "GT911";
 #define ESP_LCD_TOUCH_GT911_CONFIG_REG      (0x8047)
 #define ESP_LCD_TOUCH_GT911_MAX_X           (0x8048)
 #define ESP_LCD_TOUCH_GT911_MAX_Y           (0x804A)
+#define ESP_LCD_TOUCH_GT911_SHAKE_COUNT     (0x804F)
+#define ESP_LCD_TOUCH_GT911_FILTER          (0x8050)
+#define ESP_LCD_TOUCH_GT911_NOISE_REDUCTION (0x8052)
+#define ESP_LCD_TOUCH_GT911_TOUCH_LEVEL     (0x8053)
+#define ESP_LCD_TOUCH_GT911_LEAVE_LEVEL     (0x8054)
+#define ESP_LCD_TOUCH_GT911_REFRESH_RATE    (0x8056)
 #define ESP_LCD_TOUCH_GT911_PRODUCT_ID_REG  (0x8140)
 #define ESP_LCD_TOUCH_GT911_ENTER_SLEEP     (0x8040)
 #define ESP_LCD_TOUCH_GT911_CHKSUM          (0x80FF)
 #define ESP_LCD_TOUCH_GT911_FRESH           (0x8100)
 
+/* Config block from 0x8047 up to and including the FRESH flag, and offsets into it */
+#define ESP_GT911_CONFIG_LEN                (ESP_LCD_TOUCH_GT911_FRESH - ESP_LCD_TOUCH_GT911_CONFIG_REG + 1)
+#define ESP_GT911_CFG(reg)                  ((reg) - ESP_LCD_TOUCH_GT911_CONFIG_REG)
+
 /* GT911 support key num */
 #define ESP_GT911_TOUCH_MAX_BUTTONS         (4)
 
+/* GT911 support point num */
+#define ESP_GT911_TOUCH_MAX_POINTS          (5)
+
+/* Status byte and the payload of every point the driver keeps, read in one burst */
+#define ESP_GT911_READ_POINTS               ((ESP_GT911_TOUCH_MAX_POINTS < CONFIG_ESP_LCD_TOUCH_MAX_POINTS) ? \
+                                             (ESP_GT911_TOUCH_MAX_POINTS) : (CONFIG_ESP_LCD_TOUCH_MAX_POINTS))
+#define ESP_GT911_READ_LEN                  (1 + ESP_GT911_READ_POINTS * 8)
+
+/* Timeout of one I2C transaction, also bounds the wait for a queued one */
+#define ESP_GT911_I2C_TIMEOUT_MS            (50)
+
+/* Driver instance, the touch handle points at its first member */
+typedef struct {
+    esp_lcd_touch_t base;
+    i2c_master_dev_handle_t dev;    /* I2C master device, NULL when the panel IO is used */
+    bool async;                     /* Transfers are queued and complete in the callback */
+    SemaphoreHandle_t done;         /* Given on every completed queued transfer */
+    StaticSemaphore_t done_buf;     /* Storage of done, part of the instance */
+    uint32_t submitted;             /* Queued transfers, written by the caller only */
+    uint32_t completed;             /* Completed queued transfers, written by the callback only */
+    uint32_t failed;                /* Bit (n % 32) set when queued transfer n failed, by the callback */
+    uint32_t checked;               /* Last queued transfer whose status was looked at */
+    /* A queued transfer reads and writes these until it completes, possibly after the call timed out */
+    uint8_t tx_buf[2 + ESP_GT911_CONFIG_LEN];
+    uint8_t rx_buf[ESP_GT911_CONFIG_LEN];
+} esp_lcd_touch_gt911_t;
+
+/* Status clear; queued without waiting, so it must outlive the call */
+static const uint8_t gt911_clear_cmd[] = {ESP_LCD_TOUCH_GT911_READ_XY_REG >> 8, ESP_LCD_TOUCH_GT911_READ_XY_REG & 0xff, 0};
+
+/* Timing counters, shared by all GT911 instances */
+static esp_lcd_touch_gt911_stats_t gt911_stats;
+
 uint8_t calcChecksum(uint8_t* buf, uint8_t len) {
   uint8_t ccsum = 0;
   for (uint8_t i = 0; i < len; i++) {
@@ -55,13 +101,19 @@ static esp_err_t esp_lcd_touch_gt911_del(esp_lcd_touch_handle_t tp);
 /* I2C read/write */
 static esp_err_t touch_gt911_i2c_read(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t *data, uint8_t len);
 static esp_err_t touch_gt911_i2c_write(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t data);
+static esp_err_t touch_gt911_i2c_write_buf(esp_lcd_touch_handle_t tp, uint16_t reg, const uint8_t *data, uint8_t len);
+static esp_err_t touch_gt911_i2c_idle(esp_lcd_touch_gt911_t *gt911);
+static esp_err_t touch_gt911_i2c_wait(esp_lcd_touch_gt911_t *gt911);
+
+/* Shared part of the constructors */
+static esp_err_t touch_gt911_init(esp_lcd_touch_handle_t tp);
 
 /* GT911 reset */
 static esp_err_t touch_gt911_reset(esp_lcd_touch_handle_t tp);
 /* Read status and config register */
 static esp_err_t touch_gt911_read_cfg(esp_lcd_touch_handle_t tp);
 /* Write config register */
-static esp_err_t touch_gt911_write_resolution(esp_lcd_touch_handle_t tp, uint16_t x_max, uint16_t y_max);
+static esp_err_t touch_gt911_write_config(esp_lcd_touch_handle_t tp, uint16_t x_max, uint16_t y_max, const esp_lcd_touch_gt911_tuning_t *tuning);
 
 /* GT911 enter/exit sleep mode */
 static esp_err_t esp_lcd_touch_gt911_enter_sleep(esp_lcd_touch_handle_t tp);
@@ -80,11 +132,106 @@ esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const
     assert(out_touch != NULL);
 
     /* Prepare main structure */
-    esp_lcd_touch_handle_t esp_lcd_touch_gt911 = heap_caps_calloc(1, sizeof(esp_lcd_touch_t), MALLOC_CAP_DEFAULT);
-    ESP_GOTO_ON_FALSE(esp_lcd_touch_gt911, ESP_ERR_NO_MEM, err, TAG, "no mem for GT911 controller");
+    esp_lcd_touch_gt911_t *gt911 = heap_caps_calloc(1, sizeof(esp_lcd_touch_gt911_t), MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(gt911, ESP_ERR_NO_MEM, err, TAG, "no mem for GT911 controller");
 
     /* Communication interface */
-    esp_lcd_touch_gt911->io = io;
+    gt911->base.io = io;
+
+    /* Save config */
+    memcpy(&gt911->base.config, config, sizeof(esp_lcd_touch_config_t));
+
+    ret = touch_gt911_init(&gt911->base);
+
+err:
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Error (0x%x)! Touch controller GT911 initialization failed!", ret);
+        if (gt911) {
+            esp_lcd_touch_gt911_del(&gt911->base);
+            gt911 = NULL;
+        }
+    }
+
+    *out_touch = gt911 ? &gt911->base : NULL;
+
+    return ret;
+}
+
+/* Runs in the I2C ISR */
+static bool touch_gt911_i2c_done(i2c_master_dev_handle_t dev, const i2c_master_event_data_t *evt_data, void *arg)
+{
+    esp_lcd_touch_gt911_t *gt911 = arg;
+    BaseType_t high_task_awoken = pdFALSE;
+
+    /* Transfers on a device complete in the order they were queued */
+    uint32_t n = gt911->completed + 1;
+    uint32_t bit = 1UL << (n % 32);
+    if (evt_data->event != I2C_EVENT_DONE) {
+        gt911->failed |= bit;
+    } else {
+        gt911->failed &= ~bit;
+    }
+    __atomic_store_n(&gt911->completed, n, __ATOMIC_RELEASE);
+    xSemaphoreGiveFromISR(gt911->done, &high_task_awoken);
+
+    return high_task_awoken == pdTRUE;
+}
+
+esp_err_t esp_lcd_touch_new_i2c_master_gt911(i2c_master_bus_handle_t bus, const esp_lcd_touch_gt911_i2c_config_t *i2c_config, const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch)
+{
+    esp_err_t ret = ESP_OK;
+
+    assert(bus != NULL);
+    assert(i2c_config != NULL);
+    assert(config != NULL);
+    assert(out_touch != NULL);
+
+    /* Prepare main structure */
+    esp_lcd_touch_gt911_t *gt911 = heap_caps_calloc(1, sizeof(esp_lcd_touch_gt911_t), MALLOC_CAP_DEFAULT);
+    ESP_GOTO_ON_FALSE(gt911, ESP_ERR_NO_MEM, err, TAG, "no mem for GT911 controller");
+
+    /* Communication interface */
+    const i2c_device_config_t dev_config = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = i2c_config->dev_addr,
+        .scl_speed_hz = i2c_config->scl_speed_hz,
+    };
+    ret = i2c_master_bus_add_device(bus, &dev_config, &gt911->dev);
+    ESP_GOTO_ON_ERROR(ret, err, TAG, "I2C add device failed");
+
+    if (i2c_config->async) {
+        gt911->async = true;
+        gt911->done = xSemaphoreCreateBinaryStatic(&gt911->done_buf);
+
+        const i2c_master_event_callbacks_t cbs = {
+            .on_trans_done = touch_gt911_i2c_done,
+        };
+        ret = i2c_master_register_event_callbacks(gt911->dev, &cbs, gt911);
+        ESP_GOTO_ON_ERROR(ret, err, TAG, "I2C callback register failed");
+    }
+
+    /* Save config */
+    memcpy(&gt911->base.config, config, sizeof(esp_lcd_touch_config_t));
+
+    ret = touch_gt911_init(&gt911->base);
+
+err:
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Error (0x%x)! Touch controller GT911 initialization failed!", ret);
+        if (gt911) {
+            esp_lcd_touch_gt911_del(&gt911->base);
+            gt911 = NULL;
+        }
+    }
+
+    *out_touch = gt911 ? &gt911->base : NULL;
+
+    return ret;
+}
+
+static esp_err_t touch_gt911_init(esp_lcd_touch_handle_t esp_lcd_touch_gt911)
+{
+    esp_err_t ret = ESP_OK;
 
     /* Only supported callbacks are set */
     esp_lcd_touch_gt911->read_data = esp_lcd_touch_gt911_read_data;
@@ -99,9 +246,6 @@ esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const
     /* Mutex */
     esp_lcd_touch_gt911->data.lock.owner = portMUX_FREE_VAL;
 
-    /* Save config */
-    memcpy(&esp_lcd_touch_gt911->config, config, sizeof(esp_lcd_touch_config_t));
-
     /* Prepare pin for touch interrupt */
     if (esp_lcd_touch_gt911->config.int_gpio_num != GPIO_NUM_NC) {
         const gpio_config_t int_gpio_config = {
@@ -110,7 +254,7 @@ esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const
             .pin_bit_mask = BIT64(esp_lcd_touch_gt911->config.int_gpio_num)
         };
         ret = gpio_config(&int_gpio_config);
-        ESP_GOTO_ON_ERROR(ret, err, TAG, "GPIO config failed");
+        ESP_RETURN_ON_ERROR(ret, TAG, "GPIO config failed");
 
         /* Register interrupt callback */
         if (esp_lcd_touch_gt911->config.interrupt_callback) {
@@ -125,34 +269,24 @@ esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const
             .pin_bit_mask = BIT64(esp_lcd_touch_gt911->config.rst_gpio_num)
         };
         ret = gpio_config(&rst_gpio_config);
-        ESP_GOTO_ON_ERROR(ret, err, TAG, "GPIO config failed");
+        ESP_RETURN_ON_ERROR(ret, TAG, "GPIO config failed");
     }
 
     /* Reset controller */
     ret = touch_gt911_reset(esp_lcd_touch_gt911);
-    ESP_GOTO_ON_ERROR(ret, err, TAG, "GT911 reset failed");
+    ESP_RETURN_ON_ERROR(ret, TAG, "GT911 reset failed");
 
     /* Read status and config info */
     ret = touch_gt911_read_cfg(esp_lcd_touch_gt911);
-    ESP_GOTO_ON_ERROR(ret, err, TAG, "GT911 init failed");
+    ESP_RETURN_ON_ERROR(ret, TAG, "GT911 init failed");
 
     /* Uncomment if touch max coordinates do not fit display coordinates */
     // vTaskDelay(pdMS_TO_TICKS(50));
 
-    ret = touch_gt911_write_resolution(esp_lcd_touch_gt911, config->x_max, config->y_max);
-    ESP_GOTO_ON_ERROR(ret, err, TAG, "GT911 write resolution failed");
-
-err:
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Error (0x%x)! Touch controller GT911 initialization failed!", ret);
-        if (esp_lcd_touch_gt911) {
-            esp_lcd_touch_gt911_del(esp_lcd_touch_gt911);
-        }
-    }
-
-    *out_touch = esp_lcd_touch_gt911;
+    ret = touch_gt911_write_config(esp_lcd_touch_gt911, esp_lcd_touch_gt911->config.x_max, esp_lcd_touch_gt911->config.y_max, NULL);
+    ESP_RETURN_ON_ERROR(ret, TAG, "GT911 write resolution failed");
 
-    return ret;
+    return ESP_OK;
 }
 
 static esp_err_t esp_lcd_touch_gt911_enter_sleep(esp_lcd_touch_handle_t tp)
@@ -190,24 +324,69 @@ static esp_err_t esp_lcd_touch_gt911_exit_sleep(esp_lcd_touch_handle_t tp)
     return ESP_OK;
 }
 
+static void touch_gt911_account(uint32_t *count, uint64_t *total_us, uint32_t *max_us, int64_t start)
+{
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+
+    (*count)++;
+    *total_us += elapsed;
+    if (elapsed > *max_us) {
+        *max_us = elapsed;
+    }
+}
+
+/* Acknowledge the report so the controller can latch the next one */
+static esp_err_t touch_gt911_clear_status(esp_lcd_touch_handle_t tp)
+{
+    esp_lcd_touch_gt911_t *gt911 = (esp_lcd_touch_gt911_t *)tp;
+    int64_t start = esp_timer_get_time();
+    esp_err_t err;
+
+    if (gt911->async) {
+        /* Nothing depends on its completion; the next read is queued behind it and reports its failure */
+        err = i2c_master_transmit(gt911->dev, gt911_clear_cmd, sizeof(gt911_clear_cmd), -1);
+        if (err == ESP_OK) {
+            gt911->submitted++;
+            gt911_stats.queued++;
+        }
+    } else {
+        err = touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, 0);
+    }
+
+    touch_gt911_account(&gt911_stats.clears, &gt911_stats.clear_us, &gt911_stats.clear_max_us, start);
+    if (err != ESP_OK) {
+        gt911_stats.errors++;
+    }
+    return err;
+}
+
 static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
 {
     esp_err_t err;
-    uint8_t buf[41];
+    uint8_t buf[ESP_GT911_READ_LEN];
     uint8_t touch_cnt = 0;
-    uint8_t clear = 0;
     size_t i = 0;
 
     assert(tp != NULL);
 
-    err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, buf, 1);
+    int64_t poll_start = esp_timer_get_time();
+
+    /* Status and all points in a single transaction */
+    err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, buf, sizeof(buf));
+    touch_gt911_account(&gt911_stats.reads, &gt911_stats.read_us, &gt911_stats.read_max_us, poll_start);
+    if (err != ESP_OK) {
+        gt911_stats.errors++;
+    }
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    /* Any touch data? */
+    /* Any touch data? Nothing to acknowledge until the controller has a new report */
     if ((buf[0] & 0x80) == 0x00) {
-        touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
+        touch_gt911_account(&gt911_stats.polls, &gt911_stats.poll_us, &gt911_stats.poll_max_us, poll_start);
+        return ESP_OK;
+    }
+
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
-    } else if ((buf[0] & 0x10) == 0x10) {
+    if ((buf[0] & 0x10) == 0x10) {
         /* Read all keys */
         uint8_t key_max = ((ESP_GT911_TOUCH_MAX_BUTTONS < CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS) ? \
                            (ESP_GT911_TOUCH_MAX_BUTTONS) : (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS));
@@ -215,7 +394,7 @@ static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
         ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
         /* Clear all */
-        touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
+        err = touch_gt911_clear_status(tp);
         ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
 
         portENTER_CRITICAL(&tp->data.lock);
@@ -227,34 +406,29 @@ static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
         }
 
         portEXIT_CRITICAL(&tp->data.lock);
-#endif
-    } else if ((buf[0] & 0x80) == 0x80) {
-#if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
-        portENTER_CRITICAL(&tp->data.lock);
-        for (i = 0; i < CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS; i++) {
-            tp->data.button[i].status = 0;
-        }
-        portEXIT_CRITICAL(&tp->data.lock);
-#endif
-        /* Count of touched points */
-        touch_cnt = buf[0] & 0x0f;
-        if (touch_cnt > 5 || touch_cnt == 0) {
-            touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
-            return ESP_OK;
-        }
 
-        /* Read all points */
-        err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG + 1, &buf[1], touch_cnt * 8);
-        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+        touch_gt911_account(&gt911_stats.polls, &gt911_stats.poll_us, &gt911_stats.poll_max_us, poll_start);
+        return ESP_OK;
+    }
 
-        /* Clear all */
-        err = touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
-        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+    portENTER_CRITICAL(&tp->data.lock);
+    for (i = 0; i < CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS; i++) {
+        tp->data.button[i].status = 0;
+    }
+    portEXIT_CRITICAL(&tp->data.lock);
+#endif
+
+    /* Clear all */
+    err = touch_gt911_clear_status(tp);
+    ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
 
+    /* Count of touched points */
+    touch_cnt = buf[0] & 0x0f;
+    if (touch_cnt > 0 && touch_cnt <= ESP_GT911_TOUCH_MAX_POINTS) {
         portENTER_CRITICAL(&tp->data.lock);
 
         /* Number of touched points */
-        touch_cnt = (touch_cnt > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : touch_cnt);
+        touch_cnt = (touch_cnt > ESP_GT911_READ_POINTS ? ESP_GT911_READ_POINTS : touch_cnt);
         tp->data.points = touch_cnt;
 
         /* Fill all coordinates */
@@ -262,16 +436,33 @@ static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
             tp->data.coords[i].x = ((uint16_t)buf[(i * 8) + 3] << 8) + buf[(i * 8) + 2];
             tp->data.coords[i].y = (((uint16_t)buf[(i * 8) + 5] << 8) + buf[(i * 8) + 4]);
             tp->data.coords[i].strength = (((uint16_t)buf[(i * 8) + 7] << 8) + buf[(i * 8) + 6]);
+            tp->data.coords[i].track_id = buf[(i * 8) + 1];
         }
 
-        
-
         portEXIT_CRITICAL(&tp->data.lock);
     }
 
+    touch_gt911_account(&gt911_stats.polls, &gt911_stats.poll_us, &gt911_stats.poll_max_us, poll_start);
     return ESP_OK;
 }
 
+size_t esp_lcd_touch_gt911_get_instance_size(void)
+{
+    return sizeof(esp_lcd_touch_gt911_t);
+}
+
+void esp_lcd_touch_gt911_get_stats(esp_lcd_touch_gt911_stats_t *stats)
+{
+    assert(stats != NULL);
+
+    *stats = gt911_stats;
+}
+
+void esp_lcd_touch_gt911_reset_stats(void)
+{
+    memset(&gt911_stats, 0, sizeof(gt911_stats));
+}
+
 static bool esp_lcd_touch_gt911_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
 {
     assert(tp != NULL);
@@ -327,8 +518,23 @@ static esp_err_t esp_lcd_touch_gt911_get_button_state(esp_lcd_touch_handle_t tp,
 
 static esp_err_t esp_lcd_touch_gt911_del(esp_lcd_touch_handle_t tp)
 {
+    esp_lcd_touch_gt911_t *gt911 = (esp_lcd_touch_gt911_t *)tp;
+
     assert(tp != NULL);
 
+    /* Release the I2C device, after any queued transfer */
+    if (gt911->dev) {
+        if (gt911->async && touch_gt911_i2c_idle(gt911) != ESP_OK) {
+            /* The bus still holds pointers into the instance, so it is never freed */
+            ESP_LOGE(TAG, "Queued transfer stuck, GT911 instance leaked");
+            return ESP_ERR_TIMEOUT;
+        }
+        i2c_master_bus_rm_device(gt911->dev);
+    }
+    if (gt911->done) {
+        vSemaphoreDelete(gt911->done);
+    }
+
     /* Reset GPIO pin settings */
     if (tp->config.int_gpio_num != GPIO_NUM_NC) {
         gpio_reset_pin(tp->config.int_gpio_num);
@@ -392,56 +598,170 @@ static esp_err_t touch_gt911_read_cfg(esp_lcd_touch_handle_t tp)
     return ESP_OK;
 }
 
-static esp_err_t touch_gt911_write_resolution(esp_lcd_touch_handle_t tp, uint16_t x_max, uint16_t y_max)
+static esp_err_t touch_gt911_write_config(esp_lcd_touch_handle_t tp, uint16_t x_max, uint16_t y_max, const esp_lcd_touch_gt911_tuning_t *tuning)
 {
     esp_err_t err;
 
-    uint8_t len = 0x8100 - ESP_LCD_TOUCH_GT911_CONFIG_REG + 1;
-    uint8_t config[len];
+    /* Config block, checksum and FRESH flag */
+    uint8_t config[ESP_GT911_CONFIG_LEN];
 
-    ESP_LOGI(TAG, "Write resolution");
+    ESP_LOGI(TAG, "Write config");
 
-    ESP_RETURN_ON_ERROR(touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_CONFIG_REG, (uint8_t *)&config[0], len), TAG, "GT911 read error!");
+    ESP_RETURN_ON_ERROR(touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_CONFIG_REG, (uint8_t *)&config[0], ESP_GT911_CONFIG_LEN - 2), TAG, "GT911 read error!");
 
-    config[1] = (x_max & 0xff);
-    config[2] = (x_max >> 8);
-    config[3] = (y_max & 0xff);
-    config[4] = (y_max >> 8);
+    config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_MAX_X)] = (x_max & 0xff);
+    config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_MAX_X) + 1] = (x_max >> 8);
+    config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_MAX_Y)] = (y_max & 0xff);
+    config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_MAX_Y) + 1] = (y_max >> 8);
 
-    uint8_t checksum = calcChecksum(config, len - 2);
-    ESP_LOGI(TAG, "Checksum:%u", checksum);
+    if (tuning) {
+        uint8_t period = tuning->report_period_ms;
+        period = (period < 5 ? 5 : (period > 20 ? 20 : period));
 
-    config[len - 2] = calcChecksum(config, len - 2);
-    config[len - 1] = 1;
+        /* Only the low bits are tuning values, keep the rest of each register */
+        uint8_t *reg = &config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_SHAKE_COUNT)];
+        *reg = (*reg & 0xf0) | (tuning->shake_count & 0x0f);
+        reg = &config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_FILTER)];
+        *reg = (*reg & 0xc0) | (tuning->coord_filter & 0x3f);
+        reg = &config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_NOISE_REDUCTION)];
+        *reg = (*reg & 0xf0) | (tuning->noise_reduction & 0x0f);
+        reg = &config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_REFRESH_RATE)];
+        *reg = (*reg & 0xf0) | (period - 5);
 
-    err = esp_lcd_panel_io_tx_param(tp->io, ESP_LCD_TOUCH_GT911_MAX_X, (uint8_t *)&config[1], 2);
-    ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
-    err = esp_lcd_panel_io_tx_param(tp->io, ESP_LCD_TOUCH_GT911_MAX_Y, (uint8_t *)&config[3], 2);
-    ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
+        config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_TOUCH_LEVEL)] = tuning->touch_level;
+        config[ESP_GT911_CFG(ESP_LCD_TOUCH_GT911_LEAVE_LEVEL)] = tuning->leave_level;
+    }
 
-    err = esp_lcd_panel_io_tx_param(tp->io, ESP_LCD_TOUCH_GT911_CHKSUM, (uint8_t *)&config[len - 2], 1);
-    ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
-    err = esp_lcd_panel_io_tx_param(tp->io, ESP_LCD_TOUCH_GT911_FRESH, (uint8_t *)&config[len - 1], 1);
+    config[ESP_GT911_CONFIG_LEN - 2] = calcChecksum(config, ESP_GT911_CONFIG_LEN - 2);
+    config[ESP_GT911_CONFIG_LEN - 1] = 1;
+    ESP_LOGI(TAG, "Checksum:%u", config[ESP_GT911_CONFIG_LEN - 2]);
+
+    /* The controller reloads the whole block once FRESH is set, so it goes out in one transaction */
+    err = touch_gt911_i2c_write_buf(tp, ESP_LCD_TOUCH_GT911_CONFIG_REG, &config[0], ESP_GT911_CONFIG_LEN);
     ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
 
     return ESP_OK;
 }
 
+esp_err_t esp_lcd_touch_gt911_set_tuning(esp_lcd_touch_handle_t tp, const esp_lcd_touch_gt911_tuning_t *tuning)
+{
+    uint8_t refresh_rate;
+
+    assert(tp != NULL);
+    assert(tuning != NULL);
+
+    ESP_RETURN_ON_ERROR(touch_gt911_write_config(tp, tp->config.x_max, tp->config.y_max, tuning), TAG, "GT911 write config failed");
+
+    /* Give the controller time to apply the new config */
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    ESP_RETURN_ON_ERROR(touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_REFRESH_RATE, &refresh_rate, 1), TAG, "GT911 read error!");
+    ESP_LOGI(TAG, "Report period:%dms, touch level:%u, leave level:%u", 5 + (refresh_rate & 0x0f),
+             tuning->touch_level, tuning->leave_level);
+
+    return ESP_OK;
+}
+
+/* Sleep until every queued transfer has completed, gives up after a transaction timeout without progress */
+static esp_err_t touch_gt911_i2c_idle(esp_lcd_touch_gt911_t *gt911)
+{
+    while ((int32_t)(__atomic_load_n(&gt911->completed, __ATOMIC_ACQUIRE) - gt911->submitted) < 0) {
+        if (xSemaphoreTake(gt911->done, pdMS_TO_TICKS(ESP_GT911_I2C_TIMEOUT_MS)) != pdTRUE) {
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+    return ESP_OK;
+}
+
+/* Wait for the last queued transfer and return its own status; earlier failed ones (status clears) count as errors */
+static esp_err_t touch_gt911_i2c_wait(esp_lcd_touch_gt911_t *gt911)
+{
+    int64_t start = esp_timer_get_time();
+
+    /* On timeout the transfer stays queued, on buffers in the instance that outlive the call */
+    ESP_RETURN_ON_ERROR(touch_gt911_i2c_idle(gt911), TAG, "I2C transfer timeout!");
+    gt911_stats.wait_us += esp_timer_get_time() - start;
+
+    uint32_t failed = gt911->failed;
+    while (gt911->checked != gt911->submitted - 1) {
+        gt911->checked++;
+        if (failed & (1UL << (gt911->checked % 32))) {
+            gt911_stats.errors++;
+            ESP_LOGW(TAG, "Earlier queued transfer failed");
+        }
+    }
+    gt911->checked = gt911->submitted;
+
+    return (failed & (1UL << (gt911->submitted % 32))) ? ESP_FAIL : ESP_OK;
+}
+
 static esp_err_t touch_gt911_i2c_read(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t *data, uint8_t len)
 {
+    esp_lcd_touch_gt911_t *gt911 = (esp_lcd_touch_gt911_t *)tp;
+
     assert(tp != NULL);
     assert(data != NULL);
 
-    /* Read data */
-    return esp_lcd_panel_io_rx_param(tp->io, reg, data, len);
+    if (gt911->dev == NULL) {
+        /* Read data */
+        return esp_lcd_panel_io_rx_param(tp->io, reg, data, len);
+    }
+
+    if (!gt911->async) {
+        const uint8_t addr[2] = {reg >> 8, reg & 0xff};
+        return i2c_master_transmit_receive(gt911->dev, addr, sizeof(addr), data, len, ESP_GT911_I2C_TIMEOUT_MS);
+    }
+
+    /* A transfer that timed out earlier may still own the buffers */
+    assert(len <= sizeof(gt911->rx_buf));
+    ESP_RETURN_ON_ERROR(touch_gt911_i2c_idle(gt911), TAG, "I2C bus busy!");
+
+    /* Queue the read and yield until the callback reports it done */
+    gt911->tx_buf[0] = reg >> 8;
+    gt911->tx_buf[1] = reg & 0xff;
+    ESP_RETURN_ON_ERROR(i2c_master_transmit_receive(gt911->dev, gt911->tx_buf, 2, gt911->rx_buf, len, -1), TAG, "I2C queue error!");
+    gt911->submitted++;
+    gt911_stats.queued++;
+
+    ESP_RETURN_ON_ERROR(touch_gt911_i2c_wait(gt911), TAG, "I2C read error!");
+    memcpy(data, gt911->rx_buf, len);
+    return ESP_OK;
 }
 
-static esp_err_t touch_gt911_i2c_write(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t data)
+static esp_err_t touch_gt911_i2c_write_buf(esp_lcd_touch_handle_t tp, uint16_t reg, const uint8_t *data, uint8_t len)
 {
+    esp_lcd_touch_gt911_t *gt911 = (esp_lcd_touch_gt911_t *)tp;
+    uint8_t *buf = gt911->tx_buf;
+
     assert(tp != NULL);
+    assert(len <= ESP_GT911_CONFIG_LEN);
+
+    if (gt911->dev == NULL) {
+        /* Write data */
+        return esp_lcd_panel_io_tx_param(tp->io, reg, data, len);
+    }
+
+    if (gt911->async) {
+        /* A transfer that timed out earlier may still own the buffers */
+        ESP_RETURN_ON_ERROR(touch_gt911_i2c_idle(gt911), TAG, "I2C bus busy!");
+    }
+
+    /* Register address and data go out in one transaction */
+    buf[0] = reg >> 8;
+    buf[1] = reg & 0xff;
+    memcpy(&buf[2], data, len);
+    if (!gt911->async) {
+        return i2c_master_transmit(gt911->dev, buf, 2 + len, ESP_GT911_I2C_TIMEOUT_MS);
+    }
 
-    // *INDENT-OFF*
-    /* Write data */
-    return esp_lcd_panel_io_tx_param(tp->io, reg, (uint8_t[]){data}, 1);
-    // *INDENT-ON*
+    ESP_RETURN_ON_ERROR(i2c_master_transmit(gt911->dev, buf, 2 + len, -1), TAG, "I2C queue error!");
+    gt911->submitted++;
+    gt911_stats.queued++;
+
+    return touch_gt911_i2c_wait(gt911);
+}
+
+static esp_err_t touch_gt911_i2c_write(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t data)
+{
+    return touch_gt911_i2c_write_buf(tp, reg, &data, 1);
 }
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "driver/i2c_master.h"
 #include "esp_lcd_touch.h"
 
 #ifdef __cplusplus
@@ -31,6 +32,110 @@ extern "C" {
  */
 esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch);
 
+/**
+ * @brief GT911 device on an I2C master bus
+ */
+typedef struct {
+    uint16_t dev_addr;          /*!< I2C address, ESP_LCD_TOUCH_IO_I2C_GT911_ADDRESS or its backup */
+    uint32_t scl_speed_hz;      /*!< SCL frequency */
+    bool async;                 /*!< The bus was created with trans_queue_depth > 0 */
+} esp_lcd_touch_gt911_i2c_config_t;
+
+/**
+ * @brief Create a new GT911 touch driver on an I2C master bus
+ *
+ * The driver talks to the controller through its own I2C master device instead of a panel IO.
+ * On an asynchronous bus every transfer is queued: reads put the calling task to sleep until the
+ * completion callback fires, and the status clear after a report is queued without waiting.
+ *
+ * @note The bus should be created before use this function.
+ *
+ * @param bus: I2C master bus handle
+ * @param i2c_config: I2C device configuration
+ * @param config: Touch configuration
+ * @param out_touch: Touch instance handle
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_NO_MEM            if there is no memory for allocating main structure
+ *      - otherwise the I2C error
+ */
+esp_err_t esp_lcd_touch_new_i2c_master_gt911(i2c_master_bus_handle_t bus, const esp_lcd_touch_gt911_i2c_config_t *i2c_config, const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch);
+
+/**
+ * @brief Size of a GT911 driver instance
+ *
+ * The instance is one block allocated by the constructor and kept until it is deleted; it holds
+ * the completion semaphore and the transfer buffers of an asynchronous bus. The touch handle is
+ * its address, so the application can account for it in its memory map.
+ *
+ * @return Bytes allocated per instance
+ */
+size_t esp_lcd_touch_gt911_get_instance_size(void);
+
+/**
+ * @brief Runtime tuning of the GT911 configuration block
+ *
+ * Written over the factory configuration, which keeps every other field.
+ */
+typedef struct {
+    uint8_t report_period_ms;   /*!< Report period, 5 to 20 ms (10 ms is 100 Hz) */
+    uint8_t touch_level;        /*!< Threshold for a touch to start */
+    uint8_t leave_level;        /*!< Threshold for a touch to end, below touch_level */
+    uint8_t noise_reduction;    /*!< Noise filter, 0 to 15 */
+    uint8_t coord_filter;       /*!< Coordinate smoothing window, 0 to 63 */
+    uint8_t shake_count;        /*!< Reports a finger must be seen before it is reported, 0 to 15 */
+} esp_lcd_touch_gt911_tuning_t;
+
+/**
+ * @brief Rewrite the GT911 configuration with new tuning values
+ *
+ * Reads the config block at 0x8047, applies the tuning and the resolution from the touch
+ * configuration, recomputes the checksum and commits it with the FRESH flag.
+ *
+ * @param tp: Touch instance handle
+ * @param tuning: Tuning values
+ * @return
+ *      - ESP_OK                    on success
+ *      - otherwise the I2C error
+ */
+esp_err_t esp_lcd_touch_gt911_set_tuning(esp_lcd_touch_handle_t tp, const esp_lcd_touch_gt911_tuning_t *tuning);
+
+/**
+ * @brief Timing counters of the GT911 read path
+ *
+ * A poll is one esp_lcd_touch_read_data() call: a burst read of the status and all points,
+ * followed by a status clear only when the controller had a new report. On an asynchronous bus
+ * the clear is only queued, and wait_us is the part of the read time the task slept.
+ */
+typedef struct {
+    uint32_t polls;         /*!< Completed polls */
+    uint32_t reads;         /*!< Burst reads of the status and points */
+    uint32_t clears;        /*!< Status clear writes */
+    uint32_t errors;        /*!< Failed I2C transactions */
+    uint32_t queued;        /*!< Transfers queued on an asynchronous bus, 0 on a blocking one */
+    uint64_t poll_us;       /*!< Total time spent in polls */
+    uint64_t read_us;       /*!< Total time spent in burst reads */
+    uint64_t clear_us;      /*!< Total time spent in status clears */
+    uint64_t wait_us;       /*!< Total time asleep waiting for queued transfers */
+    uint32_t poll_max_us;   /*!< Slowest poll */
+    uint32_t read_max_us;   /*!< Slowest burst read */
+    uint32_t clear_max_us;  /*!< Slowest status clear */
+} esp_lcd_touch_gt911_stats_t;
+
+/**
+ * @brief Get the timing counters of the GT911 read path
+ *
+ * @note The counters are shared by all GT911 instances.
+ *
+ * @param stats: Copy of the counters
+ */
+void esp_lcd_touch_gt911_get_stats(esp_lcd_touch_gt911_stats_t *stats);
+
+/**
+ * @brief Reset the timing counters of the GT911 read path
+ */
+void esp_lcd_touch_gt911_reset_stats(void);
+
 /**
  * @brief I2C address of the GT911 controller
  *
@@ -0,0 +1,118 @@
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "lvgl.h"
+#include "area_policy.h"
+#include "area_bench.h"
+
+#define AREA_BENCH_ITERATIONS 20
+
+static const char *TAG = "AREA_BENCH";
+
+// LVGL mutex (from esp32_s3.c)
+extern SemaphoreHandle_t lvgl_mux;
+
+typedef void (*area_bench_step_t)(lv_obj_t *screen, int iteration);
+
+/**
+ * @brief Arc Sweep Scenario
+ *
+ * Moves every visible arc one step, like dragging the weight slider.
+ */
+static void step_arc_sweep(lv_obj_t *screen, int iteration)
+{
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(screen); i++)
+    {
+        lv_obj_t *child = lv_obj_get_child(screen, i);
+        if (!lv_obj_check_type(child, &lv_arc_class) || lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN))
+            continue;
+
+        int16_t min = lv_arc_get_min_value(child);
+        int16_t max = lv_arc_get_max_value(child);
+        lv_arc_set_value(child, min + iteration % (max - min + 1));
+    }
+}
+
+/**
+ * @brief Label Churn Scenario
+ *
+ * Invalidates every visible label in the same frame, like a rep count and
+ * effort update arriving together over UART.
+ */
+static void step_label_churn(lv_obj_t *screen, int iteration)
+{
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(screen); i++)
+    {
+        lv_obj_t *child = lv_obj_get_child(screen, i);
+        if (lv_obj_check_type(child, &lv_label_class) && !lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN))
+            lv_obj_invalidate(child);
+    }
+}
+
+/**
+ * @brief Screen Load Scenario
+ *
+ * Redraws the whole screen.
+ */
+static void step_full_screen(lv_obj_t *screen, int iteration)
+{
+    lv_obj_invalidate(screen);
+}
+
+static void run_scenario(const char *name, area_bench_step_t step, bool enable)
+{
+    area_policy_stats_t stats;
+
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    lv_obj_t *screen = lv_scr_act();
+    area_policy_enable(enable);
+    lv_refr_now(NULL);
+    area_policy_reset_stats();
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < AREA_BENCH_ITERATIONS; i++)
+    {
+        step(screen, i);
+        lv_refr_now(NULL);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    area_policy_get_stats(&stats);
+    xSemaphoreGiveRecursive(lvgl_mux);
+
+    uint32_t kbytes = stats.flushed_px * sizeof(lv_color_t) / 1024;
+    uint32_t bandwidth = stats.flush_us ? (uint32_t)((uint64_t)stats.flushed_px * sizeof(lv_color_t) / stats.flush_us) : 0;
+    ESP_LOGI(TAG, "%-12s %-3s flushes:%lu written:%lukB partial lines:%lu copy:%lluus (%luMB/s) total:%lldus",
+             name, enable ? "on" : "off", stats.flushes, kbytes, stats.partial_lines,
+             stats.flush_us, bandwidth, elapsed);
+}
+
+/**
+ * @brief Run the Area Policy Benchmark
+ *
+ * Runs each UI scenario on the active screen with cache line rounding and
+ * area merging disabled and enabled, and logs framebuffer write statistics.
+ * The policy is left enabled afterwards.
+ */
+void area_bench_run(void)
+{
+    static const struct {
+        const char *name;
+        area_bench_step_t step;
+    } scenarios[] = {
+        {"arc sweep", step_arc_sweep},
+        {"label churn", step_label_churn},
+        {"full screen", step_full_screen},
+    };
+
+    ESP_LOGI(TAG, "Running %d iterations per scenario", AREA_BENCH_ITERATIONS);
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+    {
+        run_scenario(scenarios[i].name, scenarios[i].step, false);
+        run_scenario(scenarios[i].name, scenarios[i].step, true);
+    }
+    area_policy_enable(true);
+}
@@ -0,0 +1,15 @@
+#ifndef AREA_BENCH_H
+#define AREA_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Function declarations
+void area_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AREA_BENCH_H */
@@ -0,0 +1,128 @@
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "area_policy.h"
+
+static const char *TAG = "AREA";
+
+static lv_disp_t *policy_disp;
+static bool policy_enabled = true;
+static area_policy_stats_t policy_stats;
+
+/**
+ * @brief Estimate the cost of refreshing an area
+ *
+ * The cost is the number of pixels written plus a fixed penalty for every
+ * flush LVGL needs to push the area through the draw buffer.
+ *
+ * @param[in] drv Pointer to the display driver structure.
+ * @param[in] area Area to estimate.
+ * @return Cost in pixel units.
+ */
+static uint32_t area_cost(const lv_disp_drv_t *drv, const lv_area_t *area)
+{
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t rows = drv->draw_buf->size / w;
+    if (rows == 0)
+        rows = 1;
+    uint32_t flushes = (h + rows - 1) / rows;
+
+    return w * h + flushes * AREA_FLUSH_COST_PX;
+}
+
+/**
+ * @brief Initialize the Area Policy
+ *
+ * @param[in] disp Display whose invalidated areas are aligned and merged.
+ */
+void area_policy_init(lv_disp_t *disp)
+{
+    policy_disp = disp;
+    area_policy_reset_stats();
+    ESP_LOGI(TAG, "Align dirty areas to %d px, flush cost %d px", (int)AREA_CACHE_LINE_PX, AREA_FLUSH_COST_PX);
+}
+
+void area_policy_enable(bool enable)
+{
+    policy_enabled = enable;
+}
+
+bool area_policy_is_enabled(void)
+{
+    return policy_enabled;
+}
+
+/**
+ * @brief LVGL Rounder Callback
+ *
+ * Widens the area horizontally to whole PSRAM cache lines, so that
+ * `esp_lcd_panel_draw_bitmap` never leaves a partially written line behind.
+ * While LVGL is collecting invalidations, the area is also merged into an
+ * already pending area when refreshing the union is cheaper than refreshing
+ * both separately. The pending area is grown in place, so LVGL finds the new
+ * area inside it and does not allocate another invalidation slot.
+ *
+ * @param[in] drv Pointer to the display driver structure.
+ * @param[in,out] area Area to round.
+ */
+void area_policy_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area)
+{
+    if (!policy_enabled)
+        return;
+
+    area->x1 &= ~(lv_coord_t)(AREA_CACHE_LINE_PX - 1);
+    area->x2 |= (lv_coord_t)(AREA_CACHE_LINE_PX - 1);
+    if (area->x2 > drv->hor_res - 1)
+        area->x2 = drv->hor_res - 1;
+
+    // LVGL also calls the rounder on probe areas while rendering
+    if (policy_disp == NULL || policy_disp->rendering_in_progress)
+        return;
+
+    for (uint16_t i = 0; i < policy_disp->inv_p; i++)
+    {
+        lv_area_t *pending = &policy_disp->inv_areas[i];
+        if (policy_disp->inv_area_joined[i])
+            continue;
+
+        lv_area_t merged;
+        _lv_area_join(&merged, area, pending);
+        if (area_cost(drv, &merged) <= area_cost(drv, area) + area_cost(drv, pending))
+        {
+            *pending = merged;
+            *area = merged;
+        }
+    }
+}
+
+/**
+ * @brief Account a Flush
+ *
+ * Called from the flush callback to collect write bandwidth statistics.
+ *
+ * @param[in] area Area that was written into the framebuffer.
+ * @param[in] elapsed_us Time spent copying the area.
+ */
+void area_policy_account_flush(const lv_area_t *area, uint32_t elapsed_us)
+{
+    uint32_t h = lv_area_get_height(area);
+    uint32_t head = (area->x1 * sizeof(lv_color_t)) % AREA_CACHE_LINE_BYTES;
+    uint32_t tail = ((area->x2 + 1) * sizeof(lv_color_t)) % AREA_CACHE_LINE_BYTES;
+
+    policy_stats.flushes++;
+    policy_stats.flushed_px += lv_area_get_size(area);
+    policy_stats.partial_lines += ((head ? 1 : 0) + (tail ? 1 : 0)) * h;
+    policy_stats.flush_us += elapsed_us;
+}
+
+void area_policy_get_stats(area_policy_stats_t *stats)
+{
+    *stats = policy_stats;
+}
+
+void area_policy_reset_stats(void)
+{
+    memset(&policy_stats, 0, sizeof(policy_stats));
+}
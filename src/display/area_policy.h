@@ -0,0 +1,49 @@
+#ifndef AREA_POLICY_H
+#define AREA_POLICY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PSRAM cache line on the ESP32-S3 (matches psram_trans_align of the RGB panel)
+#define AREA_CACHE_LINE_BYTES 64
+#define AREA_CACHE_LINE_PX    (AREA_CACHE_LINE_BYTES / sizeof(lv_color_t))
+
+// Extra cost of one more flush, expressed in pixels. Every flush waits for a
+// VSYNC, so an additional flush is far more expensive than copying a few more
+// pixels of an already dirty row.
+#define AREA_FLUSH_COST_PX    (8 * 1024)
+
+// Flush statistics used to compare framebuffer write bandwidth
+typedef struct {
+    uint32_t flushes;       // Number of flush_cb calls
+    uint32_t flushed_px;    // Pixels written into the framebuffer
+    uint32_t partial_lines; // Cache lines only partially written
+    uint64_t flush_us;      // Time spent in esp_lcd_panel_draw_bitmap
+} area_policy_stats_t;
+
+// Function declarations
+void area_policy_init(lv_disp_t *disp);
+
+void area_policy_enable(bool enable);
+
+bool area_policy_is_enabled(void);
+
+void area_policy_rounder_cb(lv_disp_drv_t *drv, lv_area_t *area);
+
+void area_policy_account_flush(const lv_area_t *area, uint32_t elapsed_us);
+
+void area_policy_get_stats(area_policy_stats_t *stats);
+
+void area_policy_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AREA_POLICY_H */
@@ -0,0 +1,130 @@
+#include <string.h>
+
+#include "asset_bundle.h"
+
+// Plain C without ESP-IDF dependencies, so bundles built by the packer and the fonts attached to them can be
+// checked on the host
+
+// CRC-32 (IEEE, as zlib.crc32), one nibble at a time
+uint32_t asset_bundle_crc32(uint32_t crc, const void *data, size_t len)
+{
+    static const uint32_t table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+        0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+    };
+    const uint8_t *p = data;
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ table[crc & 0x0f];
+        crc = (crc >> 4) ^ table[crc & 0x0f];
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Open a Mapped Bundle
+ *
+ * Checks the header and the index CRC, and that every entry lies inside the
+ * bundle. The asset data is only checked by asset_bundle_verify.
+ *
+ * @param[out] bundle Bundle, pointing into the mapping.
+ * @param[in] base Start of the mapping.
+ * @param[in] len Size of the mapping.
+ * @return true if the bundle is usable.
+ */
+bool asset_bundle_open(asset_bundle_t *bundle, const void *base, size_t len)
+{
+    const asset_bundle_header_t *header = base;
+
+    memset(bundle, 0, sizeof(*bundle));
+    if (len < sizeof(*header) || header->magic != ASSET_BUNDLE_MAGIC || header->version != ASSET_BUNDLE_VERSION)
+        return false;
+    if (header->size > len || sizeof(*header) + (size_t)header->count * sizeof(asset_bundle_entry_t) > header->size)
+        return false;
+
+    const asset_bundle_entry_t *index = (const asset_bundle_entry_t *)(header + 1);
+    if (asset_bundle_crc32(0, index, header->count * sizeof(*index)) != header->index_crc)
+        return false;
+
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        if (index[i].offset % ASSET_BUNDLE_ALIGN || index[i].offset > header->size ||
+            index[i].size > header->size - index[i].offset)
+            return false;
+    }
+
+    bundle->base = base;
+    bundle->index = index;
+    bundle->count = header->count;
+    return true;
+}
+
+/**
+ * @brief Find an Asset by Name
+ *
+ * @return Index of the entry, or -1.
+ */
+int asset_bundle_find(const asset_bundle_t *bundle, const char *name)
+{
+    for (int i = 0; i < bundle->count; i++)
+    {
+        if (strncmp(bundle->index[i].name, name, ASSET_BUNDLE_NAME_LEN) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Check the Data of One Asset
+ *
+ * Reads the whole asset, so through a flash mapping it is worth doing once,
+ * on first use.
+ *
+ * @return true if the data matches the CRC of its entry.
+ */
+bool asset_bundle_verify(const asset_bundle_t *bundle, int i)
+{
+    const asset_bundle_entry_t *entry = &bundle->index[i];
+    return asset_bundle_crc32(0, bundle->base + entry->offset, entry->size) == entry->crc;
+}
+
+#if ASSET_BUNDLE_LVGL
+/**
+ * @brief Point a Bundled Font at its Glyphs
+ *
+ * Fonts bundled by tools/asset_pipeline.py are compiled from copies in
+ * src/fonts/bundled/ without their glyph_bitmap array, and with their
+ * lv_font_fmt_txt_dsc_t in RAM rather than const, so that its glyph_bitmap
+ * can point into the mapped bundle. Everything else of the font, the glyph
+ * descriptors, character maps and kerning, stays in the app.
+ *
+ * @param[in] bundle Open bundle.
+ * @param[in] i Index of the font's entry, already verified.
+ * @param[in] font Bundled font.
+ * @return false if the font is not a bundled copy or the entry is not a font.
+ */
+bool asset_bundle_attach_font(const asset_bundle_t *bundle, int i, const lv_font_t *font)
+{
+    const asset_bundle_entry_t *entry = &bundle->index[i];
+
+    // The compiled-in subsets keep their descriptor const, in flash
+    if (font->get_glyph_bitmap != asset_bundle_font_bitmap || entry->type != ASSET_TYPE_FONT)
+        return false;
+
+    lv_font_fmt_txt_dsc_t *dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if (entry->cf != dsc->bpp)
+        return false;
+    dsc->glyph_bitmap = bundle->base + entry->offset;
+    return true;
+}
+
+// get_glyph_bitmap of the bundled fonts: until the bundle is mounted, text in them is not drawn
+const uint8_t *asset_bundle_font_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t *dsc = font->dsc;
+    return dsc->glyph_bitmap ? lv_font_get_bitmap_fmt_txt(font, letter) : NULL;
+}
+#endif
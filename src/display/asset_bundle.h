@@ -0,0 +1,79 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if __has_include("lvgl.h")
+#include "lvgl.h"
+#define ASSET_BUNDLE_LVGL 1 // Not on the host (tools/img_codec_bench.c)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Layout shared with the packer in tools/asset_pipeline.py, little endian
+#define ASSET_BUNDLE_MAGIC      0x54534148 // "HAST"
+#define ASSET_BUNDLE_VERSION    1
+#define ASSET_BUNDLE_ALIGN      16         // Data offset alignment
+#define ASSET_BUNDLE_NAME_LEN   28
+#define ASSET_BUNDLE_PARTITION  "assets"
+#define ASSET_BUNDLE_SUBTYPE    0x40       // Data partition subtype, see partitions.csv
+
+typedef enum {
+    ASSET_TYPE_IMAGE = 1,
+    ASSET_TYPE_FONT,      // glyph_bitmap of a font subset, the rest of the font stays compiled in
+} asset_type_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;       // Index entries following the header
+    uint32_t size;        // Whole bundle, header included
+    uint32_t index_crc;   // CRC-32 of the index entries
+} asset_bundle_header_t;
+
+typedef struct __attribute__((packed)) {
+    char name[ASSET_BUNDLE_NAME_LEN]; // NUL padded
+    uint32_t offset;      // From the start of the bundle
+    uint32_t size;
+    uint32_t crc;         // CRC-32 of the data
+    uint8_t type;         // asset_type_t
+    uint8_t cf;           // LVGL colour format of an image, bpp of a font
+    uint16_t w;
+    uint16_t h;
+    uint16_t reserved;
+} asset_bundle_entry_t;
+
+typedef struct {
+    const uint8_t *base;  // Start of the mapped bundle
+    const asset_bundle_entry_t *index;
+    uint16_t count;
+} asset_bundle_t;
+
+// Function declarations
+uint32_t asset_bundle_crc32(uint32_t crc, const void *data, size_t len);
+
+bool asset_bundle_open(asset_bundle_t *bundle, const void *base, size_t len);
+
+int asset_bundle_find(const asset_bundle_t *bundle, const char *name);
+
+bool asset_bundle_verify(const asset_bundle_t *bundle, int i);
+
+#if ASSET_BUNDLE_LVGL
+bool asset_bundle_attach_font(const asset_bundle_t *bundle, int i, const lv_font_t *font);
+
+const uint8_t *asset_bundle_font_bitmap(const lv_font_t *font, uint32_t letter);
+
+bool asset_bundle_mount(void);
+
+const lv_img_dsc_t *asset_bundle_img(const char *name);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASSET_BUNDLE_H */
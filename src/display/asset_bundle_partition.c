@@ -0,0 +1,138 @@
+#include <stdlib.h>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "asset_bundle.h"
+#include "../fonts/font_bundle.h"
+
+static const char *TAG = "ASSETS";
+
+// Fonts whose glyphs the pipeline moved to the bundle, with the size and CRC-32 their descriptors were built for
+#define FONT_BUNDLE_FONT(font, size, crc) {#font, &font, size, crc},
+static const struct {
+    const char *name;
+    const lv_font_t *font;
+    uint32_t size;
+    uint32_t crc;
+} fonts[] = {FONT_BUNDLE_FONTS{NULL, NULL, 0, 0}};
+
+static asset_bundle_t bundle;
+static esp_partition_mmap_handle_t mmap_handle;
+
+// Descriptors handed to LVGL, filled on first use; data points into the mapping
+static lv_img_dsc_t *images;
+static uint8_t *checked; // 0 not checked yet, 1 valid, 2 corrupt
+
+/*
+ * The glyph descriptors compiled into the app index into the bitmap of the
+ * same subset, so a font is only attached to a bundle packed from it. It is
+ * verified now rather than on first use, as LVGL has no way to refuse a
+ * font; one left unattached draws no text.
+ */
+static void attach_fonts(void)
+{
+    for (int f = 0; fonts[f].name; f++)
+    {
+        int i = asset_bundle_find(&bundle, fonts[f].name);
+        if (i < 0)
+        {
+            ESP_LOGE(TAG, "No glyphs of %s in the bundle", fonts[f].name);
+            continue;
+        }
+        const asset_bundle_entry_t *entry = &bundle.index[i];
+        if (entry->size != fonts[f].size || entry->crc != fonts[f].crc || !asset_bundle_verify(&bundle, i) ||
+            !asset_bundle_attach_font(&bundle, i, fonts[f].font))
+        {
+            ESP_LOGE(TAG, "Glyphs of %s do not match the firmware, flash the bundle built with it", fonts[f].name);
+            continue;
+        }
+        ESP_LOGI(TAG, "%s: %lu bytes of glyphs mapped", fonts[f].name, entry->size);
+    }
+}
+
+/**
+ * @brief Map the Asset Partition
+ *
+ * Maps the whole partition into the data address space without reading it;
+ * flash is only fetched through the cache when an asset is drawn. The
+ * bundled fonts are attached, so call it before LVGL draws text.
+ *
+ * @return true if a valid bundle was found.
+ */
+bool asset_bundle_mount(void)
+{
+    const void *base;
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSET_BUNDLE_SUBTYPE,
+                                                           ASSET_BUNDLE_PARTITION);
+    if (part == NULL)
+    {
+        ESP_LOGE(TAG, "No \"%s\" partition", ASSET_BUNDLE_PARTITION);
+        return false;
+    }
+
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &base, &mmap_handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Mapping the asset partition failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    if (!asset_bundle_open(&bundle, base, part->size))
+    {
+        ESP_LOGE(TAG, "No valid asset bundle, flash one with tools/asset_pipeline.py");
+        esp_partition_munmap(mmap_handle);
+        return false;
+    }
+
+    images = calloc(bundle.count, sizeof(lv_img_dsc_t));
+    checked = calloc(bundle.count, 1);
+    if (images == NULL || checked == NULL)
+    {
+        free(images);
+        free(checked);
+        images = NULL;
+        checked = NULL;
+        bundle.count = 0;
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Mapped %u assets at %p", bundle.count, base);
+    attach_fonts();
+    return true;
+}
+
+/**
+ * @brief Get an Image from the Bundle
+ *
+ * The image data stays in flash, LVGL draws from the mapping. The asset is
+ * verified on first use; a corrupt one is never returned.
+ *
+ * @param[in] name Asset name from src/assets.json.
+ * @return Image descriptor, valid for the lifetime of the application, or NULL.
+ */
+const lv_img_dsc_t *asset_bundle_img(const char *name)
+{
+    int i = asset_bundle_find(&bundle, name);
+    if (i < 0 || bundle.index[i].type != ASSET_TYPE_IMAGE)
+    {
+        ESP_LOGE(TAG, "No image \"%s\" in the bundle", name);
+        return NULL;
+    }
+
+    if (checked[i] == 0)
+    {
+        const asset_bundle_entry_t *entry = &bundle.index[i];
+        checked[i] = asset_bundle_verify(&bundle, i) ? 1 : 2;
+        if (checked[i] == 2)
+            ESP_LOGE(TAG, "Image \"%s\" is corrupt", name);
+
+        images[i].header.cf = entry->cf;
+        images[i].header.w = entry->w;
+        images[i].header.h = entry->h;
+        images[i].data_size = entry->size;
+        images[i].data = bundle.base + entry->offset;
+    }
+
+    return checked[i] == 1 ? &images[i] : NULL;
+}
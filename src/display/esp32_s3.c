@@ -7,10 +7,22 @@
 
 #include "driver/ledc.h"
 #include "driver/gpio.h"
-#include "driver/i2c.h"
+#include "driver/i2c_master.h"
+
+#include "esp_attr.h"
+#include "esp_timer.h"
 
 #include "lvgl.h"
 #include "esp32_s3.h"
+#include "area_policy.h"
+#include "glyph_cache.h"
+#include "img_decoder.h"
+#include "parallel_render.h"
+#include "touch_filter.h"
+#include "touch_calib.h"
+#include "latency.h"
+#include "../task/boot_mem.h"
+#include "../task/touch_task.h"
 
 // --- Choose your display ---
 // #include "sunton_7inch_800x480.h"
@@ -28,7 +40,9 @@
 static const char *TAG = "DISPLAY";
 
 static void touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data);
+static void touch_process_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+static void lvgl_flush_area(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
 static bool on_vsync_event(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *event_data, void *user_data);
 static void lvgl_port_task(void *arg);
 
@@ -36,6 +50,26 @@ SemaphoreHandle_t lvgl_mux;
 SemaphoreHandle_t sem_vsync_end;
 SemaphoreHandle_t sem_gui_ready;
 
+// Long-lived RTOS objects and buffers are static, so boot allocates nothing for them and cannot fail
+static StaticSemaphore_t lvgl_mux_buf;
+static StaticSemaphore_t sem_vsync_end_buf;
+static StaticSemaphore_t sem_gui_ready_buf;
+static StaticTask_t lvgl_task_tcb;
+static StackType_t lvgl_task_stack[LVGL_TASK_STACK_SIZE];
+#if !CONFIG_DOUBLE_FB
+#define LVGL_DRAW_BUF_LINES 10
+// In PSRAM (CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY), aligned for the panel's PSRAM transfers
+EXT_RAM_BSS_ATTR static lv_color_t draw_buf1[LCD_H_RES * LVGL_DRAW_BUF_LINES] __attribute__((aligned(64)));
+EXT_RAM_BSS_ATTR static lv_color_t draw_buf2[LCD_H_RES * LVGL_DRAW_BUF_LINES] __attribute__((aligned(64)));
+#endif
+touch_filter_t touch_filter;
+
+static uint8_t touch_filter_track; // Track ID of the point being filtered
+static bool touch_raw;             // Report controller coordinates untouched, see set_touch_raw
+
+static touch_calib_t touch_calib = TOUCH_CALIB_DEFAULT;
+static portMUX_TYPE touch_calib_lock = portMUX_INITIALIZER_UNLOCKED;
+
 /**
  * @brief Initialize Display
  *
@@ -99,8 +133,8 @@ void set_backlight_brightness(uint8_t brightness)
 /**
  * @brief Initialize Touch Driver
  *
- * This function installs the touch driver, configures the I2C interface for touch communication,
- * initializes the touch controller, and creates a touch handle for touch input.
+ * This function creates the I2C master bus, asynchronous when I2C_QUEUE_DEPTH is non-zero,
+ * initializes the touch controller on it, and creates a touch handle for touch input.
  *
  * @param[out] touch_handle Pointer to the handle for the initialized touch controller.
  */
@@ -109,42 +143,67 @@ void init_touch(esp_lcd_touch_handle_t *touch_handle)
 
     ESP_LOGI(TAG, "Install Touch driver");
 
-    const i2c_config_t i2c_conf = {
-        .mode = I2C_MODE_MASTER,
+    const i2c_master_bus_config_t i2c_bus_conf = {
+        .i2c_port = I2C_NUM,
         .sda_io_num = I2C_SDA,
-        .sda_pullup_en = GPIO_PULLUP_DISABLE,
         .scl_io_num = I2C_SCL,
-        .scl_pullup_en = GPIO_PULLUP_DISABLE,
-        .master.clk_speed = I2C_CLK_SPEED_HZ};
-    ESP_LOGI(TAG, "i2c_param_config");
-    i2c_param_config(I2C_NUM, &i2c_conf);
-    ESP_LOGI(TAG, "i2c_driver_install");
-    i2c_driver_install(I2C_NUM, i2c_conf.mode, 0, 0, 0);
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .trans_queue_depth = I2C_QUEUE_DEPTH,
+        .flags.enable_internal_pullup = false,
+    };
+    i2c_master_bus_handle_t i2c_bus = NULL;
+    ESP_LOGI(TAG, "i2c_new_master_bus (%s)", I2C_QUEUE_DEPTH ? "async" : "blocking");
+    ESP_ERROR_CHECK(i2c_new_master_bus(&i2c_bus_conf, &i2c_bus));
 
     /* Initialize touch */
     const esp_lcd_touch_config_t tp_cfg = {
         .x_max = LCD_H_RES,
         .y_max = LCD_V_RES,
         .rst_gpio_num = I2C_RST,
-        .int_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = I2C_INT,
         .levels = {
             .reset = 0,
             .interrupt = 0,
         },
         .flags = {
             .swap_xy = 0,
-            .mirror_x = 1, // Mirror X axis
-            .mirror_y = 1, // Mirror Y axis
+            .mirror_x = 0, // Mirroring is part of the calibration matrix
+            .mirror_y = 0,
         },
+        .process_coordinates = touch_process_coordinates,
     };
-    esp_lcd_panel_io_handle_t tp_io_handle = NULL;
 
-    const esp_lcd_panel_io_i2c_config_t tp_io_config = ESP_LCD_TOUCH_IO_I2C_GT911_CONFIG();
+    touch_filter_init(&touch_filter, NULL);
+    if (!touch_calib_load(&touch_calib))
+    {
+        ESP_LOGI(TAG, "No stored touch calibration, using the board default");
+    }
+
+    const esp_lcd_touch_gt911_i2c_config_t tp_i2c_config = {
+        .dev_addr = ESP_LCD_TOUCH_IO_I2C_GT911_ADDRESS,
+        .scl_speed_hz = I2C_CLK_SPEED_HZ,
+        .async = I2C_QUEUE_DEPTH > 0,
+    };
 
-    ESP_LOGI(TAG, "Create LCD panel IO handle");
-    esp_lcd_new_panel_io_i2c((esp_lcd_i2c_bus_handle_t)I2C_NUM, &tp_io_config, &tp_io_handle);
     ESP_LOGI(TAG, "Create a new GT911 touch driver");
-    esp_lcd_touch_new_i2c_gt911(tp_io_handle, &tp_cfg, touch_handle);
+    esp_lcd_touch_new_i2c_master_gt911(i2c_bus, &tp_i2c_config, &tp_cfg, touch_handle);
+    if (*touch_handle)
+    {
+        boot_mem_register("GT911 driver", *touch_handle, esp_lcd_touch_gt911_get_instance_size());
+    }
+
+    /* Board specific report rate and filtering */
+    const esp_lcd_touch_gt911_tuning_t tp_tuning = {
+        .report_period_ms = GT911_REPORT_PERIOD_MS,
+        .touch_level = GT911_TOUCH_LEVEL,
+        .leave_level = GT911_LEAVE_LEVEL,
+        .noise_reduction = GT911_NOISE_REDUCTION,
+        .coord_filter = GT911_COORD_FILTER,
+        .shake_count = GT911_SHAKE_COUNT,
+    };
+    ESP_LOGI(TAG, "Tune GT911");
+    esp_lcd_touch_gt911_set_tuning(*touch_handle, &tp_tuning);
 }
 
 /**
@@ -161,8 +220,8 @@ void init_lcd(esp_lcd_panel_handle_t *panel_handle)
 
     ESP_LOGI(TAG, "Install RGB LCD panel driver");
 
-    sem_vsync_end = xSemaphoreCreateBinary();
-    sem_gui_ready = xSemaphoreCreateBinary();
+    sem_vsync_end = xSemaphoreCreateBinaryStatic(&sem_vsync_end_buf);
+    sem_gui_ready = xSemaphoreCreateBinaryStatic(&sem_gui_ready_buf);
 
     esp_lcd_rgb_panel_config_t panel_config = {
         .data_width = 16, // RGB565 in parallel mode, thus 16bit in width
@@ -224,9 +283,9 @@ void init_lcd(esp_lcd_panel_handle_t *panel_handle)
 /**
  * @brief Initialize LVGL Library
  *
- * This function initializes the LVGL library, allocates separate draw buffers from PSRAM,
+ * This function initializes the LVGL library with the static draw buffers in PSRAM,
  * registers the display driver and input device driver to LVGL, creates a semaphore for
- * LVGL synchronization, and starts the LVGL port task.
+ * LVGL synchronization, and starts the LVGL port task on its static stack.
  *
  * @param[in] panel_handle Handle to the LCD panel associated with LVGL.
  * @param[in] touch_handle Handle to the touchpad device associated with LVGL.
@@ -236,12 +295,13 @@ void init_lvgl(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t touch
 
     ESP_LOGI(TAG, "Initialize LVGL library");
 
-    lvgl_mux = xSemaphoreCreateRecursiveMutex();
+    lvgl_mux = xSemaphoreCreateRecursiveMutexStatic(&lvgl_mux_buf);
 
     static lv_disp_draw_buf_t disp_buf; // contains internal graphic buffer(s) called draw buffer(s)
     static lv_disp_drv_t disp_drv;      // contains callback functions
 
     lv_init();
+    img_decoder_init(IMG_DECODER_CACHE_BYTES); // compressed images from the asset pipeline
 
     void *buf1 = NULL;
     void *buf2 = NULL;
@@ -252,10 +312,13 @@ void init_lvgl(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t touch
     // initialize LVGL draw buffers
     lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LCD_H_RES * LCD_V_RES);
 #else
-    ESP_LOGI(TAG, "Allocate separate LVGL draw buffers from PSRAM");
-    buf1 = heap_caps_malloc(LCD_H_RES * 10 * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    // initialize LVGL draw buffers
-    lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LCD_H_RES * 10);
+    ESP_LOGI(TAG, "Use separate LVGL draw buffers in PSRAM");
+    buf1 = draw_buf1;
+    buf2 = draw_buf2;
+    boot_mem_register("LVGL draw buffer 1", draw_buf1, sizeof(draw_buf1));
+    boot_mem_register("LVGL draw buffer 2", draw_buf2, sizeof(draw_buf2));
+    // initialize LVGL draw buffers, one is rendered while the other is flushed
+    lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LCD_H_RES * LVGL_DRAW_BUF_LINES);
 #endif
 
     ESP_LOGI(TAG, "Register display driver to LVGL");
@@ -267,8 +330,18 @@ void init_lvgl(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t touch
     disp_drv.user_data = panel_handle;
 #if CONFIG_DOUBLE_FB
     disp_drv.full_refresh = true; // the full_refresh mode can maintain the synchronization between the two frame buffers
+#else
+    disp_drv.rounder_cb = area_policy_rounder_cb; // align dirty areas to PSRAM cache lines and merge neighbours
+    disp_drv.wait_cb = parallel_render_wait_cb;   // block instead of spinning while the other core flushes
+    parallel_render_init(lvgl_flush_area, LVGL_FLUSH_TASK_CORE);
 #endif
-    lv_disp_drv_register(&disp_drv);
+    glyph_cache_init(GLYPH_CACHE_BUDGET_BYTES);
+    disp_drv.draw_ctx_init = glyph_cache_draw_ctx_init; // copy pre-blended glyph tiles where possible
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    area_policy_init(disp);
+
+    ESP_LOGI(TAG, "Start touch task");
+    touch_task_start(touch_handle);
 
     ESP_LOGI(TAG, "Register input device driver to LVGL");
     static lv_indev_drv_t indev_drv;
@@ -276,43 +349,124 @@ void init_lvgl(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t touch
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = touchpad_read;
     indev_drv.user_data = touch_handle;
-    lv_indev_drv_register(&indev_drv);
+    lv_indev_t *indev = lv_indev_drv_register(&indev_drv);
+    // Reading only drains the sample queue, so it can run more often than LV_INDEV_DEF_READ_PERIOD
+    lv_timer_set_period(indev->driver->read_timer, TOUCH_INDEV_READ_PERIOD);
 
     ESP_LOGI(TAG, "Start lv_timer_handler task");
 
-    xTaskCreate(lvgl_port_task, "LVGL", LVGL_TASK_STACK_SIZE, NULL, LVGL_TASK_PRIORITY, NULL);
+    xTaskCreateStaticPinnedToCore(lvgl_port_task, "LVGL", LVGL_TASK_STACK_SIZE, NULL, LVGL_TASK_PRIORITY,
+                                  lvgl_task_stack, &lvgl_task_tcb, LVGL_TASK_CORE);
+    boot_mem_register("LVGL task stack", lvgl_task_stack, sizeof(lvgl_task_stack));
 }
 
 /**
  * @brief Touchpad Read Function
  *
- * This function reads touchpad input and updates the LVGL input device data accordingly.
+ * This function drains the samples collected by the touch task and updates the LVGL input device
+ * data accordingly. It never touches the I2C bus. When more samples are queued, LVGL is asked to
+ * call it again right away (buffered mode), so no press or release is lost.
  *
  * @param[in] indev_driver Pointer to the LVGL input device driver structure.
  * @param[out] data Pointer to the LVGL input device data structure to be updated.
  */
 static void touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
 {
+    static lv_indev_data_t last = {.state = LV_INDEV_STATE_REL};
 
-    esp_lcd_touch_handle_t touch_handle = (esp_lcd_touch_handle_t)indev_driver->user_data;
+    touch_sample_t sample;
+    if (touch_task_pop(&sample))
+    {
+        last.state = sample.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+        if (sample.pressed)
+        {
+            latency_input(sample.time_us);
+            // ESP_LOGI(TAG, "Touchpad_read %d %d", sample.x, sample.y);
+            /*Set the coordinates*/
+            last.point.x = sample.x;
+            last.point.y = sample.y;
+        }
+    }
 
-    uint16_t touchpad_x;
-    uint16_t touchpad_y;
-    uint16_t touch_strength;
-    uint8_t touch_cnt = 0;
+    data->state = last.state;
+    data->point = last.point;
+    data->continue_reading = touch_task_pending();
+}
 
-    data->state = LV_INDEV_STATE_REL;
+/**
+ * @brief Set the Touch Calibration
+ *
+ * Takes effect from the next touch sample. The matrix is not stored, see touch_calib_save.
+ *
+ * @param[in] calib Calibration matrix, or NULL to report raw controller coordinates.
+ */
+void set_touch_calibration(const touch_calib_t *calib)
+{
+    static const touch_calib_t identity = {TOUCH_CALIB_ONE, 0, 0, 0, TOUCH_CALIB_ONE, 0};
 
-    esp_lcd_touch_read_data(touch_handle);
-    bool touchpad_pressed = esp_lcd_touch_get_coordinates(touch_handle, &touchpad_x, &touchpad_y, &touch_strength, &touch_cnt, 1);
-    if (touchpad_pressed)
+    portENTER_CRITICAL(&touch_calib_lock);
+    touch_calib = calib ? *calib : identity;
+    portEXIT_CRITICAL(&touch_calib_lock);
+}
+
+void get_touch_calibration(touch_calib_t *calib)
+{
+    portENTER_CRITICAL(&touch_calib_lock);
+    *calib = touch_calib;
+    portEXIT_CRITICAL(&touch_calib_lock);
+}
+
+/**
+ * @brief Report Raw Touch Coordinates
+ *
+ * While set, touch points are the controller's own: not smoothed, predicted,
+ * calibrated or clamped to the panel, so calibration samples show where the
+ * finger really was. LVGL still gets them, clamped by itself. Takes effect
+ * from the next touch sample.
+ *
+ * @param[in] raw true to report raw coordinates, false for the processed ones.
+ */
+void set_touch_raw(bool raw)
+{
+    __atomic_store_n(&touch_raw, raw, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Touch Coordinate Processing
+ *
+ * Called by esp_lcd_touch_get_coordinates for every pressed sample. Smooths the first point and
+ * predicts it ahead of the finger (see touch_filter.c), then maps all points to screen coordinates
+ * with the calibration matrix.
+ */
+static void touch_process_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
+{
+    touch_calib_t calib;
+
+    if (__atomic_load_n(&touch_raw, __ATOMIC_ACQUIRE))
     {
-        // ESP_LOGI(TAG, "Touchpad_read %d %d", touchpad_x, touchpad_y);
-        data->state = LV_INDEV_STATE_PR;
+        // The first processed sample afterwards starts a new stroke
+        touch_filter_restart(&touch_filter);
+        return;
+    }
 
-        /*Set the coordinates*/
-        data->point.x = touchpad_x;
-        data->point.y = touchpad_y + 150; // Adjust upward by 150px
+    // Only the first point drives the pointer and is filtered; a different finger there is a new stroke
+    if (tp->data.coords[0].track_id != touch_filter_track)
+    {
+        touch_filter_track = tp->data.coords[0].track_id;
+        touch_filter_restart(&touch_filter);
+    }
+    touch_filter_update(&touch_filter, esp_timer_get_time(), &x[0], &y[0]);
+
+    get_touch_calibration(&calib);
+    for (uint8_t i = 0; i < *point_num; i++)
+    {
+        int32_t sx = x[i];
+        int32_t sy = y[i];
+        touch_calib_apply(&calib, &sx, &sy);
+
+        // Prediction and calibration may land past the panel edge
+        x[i] = LV_CLAMP(0, sx, LCD_H_RES - 1);
+        y[i] = LV_CLAMP(0, sy, LCD_V_RES - 1);
     }
 }
 
@@ -320,13 +474,41 @@ static void touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
  * @brief LVGL Flush Callback
  *
  * This callback function is called by LVGL to flush a portion of the display buffer to the physical display.
- * It passes the draw buffer to the LCD panel driver, indicating the area that needs to be updated.
+ * With parallel rendering the area is handed to the flush task on the other core and LVGL continues
+ * rendering into the second draw buffer; otherwise the area is flushed synchronously.
  *
  * @param[in] drv Pointer to the display driver structure.
  * @param[in] area Pointer to the area that needs to be flushed.
  * @param[in] color_map Pointer to the color map containing pixel data to be flushed.
  */
 static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    if (lv_disp_flush_is_last(drv))
+    {
+        latency_rendered();
+    }
+
+    if (parallel_render_is_enabled())
+    {
+        parallel_render_submit(drv, area, color_map);
+        return;
+    }
+
+    lvgl_flush_area(drv, area, color_map);
+    lv_disp_flush_ready(drv);
+}
+
+/**
+ * @brief Flush an Area to the Panel
+ *
+ * Waits for the VSYNC event and passes the draw buffer to the LCD panel driver,
+ * indicating the area that needs to be updated.
+ *
+ * @param[in] drv Pointer to the display driver structure.
+ * @param[in] area Pointer to the area that needs to be flushed.
+ * @param[in] color_map Pointer to the color map containing pixel data to be flushed.
+ */
+static void lvgl_flush_area(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     esp_lcd_panel_handle_t panel_handle = (esp_lcd_panel_handle_t)drv->user_data;
 
@@ -341,8 +523,10 @@ static void lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     xSemaphoreTake(sem_vsync_end, portMAX_DELAY);
 
     // pass the draw buffer to the driver
+    int64_t start = esp_timer_get_time();
     esp_lcd_panel_draw_bitmap(panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
-    lv_disp_flush_ready(drv);
+    area_policy_account_flush(area, (uint32_t)(esp_timer_get_time() - start));
+    latency_flushed();
 }
 
 /**
@@ -364,6 +548,9 @@ static bool on_vsync_event(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel
 {
     BaseType_t high_task_awoken = pdFALSE;
 
+    // The frame copied since the previous VSYNC is scanned out from here
+    latency_vsync();
+
     // Wait until LVGL has finished
     if (xSemaphoreTakeFromISR(sem_gui_ready, &high_task_awoken) == pdTRUE)
     {
@@ -377,8 +564,8 @@ static bool on_vsync_event(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel
 /**
  * @brief LVGL Port Task
  *
- * This task handles LVGL operations in the background. It periodically calls
- * the LVGL timer handler to update the GUI.
+ * This task handles LVGL operations in the background. It calls the LVGL timer
+ * handler to update the GUI, at most LVGL_TASK_DELAY_MS apart.
  *
  * @param[in] arg Pointer to task arguments (not used).
  */
@@ -390,9 +577,11 @@ static void lvgl_port_task(void *arg)
     {
 
         xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
-        lv_timer_handler();
+        uint32_t next_ms = lv_timer_handler();
         xSemaphoreGiveRecursive(lvgl_mux);
 
-        vTaskDelay(pdMS_TO_TICKS(LVGL_TASK_DELAY_MS));
+        // Sleep until the next LVGL timer is due, so short refresh periods are honoured
+        next_ms = LV_CLAMP(1, next_ms, LVGL_TASK_DELAY_MS);
+        vTaskDelay(LV_MAX(1, pdMS_TO_TICKS(next_ms)));
     }
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_rgb.h"
 
+#include "touch_calib.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -24,6 +26,12 @@ void init_lcd(esp_lcd_panel_handle_t *panel_handle);
 
 void init_lvgl(esp_lcd_panel_handle_t panel_handle, esp_lcd_touch_handle_t touch_handle);
 
+void set_touch_calibration(const touch_calib_t *calib);
+
+void get_touch_calibration(touch_calib_t *calib);
+
+void set_touch_raw(bool raw);
+
 #ifdef __cplusplus
 }
 #endif
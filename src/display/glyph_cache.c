@@ -0,0 +1,289 @@
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "glyph_cache.h"
+
+static const char *TAG = "GLYPH";
+
+typedef struct glyph_entry {
+    struct glyph_entry *bucket_next; // Next entry in the same hash bucket
+    struct glyph_entry *lru_prev;    // Towards the most recently used entry
+    struct glyph_entry *lru_next;    // Towards the least recently used entry
+    const lv_font_t *font;
+    uint32_t letter;
+    lv_color_t fg;
+    lv_color_t bg;
+    uint16_t w;
+    uint16_t h;
+    lv_color_t px[]; // Ready-to-copy tile, w * h pixels
+} glyph_entry_t;
+
+static glyph_entry_t *buckets[GLYPH_CACHE_BUCKETS];
+static glyph_entry_t *lru_head;
+static glyph_entry_t *lru_tail;
+static uint32_t cache_budget;
+static glyph_cache_stats_t cache_stats;
+
+static void (*sw_draw_letter)(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc, const lv_point_t *pos_p, uint32_t letter);
+
+static uint32_t entry_size(uint16_t w, uint16_t h)
+{
+    return sizeof(glyph_entry_t) + (uint32_t)w * h * sizeof(lv_color_t);
+}
+
+static uint32_t hash_key(const lv_font_t *font, uint32_t letter, lv_color_t fg, lv_color_t bg)
+{
+    uint32_t h = (uint32_t)(uintptr_t)font;
+    h ^= letter * 2654435761u;
+    h ^= ((uint32_t)fg.full << 16 | bg.full) * 40503u;
+    return (h ^ (h >> 15)) % GLYPH_CACHE_BUCKETS;
+}
+
+static void lru_unlink(glyph_entry_t *e)
+{
+    if (e->lru_prev)
+        e->lru_prev->lru_next = e->lru_next;
+    else
+        lru_head = e->lru_next;
+    if (e->lru_next)
+        e->lru_next->lru_prev = e->lru_prev;
+    else
+        lru_tail = e->lru_prev;
+    e->lru_prev = e->lru_next = NULL;
+}
+
+static void lru_push_front(glyph_entry_t *e)
+{
+    e->lru_prev = NULL;
+    e->lru_next = lru_head;
+    if (lru_head)
+        lru_head->lru_prev = e;
+    lru_head = e;
+    if (lru_tail == NULL)
+        lru_tail = e;
+}
+
+static void entry_remove(glyph_entry_t *e)
+{
+    glyph_entry_t **link = &buckets[hash_key(e->font, e->letter, e->fg, e->bg)];
+    while (*link != e)
+        link = &(*link)->bucket_next;
+    *link = e->bucket_next;
+
+    lru_unlink(e);
+    cache_stats.entries--;
+    cache_stats.bytes -= entry_size(e->w, e->h);
+    heap_caps_free(e);
+}
+
+static glyph_entry_t *entry_find(const lv_font_t *font, uint32_t letter, lv_color_t fg, lv_color_t bg)
+{
+    for (glyph_entry_t *e = buckets[hash_key(font, letter, fg, bg)]; e; e = e->bucket_next)
+    {
+        if (e->font == font && e->letter == letter && e->fg.full == fg.full && e->bg.full == bg.full)
+            return e;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Blend a Glyph Bitmap Onto a Solid Background
+ *
+ * @param[in] g Glyph descriptor (1, 2, 4 or 8 bpp).
+ * @param[in] bitmap Glyph bitmap, bit-packed without row padding.
+ * @param[in] fg Text colour.
+ * @param[in] bg Background colour.
+ * @param[out] dst Top left pixel of the glyph box in the destination.
+ * @param[in] stride Destination row length in pixels.
+ */
+void glyph_cache_blend(const lv_font_glyph_dsc_t *g, const uint8_t *bitmap, lv_color_t fg, lv_color_t bg,
+                       lv_color_t *dst, lv_coord_t stride)
+{
+    uint32_t bpp = g->bpp;
+    uint32_t mask = (1u << bpp) - 1;
+    uint32_t bit = 0;
+    for (uint16_t y = 0; y < g->box_h; y++, dst += stride)
+    {
+        for (uint16_t x = 0; x < g->box_w; x++, bit += bpp)
+        {
+            uint32_t shift = 8 - bpp - (bit & 7);
+            uint32_t value = (bitmap[bit >> 3] >> shift) & mask;
+            dst[x] = lv_color_mix(fg, bg, (lv_opa_t)(value * 255 / mask));
+        }
+    }
+}
+
+/**
+ * @brief Blend a Glyph Into a New Tile
+ *
+ * Evicts least recently used tiles until the new one fits into the budget.
+ *
+ * @return The new entry, or NULL if it does not fit or PSRAM is exhausted.
+ */
+static glyph_entry_t *entry_create(const lv_font_t *font, uint32_t letter, const lv_font_glyph_dsc_t *g,
+                                   const uint8_t *bitmap, lv_color_t fg, lv_color_t bg)
+{
+    uint32_t size = entry_size(g->box_w, g->box_h);
+    if (size > cache_budget)
+        return NULL;
+
+    while (lru_tail && cache_stats.bytes + size > cache_budget)
+    {
+        entry_remove(lru_tail);
+        cache_stats.evictions++;
+    }
+
+    glyph_entry_t *e = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (e == NULL)
+        return NULL;
+
+    e->font = font;
+    e->letter = letter;
+    e->fg = fg;
+    e->bg = bg;
+    e->w = g->box_w;
+    e->h = g->box_h;
+
+    glyph_cache_blend(g, bitmap, fg, bg, e->px, e->w);
+
+    uint32_t b = hash_key(font, letter, fg, bg);
+    e->bucket_next = buckets[b];
+    buckets[b] = e;
+    lru_push_front(e);
+    cache_stats.entries++;
+    cache_stats.bytes += size;
+
+    return e;
+}
+
+/**
+ * @brief Check That the Area Under a Glyph Has a Single Colour
+ *
+ * @param[in] draw_ctx Draw context holding the draw buffer.
+ * @param[in] area Clipped glyph area, in screen coordinates.
+ * @param[out] bg The uniform colour.
+ * @return true if every pixel of the area has the same colour.
+ */
+static bool area_is_uniform(const lv_draw_ctx_t *draw_ctx, const lv_area_t *area, lv_color_t *bg)
+{
+    const lv_color_t *buf = draw_ctx->buf;
+    lv_coord_t stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_coord_t w = lv_area_get_width(area);
+
+    const lv_color_t *row = buf + (area->y1 - draw_ctx->buf_area->y1) * stride + (area->x1 - draw_ctx->buf_area->x1);
+    uint16_t color = row[0].full;
+    for (lv_coord_t y = area->y1; y <= area->y2; y++, row += stride)
+    {
+        for (lv_coord_t x = 0; x < w; x++)
+        {
+            if (row[x].full != color)
+                return false;
+        }
+    }
+
+    bg->full = color;
+    return true;
+}
+
+/**
+ * @brief Draw Letter Through the Glyph Cache
+ *
+ * Replaces `draw_ctx->draw_letter`. When the glyph is drawn fully opaque onto
+ * a uniform background without masks, the pre-blended tile is copied into the
+ * draw buffer. Everything else is handed to LVGL's software renderer.
+ */
+static void glyph_cache_draw_letter(lv_draw_ctx_t *draw_ctx, const lv_draw_label_dsc_t *dsc, const lv_point_t *pos_p, uint32_t letter)
+{
+    lv_font_glyph_dsc_t g;
+
+    if (dsc->opa < LV_OPA_MAX || dsc->blend_mode != LV_BLEND_MODE_NORMAL || lv_draw_mask_is_any(NULL))
+        goto fallback;
+    if (!lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0') || g.resolved_font == NULL)
+        goto fallback;
+    if (g.box_w == 0 || g.box_h == 0 || g.resolved_font->subpx != LV_FONT_SUBPX_NONE)
+        goto fallback;
+    if (g.bpp != 1 && g.bpp != 2 && g.bpp != 4 && g.bpp != 8)
+        goto fallback;
+
+    lv_area_t letter_area;
+    letter_area.x1 = pos_p->x + g.ofs_x;
+    letter_area.y1 = pos_p->y + (dsc->font->line_height - dsc->font->base_line) - g.box_h - g.ofs_y;
+    letter_area.x2 = letter_area.x1 + g.box_w - 1;
+    letter_area.y2 = letter_area.y1 + g.box_h - 1;
+
+    lv_area_t clipped;
+    if (!_lv_area_intersect(&clipped, &letter_area, draw_ctx->clip_area))
+        return;
+
+    lv_color_t bg;
+    if (!area_is_uniform(draw_ctx, &clipped, &bg))
+        goto fallback;
+
+    glyph_entry_t *e = entry_find(g.resolved_font, letter, dsc->color, bg);
+    if (e)
+    {
+        cache_stats.hits++;
+        lru_unlink(e);
+        lru_push_front(e);
+    }
+    else
+    {
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+        if (bitmap == NULL)
+            goto fallback;
+        e = entry_create(g.resolved_font, letter, &g, bitmap, dsc->color, bg);
+        if (e == NULL)
+            goto fallback;
+        cache_stats.misses++;
+    }
+
+    lv_color_t *buf = draw_ctx->buf;
+    lv_coord_t stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_coord_t w = lv_area_get_width(&clipped);
+    lv_color_t *dst = buf + (clipped.y1 - draw_ctx->buf_area->y1) * stride + (clipped.x1 - draw_ctx->buf_area->x1);
+    const lv_color_t *src = e->px + (clipped.y1 - letter_area.y1) * e->w + (clipped.x1 - letter_area.x1);
+    for (lv_coord_t y = clipped.y1; y <= clipped.y2; y++, dst += stride, src += e->w)
+        memcpy(dst, src, w * sizeof(lv_color_t));
+    return;
+
+fallback:
+    cache_stats.fallbacks++;
+    sw_draw_letter(draw_ctx, dsc, pos_p, letter);
+}
+
+/**
+ * @brief Initialize the Glyph Cache
+ *
+ * @param[in] budget_bytes Maximum PSRAM used by cached tiles and their headers.
+ */
+void glyph_cache_init(uint32_t budget_bytes)
+{
+    cache_budget = budget_bytes;
+    ESP_LOGI(TAG, "Glyph cache budget %lu bytes", budget_bytes);
+}
+
+/**
+ * @brief LVGL Draw Context Initializer
+ *
+ * Initializes the software draw context and routes letter drawing through the
+ * glyph cache. Assign to `lv_disp_drv_t::draw_ctx_init`.
+ */
+void glyph_cache_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+    sw_draw_letter = draw_ctx->draw_letter;
+    draw_ctx->draw_letter = glyph_cache_draw_letter;
+}
+
+void glyph_cache_clear(void)
+{
+    while (lru_tail)
+        entry_remove(lru_tail);
+}
+
+void glyph_cache_get_stats(glyph_cache_stats_t *stats)
+{
+    *stats = cache_stats;
+}
@@ -0,0 +1,41 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PSRAM budget for pre-blended glyph tiles
+#define GLYPH_CACHE_BUDGET_BYTES (256 * 1024)
+#define GLYPH_CACHE_BUCKETS      64
+
+typedef struct {
+    uint32_t hits;      // Glyphs copied from a cached tile
+    uint32_t misses;    // Glyphs blended into a new tile
+    uint32_t evictions; // Tiles dropped to stay within the budget
+    uint32_t fallbacks; // Glyphs drawn by LVGL (non-uniform background, masks, ...)
+    uint32_t entries;   // Tiles currently cached
+    uint32_t bytes;     // Bytes currently cached
+} glyph_cache_stats_t;
+
+// Function declarations
+void glyph_cache_init(uint32_t budget_bytes);
+
+void glyph_cache_draw_ctx_init(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+
+void glyph_cache_blend(const lv_font_glyph_dsc_t *g, const uint8_t *bitmap, lv_color_t fg, lv_color_t bg,
+                       lv_color_t *dst, lv_coord_t stride);
+
+void glyph_cache_clear(void);
+
+void glyph_cache_get_stats(glyph_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLYPH_CACHE_H */
@@ -0,0 +1,63 @@
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "lvgl.h"
+#include "img_bench.h"
+#include "img_decoder.h"
+
+#define IMG_BENCH_FRAMES 10
+
+static const char *TAG = "IMG_BENCH";
+
+// LVGL mutex (from esp32_s3.c)
+extern SemaphoreHandle_t lvgl_mux;
+
+static void time_full_redraws(const char *mode, uint32_t cache_bytes)
+{
+    img_decoder_stats_t stats;
+
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    img_decoder_set_budget(cache_bytes);
+    // One frame to open every image often enough to fill the cache
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    img_decoder_reset_stats();
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < IMG_BENCH_FRAMES; i++)
+    {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    img_decoder_get_stats(&stats);
+    xSemaphoreGiveRecursive(lvgl_mux);
+
+    ESP_LOGI(TAG, "%s: decode %lluus/frame of %lldus/frame, %lu opens, %lu bands, %lu cache hits per frame",
+             mode, stats.decode_us / IMG_BENCH_FRAMES, elapsed / IMG_BENCH_FRAMES, stats.opens / IMG_BENCH_FRAMES,
+             stats.blocks / IMG_BENCH_FRAMES, stats.hits / IMG_BENCH_FRAMES);
+    if (stats.errors)
+        ESP_LOGW(TAG, "%s: %lu decode errors", mode, stats.errors);
+}
+
+/**
+ * @brief Run the Compressed Image Benchmark
+ *
+ * Times full-screen redraws of the active screen with every compressed image
+ * streamed row by row, then drawn from the decoded cache, and reports the
+ * decoding time per frame. The cache is left at IMG_DECODER_CACHE_BYTES.
+ * The flash saved by compression is reported by tools/asset_pipeline.py.
+ */
+void img_bench_run(void)
+{
+    img_decoder_stats_t stats;
+
+    time_full_redraws("Streamed", 0);
+    time_full_redraws("Cached", IMG_DECODER_CACHE_BYTES);
+
+    img_decoder_get_stats(&stats);
+    ESP_LOGI(TAG, "Decoded cache: %lu images, %lu bytes", stats.entries, stats.bytes);
+}
@@ -0,0 +1,15 @@
+#ifndef IMG_BENCH_H
+#define IMG_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Function declarations
+void img_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMG_BENCH_H */
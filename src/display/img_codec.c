@@ -0,0 +1,198 @@
+#include <string.h>
+
+#include "img_codec.h"
+
+// Plain C without ESP-IDF dependencies, so the decoders can be benchmarked on the host (tools/img_codec_bench.c)
+
+/**
+ * @brief Check a Compressed Image
+ *
+ * Validates the header and the band table against the size of the data, so
+ * decoding never reads outside of it.
+ *
+ * @param[in] data Image data, as in lv_img_dsc_t.data.
+ * @param[in] size Size of the data.
+ * @return The image header, or NULL if the data is not a valid compressed image.
+ */
+const img_codec_header_t *img_codec_open(const void *data, size_t size)
+{
+    const img_codec_header_t *img = data;
+
+    if (size < sizeof(*img) || img->magic != IMG_CODEC_MAGIC)
+        return NULL;
+    if ((img->codec != IMG_CODEC_RLE && img->codec != IMG_CODEC_LZ4) || (img->px_size != 2 && img->px_size != 3))
+        return NULL;
+    if (img->block_rows == 0 || img->w == 0 || img->h == 0)
+        return NULL;
+
+    uint16_t blocks = img_codec_blocks(img);
+    size_t table = sizeof(*img) + (blocks + 1) * sizeof(uint32_t);
+    if (size < table || img->offsets[blocks] > size - table)
+        return NULL;
+    for (uint16_t i = 0; i < blocks; i++)
+    {
+        if (img->offsets[i] > img->offsets[i + 1])
+            return NULL;
+    }
+    return img;
+}
+
+uint16_t img_codec_blocks(const img_codec_header_t *img)
+{
+    return (img->h + img->block_rows - 1) / img->block_rows;
+}
+
+// Bytes of one decoded band, the last one can be shorter
+size_t img_codec_block_size(const img_codec_header_t *img)
+{
+    return (size_t)img->block_rows * img->w * img->px_size;
+}
+
+/**
+ * @brief Decode One Band of Rows
+ *
+ * @param[in] img Header from img_codec_open.
+ * @param[in] block Band index, row / block_rows.
+ * @param[out] out img_codec_block_size bytes.
+ * @return true if the band decoded to exactly its size.
+ */
+bool img_codec_decode_block(const img_codec_header_t *img, uint16_t block, uint8_t *out)
+{
+    uint16_t blocks = img_codec_blocks(img);
+    if (block >= blocks)
+        return false;
+
+    const uint8_t *start = (const uint8_t *)&img->offsets[blocks + 1];
+    const uint8_t *src = start + img->offsets[block];
+    size_t len = img->offsets[block + 1] - img->offsets[block];
+    uint16_t rows = img->h - block * img->block_rows;
+    if (rows > img->block_rows)
+        rows = img->block_rows;
+    size_t out_len = (size_t)rows * img->w * img->px_size;
+
+    if (img->codec == IMG_CODEC_RLE)
+        return img_codec_rle_decode(src, len, out, out_len, img->px_size);
+    return img_codec_lz4_decode(src, len, out, out_len);
+}
+
+/**
+ * @brief Decode Pixel Runs
+ *
+ * A control byte c is followed either by one pixel repeated (c & 0x7f) + 1
+ * times when bit 7 is set, or by c + 1 literal pixels.
+ */
+bool img_codec_rle_decode(const uint8_t *src, size_t len, uint8_t *out, size_t out_len, uint8_t px_size)
+{
+    const uint8_t *end = src + len;
+    uint8_t *o = out;
+    uint8_t *o_end = out + out_len;
+
+    while (src < end)
+    {
+        uint8_t c = *src++;
+        size_t n = (size_t)((c & 0x7f) + 1) * px_size;
+
+        if (n > (size_t)(o_end - o))
+            return false;
+        if (c & 0x80)
+        {
+            if ((size_t)(end - src) < px_size)
+                return false;
+            if (px_size == 2)
+            {
+                uint8_t lo = src[0], hi = src[1];
+                for (uint8_t *p = o; p < o + n; p += 2)
+                {
+                    p[0] = lo;
+                    p[1] = hi;
+                }
+            }
+            else
+            {
+                for (uint8_t *p = o; p < o + n; p += px_size)
+                    memcpy(p, src, px_size);
+            }
+            src += px_size;
+        }
+        else
+        {
+            if ((size_t)(end - src) < n)
+                return false;
+            memcpy(o, src, n);
+            src += n;
+        }
+        o += n;
+    }
+    return o == o_end;
+}
+
+// LZ4 length extension: bytes are added while they are 255
+static bool lz4_length(const uint8_t **src, const uint8_t *end, size_t *len)
+{
+    uint8_t b;
+    do
+    {
+        if (*src >= end)
+            return false;
+        b = *(*src)++;
+        *len += b;
+    } while (b == 255);
+    return true;
+}
+
+/**
+ * @brief Decode an LZ4 Block
+ *
+ * Standard LZ4 block format (no frame): sequences of a token, literals and a
+ * back reference of at least 4 bytes; the last sequence has literals only.
+ */
+bool img_codec_lz4_decode(const uint8_t *src, size_t len, uint8_t *out, size_t out_len)
+{
+    const uint8_t *end = src + len;
+    uint8_t *o = out;
+    uint8_t *o_end = out + out_len;
+
+    while (src < end)
+    {
+        uint8_t token = *src++;
+
+        size_t literals = token >> 4;
+        if (literals == 15 && !lz4_length(&src, end, &literals))
+            return false;
+        if (literals > (size_t)(end - src) || literals > (size_t)(o_end - o))
+            return false;
+        memcpy(o, src, literals);
+        o += literals;
+        src += literals;
+        if (src == end)
+            break;
+
+        if (end - src < 2)
+            return false;
+        size_t offset = src[0] | src[1] << 8;
+        src += 2;
+        if (offset == 0 || offset > (size_t)(o - out))
+            return false;
+
+        size_t match = token & 0x0f;
+        if (match == 15 && !lz4_length(&src, end, &match))
+            return false;
+        match += 4;
+        if (match > (size_t)(o_end - o))
+            return false;
+
+        const uint8_t *ref = o - offset;
+        if (offset >= match)
+        {
+            memcpy(o, ref, match);
+            o += match;
+        }
+        else
+        {
+            // Overlapping copy repeats the last offset bytes
+            while (match--)
+                *o++ = *ref++;
+        }
+    }
+    return o == o_end;
+}
@@ -0,0 +1,52 @@
+#ifndef IMG_CODEC_H
+#define IMG_CODEC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Compressed image layout shared with the packer in tools/asset_pipeline.py, little endian
+#define IMG_CODEC_MAGIC 0x5a4d4948 // "HIMZ"
+
+typedef enum {
+    IMG_CODEC_RLE = 1, // Runs of whole pixels
+    IMG_CODEC_LZ4 = 2, // LZ4 block format
+} img_codec_type_t;
+
+/*
+ * The image is cut into bands of block_rows rows, each compressed on its own so
+ * any row can be reached by decoding a single band. Decoded pixels are in the
+ * LVGL line format: RGB565, or RGB565 followed by alpha.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint8_t codec;        // img_codec_type_t
+    uint8_t px_size;      // Bytes per decoded pixel, 2 or 3
+    uint16_t block_rows;
+    uint16_t w;
+    uint16_t h;
+    uint32_t offsets[];   // Start of every band after the table, then the end of the last one
+} img_codec_header_t;
+
+// Function declarations
+const img_codec_header_t *img_codec_open(const void *data, size_t size);
+
+uint16_t img_codec_blocks(const img_codec_header_t *img);
+
+size_t img_codec_block_size(const img_codec_header_t *img);
+
+bool img_codec_decode_block(const img_codec_header_t *img, uint16_t block, uint8_t *out);
+
+bool img_codec_rle_decode(const uint8_t *src, size_t len, uint8_t *out, size_t out_len, uint8_t px_size);
+
+bool img_codec_lz4_decode(const uint8_t *src, size_t len, uint8_t *out, size_t out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMG_CODEC_H */
@@ -0,0 +1,292 @@
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "img_codec.h"
+#include "img_decoder.h"
+
+static const char *TAG = "IMG_DECODER";
+
+// A compressed image seen by the decoder, keyed by its descriptor
+typedef struct {
+    const lv_img_dsc_t *src;
+    uint8_t *pixels;    // Whole decoded image in PSRAM, or NULL
+    uint32_t size;
+    uint32_t opens;
+    uint32_t last_use;
+} img_slot_t;
+
+// Rows of one open image that is not cached, decoded one band at a time
+typedef struct {
+    const img_codec_header_t *img;
+    int32_t block;      // Band held in pixels, -1 for none
+    uint8_t pixels[];
+} img_stream_t;
+
+static img_slot_t slots[IMG_DECODER_IMAGES];
+static uint32_t use_clock;
+static uint32_t budget;
+static img_decoder_stats_t stats;
+
+// Data of an image this decoder handles, or NULL
+static const img_codec_header_t *compressed(const lv_img_dsc_t *dsc)
+{
+    uint8_t px_size;
+
+    if (dsc->header.cf == LV_IMG_CF_RAW)
+        px_size = LV_COLOR_SIZE / 8;
+    else if (dsc->header.cf == LV_IMG_CF_RAW_ALPHA)
+        px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+    else
+        return NULL;
+
+    const img_codec_header_t *img = img_codec_open(dsc->data, dsc->data_size);
+    if (img == NULL || img->px_size != px_size || img->w != dsc->header.w || img->h != dsc->header.h)
+        return NULL;
+    return img;
+}
+
+static void evict(img_slot_t *slot)
+{
+    if (slot->pixels == NULL)
+        return;
+    heap_caps_free(slot->pixels);
+    stats.bytes -= slot->size;
+    stats.entries--;
+    stats.evictions++;
+    slot->pixels = NULL;
+}
+
+// Least recently drawn cached image, or NULL
+static img_slot_t *oldest_cached(void)
+{
+    img_slot_t *oldest = NULL;
+    for (int i = 0; i < IMG_DECODER_IMAGES; i++)
+    {
+        if (slots[i].pixels && (oldest == NULL || slots[i].last_use < oldest->last_use))
+            oldest = &slots[i];
+    }
+    return oldest;
+}
+
+static img_slot_t *find_slot(const lv_img_dsc_t *src)
+{
+    img_slot_t *oldest = &slots[0];
+    for (int i = 0; i < IMG_DECODER_IMAGES; i++)
+    {
+        if (slots[i].src == src)
+            return &slots[i];
+        if (slots[i].last_use < oldest->last_use)
+            oldest = &slots[i];
+    }
+
+    // Reuse the least recently drawn slot, unused ones are oldest
+    evict(oldest);
+    memset(oldest, 0, sizeof(*oldest));
+    oldest->src = src;
+    return oldest;
+}
+
+/**
+ * @brief Decode a Whole Image into the Cache
+ *
+ * Only called while opening an image: with LV_IMG_CACHE_DEF_SIZE 0 LVGL
+ * closes the previous image first, so no cached pixels are in use when
+ * older ones are evicted to make room.
+ */
+static bool fill(img_slot_t *slot, const img_codec_header_t *img)
+{
+    uint32_t size = (uint32_t)img->w * img->h * img->px_size;
+    if (size > budget)
+        return false;
+
+    while (stats.bytes + size > budget)
+        evict(oldest_cached());
+
+    uint8_t *pixels = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (pixels == NULL)
+    {
+        stats.errors++;
+        return false;
+    }
+
+    int64_t start = esp_timer_get_time();
+    size_t block_size = img_codec_block_size(img);
+    for (uint16_t b = 0; b < img_codec_blocks(img); b++)
+    {
+        if (!img_codec_decode_block(img, b, pixels + b * block_size))
+        {
+            ESP_LOGE(TAG, "Corrupt compressed image %p", slot->src);
+            heap_caps_free(pixels);
+            stats.errors++;
+            return false;
+        }
+    }
+    stats.decode_us += esp_timer_get_time() - start;
+    stats.fills++;
+
+    slot->pixels = pixels;
+    slot->size = size;
+    stats.entries++;
+    stats.bytes += size;
+    return true;
+}
+
+static lv_res_t decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    LV_UNUSED(decoder);
+
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+        return LV_RES_INV;
+
+    const lv_img_dsc_t *dsc = src;
+    if (compressed(dsc) == NULL)
+        return LV_RES_INV;
+
+    header->cf = dsc->header.cf;
+    header->always_zero = 0;
+    header->w = dsc->header.w;
+    header->h = dsc->header.h;
+    return LV_RES_OK;
+}
+
+/**
+ * @brief Open a Compressed Image
+ *
+ * A cached image is handed to LVGL as plain pixels. Otherwise, once the image
+ * has been opened IMG_DECODER_CACHE_AFTER times, it is decoded into the cache;
+ * until then, or when it does not fit, its rows are streamed by
+ * decoder_read_line.
+ *
+ * LV_IMG_CF_RAW data decodes to LV_IMG_CF_TRUE_COLOR and LV_IMG_CF_RAW_ALPHA
+ * to LV_IMG_CF_TRUE_COLOR_ALPHA, which is how LVGL draws those formats.
+ */
+static lv_res_t decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+
+    const img_codec_header_t *img = compressed(dsc->src);
+    if (img == NULL)
+        return LV_RES_INV;
+
+    stats.opens++;
+    img_slot_t *slot = find_slot(dsc->src);
+    slot->last_use = ++use_clock;
+    if (slot->pixels)
+    {
+        stats.hits++;
+        dsc->img_data = slot->pixels;
+        return LV_RES_OK;
+    }
+    if (++slot->opens >= IMG_DECODER_CACHE_AFTER && fill(slot, img))
+    {
+        dsc->img_data = slot->pixels;
+        return LV_RES_OK;
+    }
+
+    size_t size = sizeof(img_stream_t) + img_codec_block_size(img);
+    img_stream_t *stream = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (stream == NULL)
+        stream = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (stream == NULL)
+    {
+        stats.errors++;
+        return LV_RES_INV;
+    }
+    stream->img = img;
+    stream->block = -1;
+    dsc->user_data = stream;
+    return LV_RES_OK;
+}
+
+// Copy part of a row into the draw buffer, decoding its band when needed
+static lv_res_t decoder_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t *buf)
+{
+    LV_UNUSED(decoder);
+
+    img_stream_t *stream = dsc->user_data;
+    const img_codec_header_t *img = stream->img;
+    int32_t block = y / img->block_rows;
+
+    if (block != stream->block)
+    {
+        int64_t start = esp_timer_get_time();
+        bool ok = img_codec_decode_block(img, block, stream->pixels);
+        stats.decode_us += esp_timer_get_time() - start;
+        stats.blocks++;
+        if (!ok)
+        {
+            stream->block = -1;
+            stats.errors++;
+            return LV_RES_INV;
+        }
+        stream->block = block;
+    }
+
+    size_t row = (size_t)(y - block * img->block_rows) * img->w;
+    memcpy(buf, stream->pixels + (row + x) * img->px_size, (size_t)len * img->px_size);
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    LV_UNUSED(decoder);
+
+    heap_caps_free(dsc->user_data);
+    dsc->user_data = NULL;
+}
+
+/**
+ * @brief Register the Compressed Image Decoder
+ *
+ * Handles image descriptors in LV_IMG_CF_RAW / LV_IMG_CF_RAW_ALPHA whose data
+ * was compressed by tools/asset_pipeline.py; every other image still goes to
+ * the built-in decoder. Must be called after lv_init().
+ *
+ * @param[in] cache_bytes PSRAM budget for whole decoded images.
+ */
+void img_decoder_init(uint32_t cache_bytes)
+{
+    budget = cache_bytes;
+
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+
+    ESP_LOGI(TAG, "Compressed images, %lu KB decoded cache", cache_bytes / 1024);
+}
+
+/**
+ * @brief Change the Decoded Cache Budget
+ *
+ * Drops every cached image; 0 streams all images. Call with the LVGL mutex held.
+ */
+void img_decoder_set_budget(uint32_t cache_bytes)
+{
+    for (int i = 0; i < IMG_DECODER_IMAGES; i++)
+    {
+        evict(&slots[i]);
+        slots[i].opens = 0;
+    }
+    budget = cache_bytes;
+}
+
+void img_decoder_get_stats(img_decoder_stats_t *out)
+{
+    *out = stats;
+}
+
+void img_decoder_reset_stats(void)
+{
+    uint32_t entries = stats.entries;
+    uint32_t bytes = stats.bytes;
+
+    memset(&stats, 0, sizeof(stats));
+    stats.entries = entries;
+    stats.bytes = bytes;
+}
@@ -0,0 +1,42 @@
+#ifndef IMG_DECODER_H
+#define IMG_DECODER_H
+
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PSRAM budget for whole decoded images
+#define IMG_DECODER_CACHE_BYTES (512 * 1024)
+#define IMG_DECODER_CACHE_AFTER 2  // Opens of an image before it is decoded into the cache
+#define IMG_DECODER_IMAGES      16 // Compressed images tracked at once
+
+typedef struct {
+    uint32_t opens;     // Compressed images opened for drawing
+    uint32_t hits;      // Opens drawn straight from the decoded cache
+    uint32_t blocks;    // Bands decoded to stream rows
+    uint32_t fills;     // Whole images decoded into the cache
+    uint32_t evictions; // Images dropped to stay within the budget
+    uint32_t errors;    // Corrupt bands and failed allocations
+    uint64_t decode_us; // Time spent decoding bands and fills
+    uint32_t entries;   // Images currently cached
+    uint32_t bytes;     // Bytes currently cached
+} img_decoder_stats_t;
+
+// Function declarations
+void img_decoder_init(uint32_t cache_bytes);
+
+void img_decoder_set_budget(uint32_t cache_bytes);
+
+void img_decoder_get_stats(img_decoder_stats_t *stats);
+
+void img_decoder_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMG_DECODER_H */
@@ -0,0 +1,303 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_attr.h"
+#include "esp_console.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+
+#include "latency.h"
+
+#define LATENCY_BAR_WIDTH 40
+
+static const char *TAG = "LATENCY";
+
+static const char *stage_names[LATENCY_STAGES] = {
+    "touch to photon",
+    "touch to indev read",
+    "indev read to event",
+    "event to rendered",
+    "rendered to flushed",
+    "flushed to vsync",
+};
+
+// One touch is followed through the pipeline at a time; each step only
+// advances from the step before, so late or unrelated calls are ignored
+typedef enum {
+    PROBE_IDLE = 0,
+    PROBE_READ,
+    PROBE_EVENT,
+    PROBE_RENDERED,
+    PROBE_FLUSHED,
+} probe_state_t;
+
+static struct {
+    int64_t touch_us;
+    int64_t read_us;
+    int64_t event_us;
+    int64_t rendered_us;
+    int64_t flushed_us;
+    uint32_t state;
+} probe;
+
+// The VSYNC interrupt reads the 64-bit times and updates the counters while
+// the tasks write and print them, on either core: both sides hold the lock
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+static DRAM_ATTR uint32_t histogram[LATENCY_STAGES][LATENCY_BUCKETS];
+static DRAM_ATTR uint32_t max_us[LATENCY_STAGES];
+static DRAM_ATTR uint64_t total_us[LATENCY_STAGES];
+
+static uint32_t IRAM_ATTR probe_state(void)
+{
+    return __atomic_load_n(&probe.state, __ATOMIC_ACQUIRE);
+}
+
+static void IRAM_ATTR probe_advance(uint32_t state)
+{
+    __atomic_store_n(&probe.state, state, __ATOMIC_RELEASE);
+}
+
+static void IRAM_ATTR account(latency_stage_t stage, int64_t from, int64_t to)
+{
+    uint32_t us = to > from ? (uint32_t)(to - from) : 0;
+    uint32_t bucket = us / (LATENCY_BUCKET_MS * 1000);
+
+    histogram[stage][bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1]++;
+    total_us[stage] += us;
+    if (us > max_us[stage])
+        max_us[stage] = us;
+}
+
+/**
+ * @brief Mark a Touch Sample Read by LVGL
+ *
+ * Called from the indev read for every pressed sample; the newest sample not
+ * yet followed by a widget event is the one measured.
+ *
+ * @param[in] touch_us Time the sample's I2C read completed.
+ */
+void latency_input(int64_t touch_us)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&lock);
+    uint32_t state = probe_state();
+
+    // Drop a measurement whose frame never came (nothing changed on screen)
+    if (state != PROBE_IDLE && state != PROBE_READ && now - probe.touch_us > LATENCY_STALE_US)
+        state = PROBE_IDLE;
+
+    if (state == PROBE_IDLE || state == PROBE_READ)
+    {
+        probe.touch_us = touch_us;
+        probe.read_us = now;
+        probe_advance(PROBE_READ);
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Mark a Widget Event Caused by Touch
+ *
+ * Call from the event handler of the widget being measured, e.g. the
+ * VALUE_CHANGED handler of kg_slider.
+ */
+void latency_event(void)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&lock);
+    if (probe_state() == PROBE_READ)
+    {
+        probe.event_us = now;
+        probe_advance(PROBE_EVENT);
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Mark the Last Area of a Frame Rendered
+ *
+ * Call from the flush callback when lv_disp_flush_is_last is true.
+ */
+void latency_rendered(void)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&lock);
+    if (probe_state() == PROBE_EVENT)
+    {
+        probe.rendered_us = now;
+        probe_advance(PROBE_RENDERED);
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Mark the Last Area Copied into the Framebuffer
+ *
+ * Call after the panel copy. Only the flush that follows latency_rendered
+ * advances the probe.
+ */
+void latency_flushed(void)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&lock);
+    if (probe_state() == PROBE_RENDERED)
+    {
+        probe.flushed_us = now;
+        probe_advance(PROBE_FLUSHED);
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * @brief Mark a VSYNC
+ *
+ * Called from the VSYNC interrupt. The frame copied before it is scanned out
+ * from here on, which ends the measurement.
+ */
+void IRAM_ATTR latency_vsync(void)
+{
+    if (probe_state() != PROBE_FLUSHED)
+        return;
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL_ISR(&lock);
+    // A stale probe may have been restarted since the check above
+    if (probe_state() == PROBE_FLUSHED)
+    {
+        account(LATENCY_TOTAL, probe.touch_us, now);
+        account(LATENCY_TOUCH_TO_READ, probe.touch_us, probe.read_us);
+        account(LATENCY_READ_TO_EVENT, probe.read_us, probe.event_us);
+        account(LATENCY_EVENT_TO_RENDER, probe.event_us, probe.rendered_us);
+        account(LATENCY_RENDER_TO_FLUSH, probe.rendered_us, probe.flushed_us);
+        account(LATENCY_FLUSH_TO_VSYNC, probe.flushed_us, now);
+        probe_advance(PROBE_IDLE);
+    }
+    portEXIT_CRITICAL_ISR(&lock);
+}
+
+static uint32_t percentile(const uint32_t *hist, uint32_t count, uint32_t pct)
+{
+    uint32_t target = (count * pct + 99) / 100;
+    uint32_t seen = 0;
+
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        seen += hist[i];
+        if (seen >= target)
+            return (i + 1) * LATENCY_BUCKET_MS;
+    }
+    return LATENCY_BUCKETS * LATENCY_BUCKET_MS;
+}
+
+static void print_stage(latency_stage_t stage, bool bars)
+{
+    uint32_t hist[LATENCY_BUCKETS];
+    uint32_t count = 0;
+    uint32_t peak = 0;
+
+    // Snapshot, so the 64-bit total and the buckets come from the same samples
+    portENTER_CRITICAL(&lock);
+    memcpy(hist, histogram[stage], sizeof(hist));
+    uint64_t total = total_us[stage];
+    uint32_t max = max_us[stage];
+    portEXIT_CRITICAL(&lock);
+
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        count += hist[i];
+        peak = hist[i] > peak ? hist[i] : peak;
+    }
+    if (count == 0)
+        return;
+
+    printf("%-20s n=%lu avg=%llums p50<%lums p90<%lums p99<%lums max=%lums\n", stage_names[stage], count,
+           total / count / 1000, percentile(hist, count, 50), percentile(hist, count, 90),
+           percentile(hist, count, 99), max / 1000);
+
+    if (!bars)
+        return;
+
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+    {
+        if (hist[i] == 0)
+            continue;
+        char bar[LATENCY_BAR_WIDTH + 1];
+        uint32_t len = (hist[i] * LATENCY_BAR_WIDTH + peak - 1) / peak;
+        memset(bar, '#', len);
+        bar[len] = '\0';
+        printf("  %3d-%3d%sms | %-*s %lu\n", i * LATENCY_BUCKET_MS, (i + 1) * LATENCY_BUCKET_MS,
+               i == LATENCY_BUCKETS - 1 ? "+" : " ", LATENCY_BAR_WIDTH, bar, hist[i]);
+    }
+}
+
+/**
+ * @brief Print the Latency Histograms
+ *
+ * Full histogram for touch to photon, summary lines for each stage.
+ */
+void latency_print(void)
+{
+    uint32_t count = 0;
+    portENTER_CRITICAL(&lock);
+    for (int i = 0; i < LATENCY_BUCKETS; i++)
+        count += histogram[LATENCY_TOTAL][i];
+    portEXIT_CRITICAL(&lock);
+
+    if (count == 0)
+    {
+        printf("No touch-to-photon samples yet, drag kg_slider\n");
+        return;
+    }
+
+    print_stage(LATENCY_TOTAL, true);
+    for (int stage = LATENCY_TOUCH_TO_READ; stage < LATENCY_STAGES; stage++)
+        print_stage(stage, false);
+}
+
+void latency_reset(void)
+{
+    portENTER_CRITICAL(&lock);
+    probe_advance(PROBE_IDLE);
+    memset(histogram, 0, sizeof(histogram));
+    memset(max_us, 0, sizeof(max_us));
+    memset(total_us, 0, sizeof(total_us));
+    portEXIT_CRITICAL(&lock);
+}
+
+static int latency_cmd(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        latency_reset();
+        printf("Latency histograms cleared\n");
+        return 0;
+    }
+
+    latency_print();
+    return 0;
+}
+
+/**
+ * @brief Register the latency Console Command
+ *
+ * "latency" prints the histograms, "latency reset" clears them.
+ */
+void latency_register_console(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "latency",
+        .help = "Print touch-to-photon latency histograms, 'latency reset' clears them",
+        .hint = "[reset]",
+        .func = latency_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+    ESP_LOGI(TAG, "Console command 'latency' registered");
+}
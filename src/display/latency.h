@@ -0,0 +1,45 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LATENCY_BUCKET_MS  2
+#define LATENCY_BUCKETS    50      // The last bucket collects everything slower
+#define LATENCY_STALE_US   500000  // A touch whose frame never arrives is dropped after this
+
+typedef enum {
+    LATENCY_TOTAL = 0,      // I2C completion to VSYNC
+    LATENCY_TOUCH_TO_READ,  // I2C completion to LVGL indev read
+    LATENCY_READ_TO_EVENT,  // Indev read to the widget event
+    LATENCY_EVENT_TO_RENDER,// Widget event to the last area rendered
+    LATENCY_RENDER_TO_FLUSH,// Last area rendered to copied into the framebuffer
+    LATENCY_FLUSH_TO_VSYNC, // Copied to the VSYNC that starts scanning it out
+    LATENCY_STAGES,
+} latency_stage_t;
+
+// Function declarations
+void latency_input(int64_t touch_us);
+
+void latency_event(void);
+
+void latency_rendered(void);
+
+void latency_flushed(void);
+
+void latency_vsync(void);
+
+void latency_print(void);
+
+void latency_reset(void);
+
+void latency_register_console(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LATENCY_H */
@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_console.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "lvgl_heap.h"
+#include "../task/boot_mem.h"
+
+#define PSRAM_MAGIC 0x4C48504D // "MPHL"
+
+static const char *TAG = "LVGL_HEAP";
+
+// LVGL mutex (from esp32_s3.c)
+extern SemaphoreHandle_t lvgl_mux;
+
+// Header of a PSRAM allocation, the size is kept for the statistics
+typedef struct {
+    uint32_t size;      // Header included
+    uint32_t magic;
+} psram_block_t;
+
+// One call of the allocator, see dump_trace
+typedef struct {
+    uint32_t ptr;       // Block freed or reallocated
+    uint32_t new_ptr;   // Block returned
+    uint32_t size;
+    char op;            // 'a'lloc, 'f'ree, 'r'ealloc
+} trace_event_t;
+
+// In .bss, so internal SRAM
+static uint8_t sram_buf[LVGL_HEAP_SRAM_BYTES] __attribute__((aligned(MEM_POOL_ALIGN)));
+static mem_pool_t sram;
+static bool ready;
+static uint32_t sram_allocs;
+static struct {
+    uint32_t used;
+    uint32_t peak;
+    uint32_t blocks;
+    uint32_t allocs;
+} psram;
+static uint32_t spills;
+static uint32_t failed;
+
+static trace_event_t *trace;
+static uint32_t trace_len;
+static uint32_t trace_cap;
+
+static void record(char op, void *ptr, void *new_ptr, size_t size)
+{
+    if (trace_len < trace_cap)
+        trace[trace_len++] = (trace_event_t){(uint32_t)(uintptr_t)ptr, (uint32_t)(uintptr_t)new_ptr, size, op};
+}
+
+static void *psram_alloc(size_t size)
+{
+    psram_block_t *b = heap_caps_malloc(sizeof(*b) + size, MALLOC_CAP_SPIRAM);
+    if (b == NULL)
+        return NULL;
+    b->size = sizeof(*b) + size;
+    b->magic = PSRAM_MAGIC;
+
+    psram.used += b->size;
+    psram.blocks++;
+    psram.allocs++;
+    if (psram.used > psram.peak)
+        psram.peak = psram.used;
+    return b + 1;
+}
+
+static void *alloc(size_t size)
+{
+    void *ptr = NULL;
+
+    if (!ready)
+    {
+        // LVGL allocates from lv_init(), before any init function of ours could run
+        mem_pool_init(&sram, sram_buf, sizeof(sram_buf));
+        boot_mem_register("LVGL heap SRAM pool", sram_buf, sizeof(sram_buf));
+        ready = true;
+    }
+
+    if (lvgl_heap_tier_for(size) == LVGL_HEAP_SRAM)
+    {
+        ptr = mem_pool_alloc(&sram, size);
+        if (ptr)
+            sram_allocs++;
+        else
+            spills++;
+    }
+    if (ptr == NULL)
+        ptr = psram_alloc(size);
+    if (ptr == NULL)
+        failed++;
+    return ptr;
+}
+
+static void release(void *ptr)
+{
+    if (mem_pool_owns(&sram, ptr))
+    {
+        mem_pool_free(&sram, ptr);
+        return;
+    }
+
+    psram_block_t *b = (psram_block_t *)ptr - 1;
+    if (b->magic != PSRAM_MAGIC)
+    {
+        ESP_LOGE(TAG, "Freeing %p, not allocated by the LVGL heap", ptr);
+        return;
+    }
+    b->magic = 0;
+    psram.used -= b->size;
+    psram.blocks--;
+    heap_caps_free(b);
+}
+
+static size_t usable_size(const void *ptr)
+{
+    if (mem_pool_owns(&sram, ptr))
+        return mem_pool_usable_size(ptr);
+    return ((const psram_block_t *)ptr - 1)->size - sizeof(psram_block_t);
+}
+
+/**
+ * @brief Allocate for LVGL
+ *
+ * Allocations up to LVGL_HEAP_SMALL_MAX (objects, style lists, label texts)
+ * come from the internal SRAM pool, larger buffers (draw layers, image
+ * caches) from PSRAM. A small allocation goes to PSRAM when the pool is full.
+ * LVGL only allocates with the LVGL mutex held, which also guards the pool.
+ */
+void *lvgl_heap_alloc(size_t size)
+{
+    void *ptr = alloc(size);
+    record('a', NULL, ptr, size);
+    return ptr;
+}
+
+void lvgl_heap_free(void *ptr)
+{
+    if (ptr == NULL)
+        return;
+    record('f', ptr, NULL, 0);
+    release(ptr);
+}
+
+// Resized in place when the block is large enough and in the tier of the new size
+void *lvgl_heap_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL)
+        return lvgl_heap_alloc(size);
+    if (size == 0)
+    {
+        lvgl_heap_free(ptr);
+        return NULL;
+    }
+
+    size_t old = usable_size(ptr);
+    bool in_sram = mem_pool_owns(&sram, ptr);
+    if (size <= old && in_sram == (lvgl_heap_tier_for(size) == LVGL_HEAP_SRAM))
+    {
+        record('r', ptr, ptr, size);
+        return ptr;
+    }
+
+    void *moved = alloc(size);
+    record('r', ptr, moved, size);
+    if (moved == NULL)
+        return NULL; // LVGL keeps the old block
+    memcpy(moved, ptr, old < size ? old : size);
+    release(ptr);
+    return moved;
+}
+
+void lvgl_heap_get_stats(lvgl_heap_stats_t *stats)
+{
+    mem_pool_stats_t pool;
+    lvgl_heap_tier_stats_t *t;
+
+    memset(stats, 0, sizeof(*stats));
+    mem_pool_get_stats(&sram, &pool);
+    t = &stats->tier[LVGL_HEAP_SRAM];
+    t->used = pool.used;
+    t->peak = pool.peak;
+    t->blocks = pool.blocks;
+    t->allocs = sram_allocs;
+    t->free = pool.free;
+    t->largest = pool.largest_free;
+    t->frag_pct = pool.frag_pct;
+
+    // PSRAM is shared with the frame buffers and caches, its free space is the whole heap's
+    t = &stats->tier[LVGL_HEAP_PSRAM];
+    t->used = psram.used;
+    t->peak = psram.peak;
+    t->blocks = psram.blocks;
+    t->allocs = psram.allocs;
+    t->free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    t->largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    t->frag_pct = t->free ? 100 - (uint8_t)((uint64_t)t->largest * 100 / t->free) : 0;
+
+    stats->spills = spills;
+    stats->failed = failed;
+}
+
+// Bytes LVGL holds in both tiers, to measure what building a screen costs
+uint32_t lvgl_heap_used(void)
+{
+    return sram.used + psram.used;
+}
+
+static void log_stats(const char *what, const lvgl_heap_stats_t *stats)
+{
+    static const char *names[LVGL_HEAP_TIERS] = {"SRAM", "PSRAM"};
+
+    for (int i = 0; i < LVGL_HEAP_TIERS; i++)
+    {
+        const lvgl_heap_tier_stats_t *t = &stats->tier[i];
+        ESP_LOGI(TAG, "%s, %s: %lu bytes in %lu blocks (peak %lu), %lu free, largest %lu, %u%% fragmented", what,
+                 names[i], t->used, t->blocks, t->peak, t->free, t->largest, t->frag_pct);
+    }
+    if (stats->spills || stats->failed)
+        ESP_LOGW(TAG, "%s: %lu small allocations spilled to PSRAM, %lu failed", what, stats->spills, stats->failed);
+}
+
+// From the LVGL task, or with lvgl_mux held
+void lvgl_heap_log(const char *what)
+{
+    lvgl_heap_stats_t stats;
+
+    lvgl_heap_get_stats(&stats);
+    log_stats(what, &stats);
+}
+
+/**
+ * @brief Print the Recorded Allocations
+ *
+ * One line per call, in the format tools/lvgl_heap_replay.c reads back:
+ * "a <new> <size>", "f <ptr>", "r <ptr> <new> <size>", addresses in hex.
+ */
+static void dump_trace(void)
+{
+    printf("LVGL HEAP TRACE BEGIN %lu\n", trace_len);
+    for (uint32_t i = 0; i < trace_len; i++)
+    {
+        const trace_event_t *e = &trace[i];
+        if (e->op == 'a')
+            printf("a %lx %lu\n", e->new_ptr, e->size);
+        else if (e->op == 'f')
+            printf("f %lx\n", e->ptr);
+        else
+            printf("r %lx %lx %lu\n", e->ptr, e->new_ptr, e->size);
+    }
+    printf("LVGL HEAP TRACE END\n");
+}
+
+static int lvheap_cmd(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "trace") == 0)
+    {
+        // The trace buffer is not allocated from the heap it records
+        trace_event_t *buf = heap_caps_malloc(LVGL_HEAP_TRACE_MAX * sizeof(*buf), MALLOC_CAP_SPIRAM);
+        if (buf == NULL)
+        {
+            printf("No memory for the trace\n");
+            return 1;
+        }
+        xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+        heap_caps_free(trace);
+        trace = buf;
+        trace_len = 0;
+        trace_cap = LVGL_HEAP_TRACE_MAX;
+        xSemaphoreGiveRecursive(lvgl_mux);
+        printf("Recording up to %d LVGL allocations, 'lvheap dump' prints them\n", LVGL_HEAP_TRACE_MAX);
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "dump") == 0)
+    {
+        xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+        trace_cap = 0;
+        xSemaphoreGiveRecursive(lvgl_mux);
+        if (trace)
+            dump_trace();
+        heap_caps_free(trace);
+        trace = NULL;
+        trace_len = 0;
+        return 0;
+    }
+
+    // The pool's free list is only consistent between LVGL calls on the other core
+    lvgl_heap_stats_t stats;
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    lvgl_heap_get_stats(&stats);
+    xSemaphoreGiveRecursive(lvgl_mux);
+    log_stats("LVGL heap", &stats);
+    return 0;
+}
+
+/**
+ * @brief Register the lvheap Console Command
+ *
+ * "lvheap" prints the usage of each tier, "lvheap trace" starts recording
+ * the allocations and "lvheap dump" prints them for tools/lvgl_heap_replay.c.
+ */
+void lvgl_heap_register_console(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "lvheap",
+        .help = "Print the LVGL heap tiers, 'lvheap trace' records allocations, 'lvheap dump' prints them",
+        .hint = "[trace|dump]",
+        .func = lvheap_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+    ESP_LOGI(TAG, "Console command 'lvheap' registered");
+}
@@ -0,0 +1,67 @@
+#ifndef LVGL_HEAP_H
+#define LVGL_HEAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mem_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LVGL allocator (LV_MEM_CUSTOM_ALLOC in lv_conf.h), not including lvgl.h as lv_mem.h includes this header
+
+#define LVGL_HEAP_SRAM_BYTES (32 * 1024) // Internal SRAM pool for objects, styles and texts
+#define LVGL_HEAP_SMALL_MAX  512         // Largest allocation kept in SRAM, larger buffers go to PSRAM
+#define LVGL_HEAP_TRACE_MAX  8192        // Allocations recorded by "lvheap trace"
+
+typedef enum {
+    LVGL_HEAP_SRAM = 0,
+    LVGL_HEAP_PSRAM,
+    LVGL_HEAP_TIERS,
+} lvgl_heap_tier_t;
+
+typedef struct {
+    uint32_t used;      // Bytes in use, headers included
+    uint32_t peak;
+    uint32_t blocks;    // Allocations in use
+    uint32_t allocs;    // Allocations made since boot
+    uint32_t free;      // Free bytes of the tier's memory
+    uint32_t largest;   // Largest free block
+    uint8_t frag_pct;   // Free memory outside the largest free block
+} lvgl_heap_tier_stats_t;
+
+typedef struct {
+    lvgl_heap_tier_stats_t tier[LVGL_HEAP_TIERS];
+    uint32_t spills;    // Small allocations sent to PSRAM because the SRAM pool was full
+    uint32_t failed;    // Allocations no tier could serve
+} lvgl_heap_stats_t;
+
+// Tier of an allocation, the same rule on the device and in tools/lvgl_heap_replay.c
+static inline lvgl_heap_tier_t lvgl_heap_tier_for(size_t size)
+{
+    return size <= LVGL_HEAP_SMALL_MAX ? LVGL_HEAP_SRAM : LVGL_HEAP_PSRAM;
+}
+
+// Function declarations
+void *lvgl_heap_alloc(size_t size);
+
+void lvgl_heap_free(void *ptr);
+
+void *lvgl_heap_realloc(void *ptr, size_t size);
+
+void lvgl_heap_get_stats(lvgl_heap_stats_t *stats);
+
+uint32_t lvgl_heap_used(void);
+
+void lvgl_heap_log(const char *what);
+
+void lvgl_heap_register_console(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LVGL_HEAP_H */
@@ -11,8 +11,24 @@
 #define I2C_SCL          GPIO_NUM_18
 #define I2C_SDA          GPIO_NUM_17
 #define I2C_RST          GPIO_NUM_38
-#define I2C_CLK_SPEED_HZ 100000
+// GT911 INT is not routed on the MaTouch 7" board (TOUCH_GT911_INT -1 in the Makerfabs examples), only RST
+// on IO38: the touch task polls
+#define I2C_INT          GPIO_NUM_NC // GPIO of GT911 INT on a board that routes it
+#define I2C_CLK_SPEED_HZ 400000 // GT911 fast mode, drop to 100000 if the bus shows errors
 #define I2C_NUM          I2C_NUM_0
+#define I2C_QUEUE_DEPTH  4 // Queued asynchronous touch transfers, 0 for blocking ones
+
+// Touch calibration until one is stored in NVS: X and Y mirrored, Y shifted down by 150 px
+#define TOUCH_CALIB_DEFAULT { -TOUCH_CALIB_ONE, 0, LCD_H_RES * TOUCH_CALIB_ONE, \
+                              0, -TOUCH_CALIB_ONE, (LCD_V_RES + 150) * TOUCH_CALIB_ONE }
+
+// GT911 tuning, written over the factory config at boot
+#define GT911_REPORT_PERIOD_MS  10 // 5 + n ms, 10 ms = 100 Hz
+#define GT911_TOUCH_LEVEL       70
+#define GT911_LEAVE_LEVEL       45
+#define GT911_NOISE_REDUCTION   3  // 0-15
+#define GT911_COORD_FILTER      4  // 0-63, coordinate smoothing
+#define GT911_SHAKE_COUNT       2  // 0-15, reports before a new finger is reported
 
 // LCD
 #define LCD_PIXEL_CLOCK_HZ     (18 * 1000 * 1000)
@@ -52,4 +68,6 @@
 // LVGL
 #define LVGL_TASK_DELAY_MS   10
 #define LVGL_TASK_STACK_SIZE (4 * 1024)
-#define LVGL_TASK_PRIORITY   2
\ No newline at end of file
+#define LVGL_TASK_PRIORITY   2
+#define LVGL_TASK_CORE       1
+#define LVGL_FLUSH_TASK_CORE 0
\ No newline at end of file
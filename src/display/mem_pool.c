@@ -0,0 +1,244 @@
+#include <string.h>
+
+#include "mem_pool.h"
+
+// Plain C without ESP-IDF dependencies, so recorded allocation traces can be replayed on the host
+
+#define USED 0x1u
+#define NONE 0xFFFFFFFFu
+
+// Every block starts with its size and the size of the block before it in memory
+typedef struct {
+    uint32_t size;      // Block size, header included, USED when allocated
+    uint32_t prev_size; // 0 for the first block
+} block_t;
+
+// Free list links, in the payload of free blocks
+typedef struct {
+    uint32_t next;
+    uint32_t prev;
+} links_t;
+
+static inline block_t *block_at(const mem_pool_t *pool, uint32_t off)
+{
+    return (block_t *)(pool->base + off);
+}
+
+static inline links_t *links(block_t *b)
+{
+    return (links_t *)(b + 1);
+}
+
+static inline uint32_t offset_of(const mem_pool_t *pool, const block_t *b)
+{
+    return (uint32_t)((const uint8_t *)b - pool->base);
+}
+
+static inline uint32_t size_of(const block_t *b)
+{
+    return b->size & ~USED;
+}
+
+static inline block_t *next_block(block_t *b)
+{
+    return (block_t *)((uint8_t *)b + size_of(b));
+}
+
+static void list_remove(mem_pool_t *pool, block_t *b)
+{
+    links_t *l = links(b);
+
+    if (l->prev == NONE)
+        pool->free_head = l->next;
+    else
+        links(block_at(pool, l->prev))->next = l->next;
+    if (l->next != NONE)
+        links(block_at(pool, l->next))->prev = l->prev;
+}
+
+static void list_push(mem_pool_t *pool, block_t *b)
+{
+    uint32_t off = offset_of(pool, b);
+
+    links(b)->prev = NONE;
+    links(b)->next = pool->free_head;
+    if (pool->free_head != NONE)
+        links(block_at(pool, pool->free_head))->prev = off;
+    pool->free_head = off;
+}
+
+/**
+ * @brief Manage a Buffer as a Pool
+ *
+ * @param[out] pool Pool to initialise.
+ * @param[in] buf Memory of the pool, MEM_POOL_ALIGN aligned.
+ * @param[in] size Bytes of buf, rounded down to MEM_POOL_ALIGN.
+ * @return false if buf is too small for one block.
+ */
+bool mem_pool_init(mem_pool_t *pool, void *buf, size_t size)
+{
+    size &= ~(size_t)(MEM_POOL_ALIGN - 1);
+    memset(pool, 0, sizeof(*pool));
+    if (size < MEM_POOL_MIN + sizeof(block_t) || size > NONE)
+        return false;
+
+    pool->base = buf;
+    pool->size = (uint32_t)(size - sizeof(block_t));
+    pool->free_head = NONE;
+
+    block_t *first = block_at(pool, 0);
+    first->size = pool->size;
+    first->prev_size = 0;
+    list_push(pool, first);
+
+    // Allocated end marker, so merging never runs past the last block
+    block_t *end = block_at(pool, pool->size);
+    end->size = USED;
+    end->prev_size = pool->size;
+    return true;
+}
+
+void *mem_pool_alloc(mem_pool_t *pool, size_t size)
+{
+    if (size == 0 || size > pool->size)
+        return NULL;
+    uint32_t need = (uint32_t)((size + MEM_POOL_OVERHEAD + MEM_POOL_ALIGN - 1) & ~(size_t)(MEM_POOL_ALIGN - 1));
+    if (need < MEM_POOL_MIN)
+        need = MEM_POOL_MIN;
+
+    for (uint32_t off = pool->free_head; off != NONE; off = links(block_at(pool, off))->next)
+    {
+        block_t *b = block_at(pool, off);
+        uint32_t have = size_of(b);
+        if (have < need)
+            continue;
+
+        list_remove(pool, b);
+        if (have - need >= MEM_POOL_MIN)
+        {
+            // Keep the tail as a free block
+            block_t *rest = (block_t *)((uint8_t *)b + need);
+            rest->size = have - need;
+            rest->prev_size = need;
+            next_block(rest)->prev_size = rest->size;
+            list_push(pool, rest);
+            have = need;
+        }
+        b->size = have | USED;
+
+        pool->used += have;
+        pool->blocks++;
+        if (pool->used > pool->peak)
+            pool->peak = pool->used;
+        return b + 1;
+    }
+    pool->failed++;
+    return NULL;
+}
+
+void mem_pool_free(mem_pool_t *pool, void *ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    block_t *b = (block_t *)ptr - 1;
+    pool->used -= size_of(b);
+    pool->blocks--;
+    b->size &= ~USED;
+
+    block_t *next = next_block(b);
+    if (!(next->size & USED))
+    {
+        list_remove(pool, next);
+        b->size += next->size;
+    }
+    if (b->prev_size)
+    {
+        block_t *prev = (block_t *)((uint8_t *)b - b->prev_size);
+        if (!(prev->size & USED))
+        {
+            // prev stays in the free list, only grown
+            prev->size += b->size;
+            next_block(prev)->prev_size = prev->size;
+            return;
+        }
+    }
+    next_block(b)->prev_size = b->size;
+    list_push(pool, b);
+}
+
+bool mem_pool_owns(const mem_pool_t *pool, const void *ptr)
+{
+    return (const uint8_t *)ptr >= pool->base && (const uint8_t *)ptr < pool->base + pool->size;
+}
+
+// Bytes the caller may use in an allocated block, at least the size asked for
+size_t mem_pool_usable_size(const void *ptr)
+{
+    return size_of((const block_t *)ptr - 1) - MEM_POOL_OVERHEAD;
+}
+
+void mem_pool_get_stats(const mem_pool_t *pool, mem_pool_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->size = pool->size;
+    stats->used = pool->used;
+    stats->peak = pool->peak;
+    stats->blocks = pool->blocks;
+    stats->failed = pool->failed;
+
+    uint32_t largest = 0;
+    for (uint32_t off = pool->free_head; off != NONE; off = links(block_at(pool, off))->next)
+    {
+        uint32_t size = size_of(block_at(pool, off));
+        stats->free += size;
+        stats->free_blocks++;
+        if (size > largest)
+            largest = size;
+    }
+    stats->largest_free = largest ? largest - MEM_POOL_OVERHEAD : 0;
+    stats->frag_pct = stats->free ? 100 - (uint8_t)((uint64_t)largest * 100 / stats->free) : 0;
+}
+
+/**
+ * @brief Check the Pool Structure
+ *
+ * Walks every block: sizes and back links must chain up to the end marker,
+ * no two free blocks may be neighbours, and the counters must match.
+ * Meant for tests and the host replay.
+ */
+bool mem_pool_check(const mem_pool_t *pool)
+{
+    uint32_t used = 0, blocks = 0, free_count = 0, prev_size = 0;
+    bool prev_free = false;
+    uint32_t off = 0;
+
+    while (off < pool->size)
+    {
+        block_t *b = block_at(pool, off);
+        uint32_t size = size_of(b);
+        if (size < MEM_POOL_MIN || size % MEM_POOL_ALIGN || b->prev_size != prev_size)
+            return false;
+        bool is_free = !(b->size & USED);
+        if (is_free && prev_free)
+            return false;
+        if (is_free)
+        {
+            free_count++;
+        }
+        else
+        {
+            used += size;
+            blocks++;
+        }
+        prev_free = is_free;
+        prev_size = size;
+        off += size;
+    }
+    if (off != pool->size || block_at(pool, off)->prev_size != prev_size)
+        return false;
+
+    for (uint32_t f = pool->free_head; f != NONE; f = links(block_at(pool, f))->next)
+        free_count--;
+    return free_count == 0 && used == pool->used && blocks == pool->blocks;
+}
@@ -0,0 +1,58 @@
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEM_POOL_ALIGN    8
+#define MEM_POOL_OVERHEAD 8  // Header of each block
+#define MEM_POOL_MIN      16 // Smallest block, header and free list links
+
+// First fit allocator over one buffer, free blocks are merged with their neighbours
+typedef struct {
+    uint8_t *base;
+    uint32_t size;      // Bytes of blocks, the end marker excluded
+    uint32_t free_head; // Offset of the first free block
+    uint32_t used;      // Bytes of the blocks in use, headers included
+    uint32_t peak;      // Highest used
+    uint32_t blocks;    // Blocks in use
+    uint32_t failed;    // Allocations that found no free block large enough
+} mem_pool_t;
+
+typedef struct {
+    uint32_t size;
+    uint32_t used;
+    uint32_t peak;
+    uint32_t blocks;
+    uint32_t failed;
+    uint32_t free;          // Bytes of the free blocks, headers included
+    uint32_t largest_free;  // Largest allocation that would succeed
+    uint32_t free_blocks;
+    uint8_t frag_pct;       // Free memory outside the largest free block, as lv_mem_monitor()
+} mem_pool_stats_t;
+
+// Function declarations
+bool mem_pool_init(mem_pool_t *pool, void *buf, size_t size);
+
+void *mem_pool_alloc(mem_pool_t *pool, size_t size);
+
+void mem_pool_free(mem_pool_t *pool, void *ptr);
+
+bool mem_pool_owns(const mem_pool_t *pool, const void *ptr);
+
+size_t mem_pool_usable_size(const void *ptr);
+
+void mem_pool_get_stats(const mem_pool_t *pool, mem_pool_stats_t *stats);
+
+bool mem_pool_check(const mem_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEM_POOL_H */
@@ -0,0 +1,125 @@
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "parallel_render.h"
+#include "../task/boot_mem.h"
+
+#define FLUSH_TASK_STACK_SIZE (3 * 1024)
+#define FLUSH_TASK_PRIORITY   3
+
+static const char *TAG = "PARALLEL";
+
+typedef struct {
+    lv_disp_drv_t *drv;
+    lv_area_t area;
+    lv_color_t *color_map;
+} flush_job_t;
+
+static parallel_render_flush_t flush_fn;
+static QueueHandle_t flush_queue;
+static SemaphoreHandle_t flush_done;
+
+// Static, so starting parallel rendering allocates nothing
+static StaticQueue_t flush_queue_buf;
+static uint8_t flush_queue_storage[sizeof(flush_job_t)];
+static StaticSemaphore_t flush_done_buf;
+static StaticTask_t flush_task_tcb;
+static StackType_t flush_task_stack[FLUSH_TASK_STACK_SIZE];
+static volatile bool job_pending;
+static bool render_enabled;
+
+/**
+ * @brief Flush Task
+ *
+ * Runs on the core that does not render. Waits for VSYNC and copies each
+ * band into the framebuffer while LVGL renders the next band into the other
+ * half of the draw buffer.
+ *
+ * @param[in] arg Pointer to task arguments (not used).
+ */
+static void flush_task(void *arg)
+{
+    flush_job_t job;
+
+    ESP_LOGI(TAG, "Starting flush task on core %d", xPortGetCoreID());
+
+    while (1)
+    {
+        xQueueReceive(flush_queue, &job, portMAX_DELAY);
+        flush_fn(job.drv, &job.area, job.color_map);
+        job_pending = false;
+        lv_disp_flush_ready(job.drv);
+        xSemaphoreGive(flush_done);
+    }
+}
+
+/**
+ * @brief Initialize Parallel Rendering
+ *
+ * The display driver must have two draw buffers, so LVGL can render into one
+ * while the other is being flushed.
+ *
+ * @param[in] flush Function that copies an area into the framebuffer.
+ * @param[in] core_id Core the flush task is pinned to.
+ */
+void parallel_render_init(parallel_render_flush_t flush, BaseType_t core_id)
+{
+    flush_fn = flush;
+    flush_queue = xQueueCreateStatic(1, sizeof(flush_job_t), flush_queue_storage, &flush_queue_buf);
+    flush_done = xSemaphoreCreateBinaryStatic(&flush_done_buf);
+    xTaskCreateStaticPinnedToCore(flush_task, "LVGL flush", FLUSH_TASK_STACK_SIZE, NULL, FLUSH_TASK_PRIORITY,
+                                  flush_task_stack, &flush_task_tcb, core_id);
+    boot_mem_register("LVGL flush task stack", flush_task_stack, sizeof(flush_task_stack));
+    render_enabled = true;
+}
+
+/**
+ * @brief Enable or Disable Parallel Rendering
+ *
+ * Waits for an in-flight flush, so it is safe to switch between frames.
+ */
+void parallel_render_enable(bool enable)
+{
+    while (job_pending)
+        vTaskDelay(1);
+    render_enabled = enable && flush_queue != NULL;
+}
+
+bool parallel_render_is_enabled(void)
+{
+    return render_enabled;
+}
+
+/**
+ * @brief Hand a Rendered Band to the Flush Task
+ *
+ * Called from the flush callback instead of flushing synchronously.
+ * `lv_disp_flush_ready` is called by the flush task once the band is copied.
+ */
+void parallel_render_submit(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    flush_job_t job = {
+        .drv = drv,
+        .area = *area,
+        .color_map = color_map,
+    };
+
+    job_pending = true;
+    xQueueSend(flush_queue, &job, portMAX_DELAY);
+}
+
+/**
+ * @brief LVGL Wait Callback
+ *
+ * Blocks the rendering task until the flush task finishes, instead of
+ * letting LVGL spin on `draw_buf->flushing`.
+ */
+void parallel_render_wait_cb(lv_disp_drv_t *drv)
+{
+    if (render_enabled)
+        xSemaphoreTake(flush_done, pdMS_TO_TICKS(100));
+}
@@ -0,0 +1,32 @@
+#ifndef PARALLEL_RENDER_H
+#define PARALLEL_RENDER_H
+
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Copies an area into the framebuffer, without calling lv_disp_flush_ready()
+typedef void (*parallel_render_flush_t)(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+// Function declarations
+void parallel_render_init(parallel_render_flush_t flush, BaseType_t core_id);
+
+void parallel_render_enable(bool enable);
+
+bool parallel_render_is_enabled(void);
+
+void parallel_render_submit(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+void parallel_render_wait_cb(lv_disp_drv_t *drv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PARALLEL_RENDER_H */
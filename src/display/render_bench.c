@@ -0,0 +1,53 @@
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "lvgl.h"
+#include "parallel_render.h"
+#include "render_bench.h"
+
+#define RENDER_BENCH_FRAMES 10
+
+static const char *TAG = "RENDER_BENCH";
+
+// LVGL mutex (from esp32_s3.c)
+extern SemaphoreHandle_t lvgl_mux;
+
+static int64_t time_full_redraws(bool parallel)
+{
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    parallel_render_enable(parallel);
+    lv_refr_now(NULL);
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < RENDER_BENCH_FRAMES; i++)
+    {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+    // Include the last band still being flushed
+    parallel_render_enable(parallel);
+    int64_t elapsed = esp_timer_get_time() - start;
+    xSemaphoreGiveRecursive(lvgl_mux);
+
+    return elapsed;
+}
+
+/**
+ * @brief Run the Parallel Rendering Benchmark
+ *
+ * Times full-screen redraws of the active screen with rendering and flushing
+ * on one core, then pipelined across both cores. Parallel rendering is left
+ * enabled afterwards.
+ */
+void render_bench_run(void)
+{
+    int64_t single = time_full_redraws(false);
+    int64_t parallel = time_full_redraws(true);
+
+    ESP_LOGI(TAG, "Full redraw, %d frames: single core %lldus/frame, both cores %lldus/frame, speed-up x%lld.%02lld",
+             RENDER_BENCH_FRAMES, single / RENDER_BENCH_FRAMES, parallel / RENDER_BENCH_FRAMES,
+             single / parallel, (single * 100 / parallel) % 100);
+}
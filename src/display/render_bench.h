@@ -0,0 +1,15 @@
+#ifndef RENDER_BENCH_H
+#define RENDER_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Function declarations
+void render_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RENDER_BENCH_H */
@@ -0,0 +1,120 @@
+#include <math.h>
+#include <stdlib.h>
+
+#include "touch_calib.h"
+
+// Plain C without ESP-IDF dependencies, so the solver can be checked on the host.
+// Loading and saving live in touch_calib_nvs.c.
+
+static int32_t to_q16(double v)
+{
+    return (int32_t)lround(v * TOUCH_CALIB_ONE);
+}
+
+static double det3(const double m[3][3])
+{
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+           m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+           m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+/* Solve the 3x3 normal equations m * r = v with Cramer's rule */
+static bool solve3(const double m[3][3], const double v[3], double r[3])
+{
+    double det = det3(m);
+    if (fabs(det) < 1e-6)
+        return false;
+
+    for (int col = 0; col < 3; col++)
+    {
+        double mc[3][3];
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                mc[i][j] = j == col ? v[i] : m[i][j];
+        r[col] = det3(mc) / det;
+    }
+    return true;
+}
+
+/**
+ * @brief Solve a Calibration Matrix
+ *
+ * Least-squares affine fit from raw controller points to screen points. Three
+ * points give an exact fit; five also average out tapping errors. Runs once per
+ * calibration, so it may use floating point; applying the result does not.
+ *
+ * @param[in] raw Raw controller points.
+ * @param[in] screen Screen points the targets were drawn at.
+ * @param[in] count Number of points, 3 to TOUCH_CALIB_MAX_POINTS.
+ * @param[out] calib Resulting matrix.
+ * @param[out] max_err_px Largest residual of the fit in px, may be NULL.
+ * @return false if the points are degenerate (collinear or repeated).
+ */
+bool touch_calib_solve(const touch_calib_point_t *raw, const touch_calib_point_t *screen, int count,
+                       touch_calib_t *calib, int32_t *max_err_px)
+{
+    if (count < 3 || count > TOUCH_CALIB_MAX_POINTS)
+        return false;
+
+    double m[3][3] = {{0}};
+    double vx[3] = {0};
+    double vy[3] = {0};
+
+    for (int i = 0; i < count; i++)
+    {
+        double p[3] = {raw[i].x, raw[i].y, 1.0};
+        for (int j = 0; j < 3; j++)
+        {
+            for (int k = 0; k < 3; k++)
+                m[j][k] += p[j] * p[k];
+            vx[j] += p[j] * screen[i].x;
+            vy[j] += p[j] * screen[i].y;
+        }
+    }
+
+    double rx[3];
+    double ry[3];
+    if (!solve3(m, vx, rx) || !solve3(m, vy, ry))
+        return false;
+
+    calib->a = to_q16(rx[0]);
+    calib->b = to_q16(rx[1]);
+    calib->c = to_q16(rx[2]);
+    calib->d = to_q16(ry[0]);
+    calib->e = to_q16(ry[1]);
+    calib->f = to_q16(ry[2]);
+
+    if (max_err_px)
+    {
+        *max_err_px = 0;
+        for (int i = 0; i < count; i++)
+        {
+            int32_t x = raw[i].x;
+            int32_t y = raw[i].y;
+            touch_calib_apply(calib, &x, &y);
+            int32_t err = abs(x - screen[i].x) + abs(y - screen[i].y);
+            if (err > *max_err_px)
+                *max_err_px = err;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Apply a Calibration Matrix
+ *
+ * Two multiply-adds and a shift per axis, no division or floating point.
+ *
+ * @param[in] calib Calibration matrix.
+ * @param[in,out] x Raw X, replaced by the screen X.
+ * @param[in,out] y Raw Y, replaced by the screen Y.
+ */
+void touch_calib_apply(const touch_calib_t *calib, int32_t *x, int32_t *y)
+{
+    int32_t rx = *x;
+    int32_t ry = *y;
+
+    *x = (calib->a * rx + calib->b * ry + calib->c + (TOUCH_CALIB_ONE >> 1)) >> TOUCH_CALIB_SHIFT;
+    *y = (calib->d * rx + calib->e * ry + calib->f + (TOUCH_CALIB_ONE >> 1)) >> TOUCH_CALIB_SHIFT;
+}
@@ -0,0 +1,41 @@
+#ifndef TOUCH_CALIB_H
+#define TOUCH_CALIB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOUCH_CALIB_SHIFT       16
+#define TOUCH_CALIB_ONE         (1 << TOUCH_CALIB_SHIFT)
+#define TOUCH_CALIB_MAX_POINTS  5
+#define TOUCH_CALIB_MAX_ERR_PX  12 // Largest residual accepted from a calibration run
+
+// Screen = [a b c; d e f] * [raw_x raw_y 1], coefficients in Q16
+typedef struct {
+    int32_t a, b, c;
+    int32_t d, e, f;
+} touch_calib_t;
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+} touch_calib_point_t;
+
+// Function declarations
+bool touch_calib_solve(const touch_calib_point_t *raw, const touch_calib_point_t *screen, int count,
+                       touch_calib_t *calib, int32_t *max_err_px);
+
+void touch_calib_apply(const touch_calib_t *calib, int32_t *x, int32_t *y);
+
+bool touch_calib_load(touch_calib_t *calib);
+
+bool touch_calib_save(const touch_calib_t *calib);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOUCH_CALIB_H */
@@ -0,0 +1,65 @@
+#include "esp_log.h"
+#include "nvs.h"
+
+#include "touch_calib.h"
+
+#define TOUCH_CALIB_NVS_NAMESPACE "touch"
+#define TOUCH_CALIB_NVS_KEY       "calib"
+
+static const char *TAG = "TOUCH_CALIB";
+
+/**
+ * @brief Load the Stored Calibration
+ *
+ * @param[out] calib Calibration matrix, unchanged if none is stored.
+ * @return true if a calibration was loaded from NVS.
+ */
+bool touch_calib_load(touch_calib_t *calib)
+{
+    nvs_handle_t nvs;
+    touch_calib_t stored;
+    size_t len = sizeof(stored);
+
+    if (nvs_open(TOUCH_CALIB_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK)
+        return false;
+
+    esp_err_t err = nvs_get_blob(nvs, TOUCH_CALIB_NVS_KEY, &stored, &len);
+    nvs_close(nvs);
+
+    if (err != ESP_OK || len != sizeof(stored))
+        return false;
+
+    *calib = stored;
+    ESP_LOGI(TAG, "Loaded calibration [%ld %ld %ld; %ld %ld %ld]",
+             calib->a, calib->b, calib->c, calib->d, calib->e, calib->f);
+    return true;
+}
+
+/**
+ * @brief Store a Calibration
+ *
+ * @param[in] calib Calibration matrix.
+ * @return true on success.
+ */
+bool touch_calib_save(const touch_calib_t *calib)
+{
+    nvs_handle_t nvs;
+
+    esp_err_t err = nvs_open(TOUCH_CALIB_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK)
+    {
+        err = nvs_set_blob(nvs, TOUCH_CALIB_NVS_KEY, calib, sizeof(*calib));
+        if (err == ESP_OK)
+            err = nvs_commit(nvs);
+        nvs_close(nvs);
+    }
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to store calibration (%s)", esp_err_to_name(err));
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Stored calibration");
+    return true;
+}
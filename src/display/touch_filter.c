@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "touch_filter.h"
+
+// Plain C without ESP-IDF dependencies, so recorded traces can be replayed on the host
+
+#define Q4(v)      ((int32_t)(v) << 4)
+#define TAU_SCALE  159154943 // 1e9 / (2 * pi), gives tau in us from a cutoff in mHz
+
+/**
+ * @brief Smoothing Factor
+ *
+ * alpha = dt / (dt + tau) with tau = 1 / (2 * pi * cutoff), in Q16.
+ */
+static int32_t alpha_q16(uint32_t cutoff_mhz, uint32_t dt_us)
+{
+    uint32_t tau_us = TAU_SCALE / (cutoff_mhz ? cutoff_mhz : 1);
+    return (int32_t)(((uint64_t)dt_us << 16) / (dt_us + tau_us));
+}
+
+static int32_t axis_restart(touch_filter_axis_t *axis, int32_t raw)
+{
+    axis->pos = raw;
+    axis->speed = 0;
+    axis->raw[0] = axis->raw[1] = raw;
+    axis->out[0] = axis->out[1] = raw;
+    return raw;
+}
+
+static int32_t axis_update(touch_filter_t *filter, touch_filter_axis_t *axis, int32_t raw, uint32_t dt_us)
+{
+    const touch_filter_params_t *p = &filter->params;
+
+    // Speed from the last smoothed position, smoothed with a fixed cutoff
+    int32_t speed = (int32_t)(((int64_t)(raw - axis->pos) * 1000000) / dt_us);
+    axis->speed += (int32_t)(((int64_t)(speed - axis->speed) * alpha_q16(p->d_cutoff_mhz, dt_us)) >> 16);
+
+    // The faster the finger, the higher the cutoff
+    uint32_t cutoff = p->min_cutoff_mhz + p->beta_mhz * (uint32_t)(abs(axis->speed) >> 4);
+    axis->pos += (int32_t)(((int64_t)(raw - axis->pos) * alpha_q16(cutoff, dt_us)) >> 16);
+
+    // Extrapolate along the smoothed speed to hide sampling and render latency
+    int32_t lead = (int32_t)(((int64_t)axis->speed * p->predict_us) / 1000000);
+    lead = lead > Q4(p->max_lead_px) ? Q4(p->max_lead_px) : (lead < -Q4(p->max_lead_px) ? -Q4(p->max_lead_px) : lead);
+    int32_t out = axis->pos + lead;
+
+    if (filter->stroke_samples >= 2)
+    {
+        filter->stats.samples++;
+        filter->stats.raw_jitter += abs(raw - 2 * axis->raw[0] + axis->raw[1]);
+        filter->stats.out_jitter += abs(out - 2 * axis->out[0] + axis->out[1]);
+        filter->stats.filter_lag += abs(raw - axis->pos);
+        filter->stats.lead += abs(out - axis->pos);
+        filter->stats.speed += abs(axis->speed);
+    }
+
+    axis->raw[1] = axis->raw[0];
+    axis->raw[0] = raw;
+    axis->out[1] = axis->out[0];
+    axis->out[0] = out;
+
+    return out;
+}
+
+static uint16_t to_px(int32_t v)
+{
+    v = (v + 8) >> 4;
+    return v < 0 ? 0 : (v > UINT16_MAX ? UINT16_MAX : v);
+}
+
+/**
+ * @brief Initialize a Touch Filter
+ *
+ * @param[out] filter Filter state.
+ * @param[in] params Tuning, or NULL for the TOUCH_FILTER_* defaults.
+ */
+void touch_filter_init(touch_filter_t *filter, const touch_filter_params_t *params)
+{
+    memset(filter, 0, sizeof(*filter));
+
+    if (params)
+    {
+        filter->params = *params;
+    }
+    else
+    {
+        filter->params.min_cutoff_mhz = TOUCH_FILTER_MIN_CUTOFF_MHZ;
+        filter->params.beta_mhz = TOUCH_FILTER_BETA_MHZ;
+        filter->params.d_cutoff_mhz = TOUCH_FILTER_D_CUTOFF_MHZ;
+        filter->params.predict_us = TOUCH_FILTER_PREDICT_US;
+        filter->params.max_lead_px = TOUCH_FILTER_MAX_LEAD_PX;
+    }
+}
+
+/**
+ * @brief Filter One Touch Sample
+ *
+ * One-euro style adaptive low-pass filter per axis, followed by a linear
+ * prediction over params.predict_us. All state is fixed point in 1/16 px.
+ * A gap longer than TOUCH_FILTER_GAP_US starts a new stroke at the raw point.
+ *
+ * @param[in,out] filter Filter state.
+ * @param[in] time_us Sample timestamp.
+ * @param[in,out] x X coordinate, replaced by the filtered one.
+ * @param[in,out] y Y coordinate, replaced by the filtered one.
+ */
+void touch_filter_update(touch_filter_t *filter, int64_t time_us, uint16_t *x, uint16_t *y)
+{
+    int64_t dt_us = time_us - filter->last_us;
+    filter->last_us = time_us;
+
+    if (filter->stroke_samples == 0 || dt_us > TOUCH_FILTER_GAP_US || dt_us <= 0)
+    {
+        filter->stroke_samples = 1;
+        axis_restart(&filter->x, Q4(*x));
+        axis_restart(&filter->y, Q4(*y));
+        return;
+    }
+
+    *x = to_px(axis_update(filter, &filter->x, Q4(*x), (uint32_t)dt_us));
+    *y = to_px(axis_update(filter, &filter->y, Q4(*y), (uint32_t)dt_us));
+    if (filter->stroke_samples < UINT32_MAX)
+        filter->stroke_samples++;
+}
+
+/**
+ * @brief Start a New Stroke
+ *
+ * The next sample is taken as is, without smoothing towards the previous
+ * stroke. Used when another finger takes over without a gap.
+ *
+ * @param[in,out] filter Filter state.
+ */
+void touch_filter_restart(touch_filter_t *filter)
+{
+    filter->stroke_samples = 0;
+}
+
+void touch_filter_get_stats(const touch_filter_t *filter, touch_filter_stats_t *stats)
+{
+    *stats = filter->stats;
+}
+
+void touch_filter_reset_stats(touch_filter_t *filter)
+{
+    memset(&filter->stats, 0, sizeof(filter->stats));
+}
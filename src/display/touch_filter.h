@@ -0,0 +1,67 @@
+#ifndef TOUCH_FILTER_H
+#define TOUCH_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Default tuning, frequencies in mHz
+#define TOUCH_FILTER_MIN_CUTOFF_MHZ 1000  // Cutoff at rest, removes jitter
+#define TOUCH_FILTER_BETA_MHZ       8     // Cutoff increase per px/s of speed, removes lag
+#define TOUCH_FILTER_D_CUTOFF_MHZ   1000  // Cutoff of the speed estimate
+#define TOUCH_FILTER_PREDICT_US     25000 // Prediction horizon, about one report plus one frame
+#define TOUCH_FILTER_MAX_LEAD_PX    24    // Limit on the predicted lead
+#define TOUCH_FILTER_GAP_US         40000 // A longer gap between samples starts a new stroke
+
+typedef struct {
+    uint32_t min_cutoff_mhz;
+    uint32_t beta_mhz;
+    uint32_t d_cutoff_mhz;
+    uint32_t predict_us;
+    uint16_t max_lead_px;
+} touch_filter_params_t;
+
+typedef struct {
+    uint32_t samples;     // Samples accounted, both axes
+    uint64_t raw_jitter;  // Sum of |second difference| of the raw input, 1/16 px
+    uint64_t out_jitter;  // Same for the output
+    uint64_t filter_lag;  // Sum of |raw - smoothed|, 1/16 px
+    uint64_t lead;        // Sum of |output - smoothed|, the predicted lead, 1/16 px
+    uint64_t speed;       // Sum of |smoothed speed|, 1/16 px/s; lag / speed gives seconds
+} touch_filter_stats_t;
+
+typedef struct {
+    int32_t pos;      // Smoothed position, 1/16 px
+    int32_t speed;    // Smoothed speed, 1/16 px/s
+    int32_t raw[2];   // Last two raw positions, 1/16 px
+    int32_t out[2];   // Last two outputs, 1/16 px
+} touch_filter_axis_t;
+
+typedef struct {
+    touch_filter_params_t params;
+    touch_filter_axis_t x;
+    touch_filter_axis_t y;
+    int64_t last_us;
+    uint32_t stroke_samples;
+    touch_filter_stats_t stats;
+} touch_filter_t;
+
+// Function declarations
+void touch_filter_init(touch_filter_t *filter, const touch_filter_params_t *params);
+
+void touch_filter_update(touch_filter_t *filter, int64_t time_us, uint16_t *x, uint16_t *y);
+
+void touch_filter_restart(touch_filter_t *filter);
+
+void touch_filter_get_stats(const touch_filter_t *filter, touch_filter_stats_t *stats);
+
+void touch_filter_reset_stats(touch_filter_t *filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOUCH_FILTER_H */
@@ -0,0 +1,302 @@
+/* Generated by tools/asset_pipeline.py from src/fonts/lv_font_montserrat_72.c - do not edit */
+
+/*******************************************************************************
+ * Size: 72 px
+ * Bpp: 4
+ * Opts: tools/font_subset.py (fontTools, FreeType) --bpp 4 --size 72 --no-compress --font Montserrat-Bold.ttf --symbols  -0123456789ABCDEFGHIKLMNOPQRSTUVW
+ ******************************************************************************/
+
+#include "lvgl.h"
+#include "display/asset_bundle.h"
+
+#ifndef FONT_BUNDLED_MONTSERRAT_72
+#define FONT_BUNDLED_MONTSERRAT_72 1
+#endif
+
+#if FONT_BUNDLED_MONTSERRAT_72
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*The glyph bitmaps are in the asset bundle*/
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 326, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 445, .box_w = 22, .box_h = 10, .ofs_x = 3, .ofs_y = 16},
+    {.bitmap_index = 110, .adv_w = 782, .box_w = 44, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 1254, .adv_w = 452, .box_w = 23, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1829, .adv_w = 680, .box_w = 41, .box_h = 51, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2875, .adv_w = 682, .box_w = 42, .box_h = 51, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 3946, .adv_w = 794, .box_w = 47, .box_h = 50, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5121, .adv_w = 685, .box_w = 41, .box_h = 51, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6167, .adv_w = 734, .box_w = 43, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 7285, .adv_w = 714, .box_w = 42, .box_h = 50, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8335, .adv_w = 760, .box_w = 43, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 9453, .adv_w = 734, .box_w = 43, .box_h = 52, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10571, .adv_w = 882, .box_w = 57, .box_h = 50, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11996, .adv_w = 881, .box_w = 48, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 13196, .adv_w = 844, .box_w = 49, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 14470, .adv_w = 952, .box_w = 52, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 15770, .adv_w = 773, .box_w = 40, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 16770, .adv_w = 736, .box_w = 40, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 17770, .adv_w = 888, .box_w = 50, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 19070, .adv_w = 931, .box_w = 48, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 20270, .adv_w = 378, .box_w = 13, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 20595, .adv_w = 852, .box_w = 49, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 21820, .adv_w = 696, .box_w = 38, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 22770, .adv_w = 1100, .box_w = 58, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 24220, .adv_w = 931, .box_w = 48, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 25420, .adv_w = 972, .box_w = 56, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 26876, .adv_w = 843, .box_w = 45, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 28001, .adv_w = 972, .box_w = 59, .box_h = 63, .ofs_x = 2, .ofs_y = -12},
+    {.bitmap_index = 29860, .adv_w = 847, .box_w = 46, .box_h = 50, .ofs_x = 5, .ofs_y = 0},
+    {.bitmap_index = 31010, .adv_w = 735, .box_w = 42, .box_h = 52, .ofs_x = 2, .ofs_y = -1},
+    {.bitmap_index = 32102, .adv_w = 712, .box_w = 45, .box_h = 50, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 33227, .adv_w = 908, .box_w = 47, .box_h = 51, .ofs_x = 5, .ofs_y = -1},
+    {.bitmap_index = 34426, .adv_w = 859, .box_w = 56, .box_h = 50, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 35826, .adv_w = 1340, .box_w = 82, .box_h = 50, .ofs_x = 1, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0xd
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 14, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 2, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 10, .glyph_id_start = 3,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 9, .glyph_id_start = 13,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 75, .range_length = 13, .glyph_id_start = 22,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Pair left and right glyphs for kerning*/
+static const uint8_t kern_pair_glyph_ids[] =
+{
+    2, 2, 2, 3, 2, 4, 2, 5,
+    2, 6, 2, 7, 2, 9, 2, 10,
+    2, 13, 2, 15, 2, 19, 2, 26,
+    2, 28, 2, 30, 2, 31, 2, 33,
+    2, 34, 3, 2, 3, 4, 3, 5,
+    3, 6, 3, 10, 3, 13, 3, 31,
+    3, 33, 3, 34, 5, 2, 5, 7,
+    5, 13, 5, 31, 5, 33, 5, 34,
+    6, 5, 6, 6, 6, 8, 6, 10,
+    6, 31, 6, 33, 6, 34, 7, 2,
+    7, 4, 7, 6, 7, 10, 7, 11,
+    7, 12, 7, 15, 7, 19, 7, 26,
+    7, 28, 7, 30, 7, 31, 7, 33,
+    7, 34, 8, 5, 8, 6, 8, 8,
+    8, 10, 8, 31, 8, 33, 8, 34,
+    9, 2, 9, 10, 9, 13, 9, 31,
+    9, 33, 9, 34, 10, 2, 10, 3,
+    10, 4, 10, 6, 10, 7, 10, 8,
+    10, 9, 10, 11, 10, 13, 10, 15,
+    10, 19, 10, 26, 10, 28, 10, 30,
+    10, 33, 10, 34, 11, 13, 11, 31,
+    11, 33, 11, 34, 12, 2, 12, 4,
+    12, 5, 12, 6, 12, 10, 12, 13,
+    12, 31, 12, 33, 12, 34, 13, 2,
+    13, 3, 13, 4, 13, 6, 13, 7,
+    13, 9, 13, 10, 13, 11, 13, 12,
+    13, 13, 13, 15, 13, 19, 13, 26,
+    13, 28, 13, 31, 13, 32, 13, 33,
+    13, 34, 14, 31, 14, 33, 14, 34,
+    15, 2, 15, 3, 15, 4, 15, 5,
+    15, 7, 15, 8, 15, 9, 15, 11,
+    15, 12, 15, 13, 15, 15, 15, 19,
+    15, 26, 15, 28, 15, 30, 15, 31,
+    15, 32, 15, 33, 15, 34, 16, 2,
+    16, 4, 16, 5, 16, 6, 16, 13,
+    16, 31, 16, 33, 16, 34, 17, 2,
+    17, 3, 17, 5, 17, 6, 17, 7,
+    17, 8, 17, 9, 17, 10, 17, 11,
+    17, 33, 17, 34, 18, 3, 18, 4,
+    18, 5, 18, 7, 18, 8, 18, 9,
+    18, 10, 18, 11, 18, 12, 18, 13,
+    18, 15, 18, 19, 18, 26, 18, 28,
+    18, 31, 20, 33, 20, 34, 21, 33,
+    21, 34, 22, 2, 22, 3, 22, 4,
+    22, 5, 22, 6, 22, 7, 22, 9,
+    22, 11, 22, 12, 22, 13, 22, 15,
+    22, 19, 22, 26, 22, 28, 22, 30,
+    22, 31, 22, 32, 22, 33, 22, 34,
+    23, 3, 23, 4, 23, 6, 23, 7,
+    23, 9, 23, 10, 23, 11, 23, 12,
+    23, 13, 23, 15, 23, 19, 23, 26,
+    23, 28, 23, 30, 23, 31, 23, 32,
+    23, 33, 23, 34, 24, 33, 24, 34,
+    25, 33, 25, 34, 26, 2, 26, 4,
+    26, 5, 26, 6, 26, 13, 26, 31,
+    26, 33, 26, 34, 27, 2, 27, 5,
+    27, 6, 27, 7, 27, 8, 27, 11,
+    27, 13, 27, 14, 27, 16, 27, 17,
+    27, 18, 27, 20, 27, 21, 27, 22,
+    27, 23, 27, 24, 27, 25, 27, 27,
+    27, 29, 27, 31, 27, 32, 27, 33,
+    27, 34, 28, 2, 28, 4, 28, 5,
+    28, 6, 28, 13, 28, 31, 28, 33,
+    28, 34, 29, 2, 29, 6, 29, 7,
+    29, 31, 30, 2, 30, 4, 30, 6,
+    30, 7, 30, 10, 30, 12, 30, 31,
+    31, 2, 31, 3, 31, 4, 31, 5,
+    31, 6, 31, 7, 31, 8, 31, 9,
+    31, 10, 31, 11, 31, 13, 31, 15,
+    31, 19, 31, 26, 31, 28, 31, 30,
+    31, 31, 31, 32, 31, 33, 31, 34,
+    32, 13, 32, 31, 33, 2, 33, 3,
+    33, 4, 33, 6, 33, 7, 33, 8,
+    33, 9, 33, 10, 33, 11, 33, 12,
+    33, 13, 33, 14, 33, 15, 33, 16,
+    33, 17, 33, 18, 33, 19, 33, 20,
+    33, 21, 33, 22, 33, 23, 33, 24,
+    33, 25, 33, 26, 33, 27, 33, 28,
+    33, 29, 33, 30, 33, 31, 34, 2,
+    34, 3, 34, 4, 34, 6, 34, 7,
+    34, 8, 34, 9, 34, 10, 34, 11,
+    34, 12, 34, 13, 34, 14, 34, 15,
+    34, 16, 34, 17, 34, 18, 34, 19,
+    34, 20, 34, 21, 34, 22, 34, 23,
+    34, 24, 34, 25, 34, 26, 34, 27,
+    34, 28, 34, 29, 34, 30, 34, 31
+};
+
+/* Kerning between the respective left and right glyphs
+ * 4.4 format which needs to scaled with `kern_scale`*/
+static const int8_t kern_pair_values[] =
+{
+    5, 5, -24, -18, -23, 5, 5, -12,
+    -26, 5, 5, 5, 5, -16, -41, -30,
+    -30, 5, -5, -5, -12, -5, -13, -23,
+    -29, -29, -5, -12, 5, -5, -15, -15,
+    -6, -6, -12, -10, -9, -12, -12, 12,
+    -29, -8, -48, 12, -5, 12, 12, 12,
+    12, -5, -61, -65, -65, -6, -6, -6,
+    -14, -12, -9, -9, 6, -5, 5, -12,
+    -12, -12, -58, -23, 12, -8, -75, -20,
+    -23, -20, -69, -20, -20, -20, -20, -5,
+    6, 6, -6, -12, -21, -21, 5, -5,
+    -5, -12, -5, -13, -23, -29, -29, -26,
+    -13, -50, 12, -17, -13, -58, -6, -14,
+    26, -12, -12, -12, -12, -40, -17, -44,
+    -44, -12, -6, -6, -5, -22, 12, -5,
+    -16, -12, -22, -14, -12, -16, -17, -17,
+    -17, -17, -5, -8, -5, -5, -5, 5,
+    -12, -12, -15, -12, -12, -26, -26, -23,
+    -12, -5, -8, -20, -5, -12, -5, -5,
+    -12, -12, -14, 17, 5, -48, -16, -14,
+    12, -16, 9, -33, -8, -8, -8, -8,
+    6, -5, -5, -5, -5, -41, -26, 23,
+    2, -5, -51, -26, -26, -12, -36, -29,
+    -29, -29, -29, -17, -55, -12, -46, -46,
+    -20, -39, 5, -20, -20, -58, -5, -12,
+    5, -14, -14, -14, -14, -5, -75, -10,
+    -56, -56, -5, -5, -5, -5, 5, -12,
+    -12, -15, -12, -12, -26, -26, -5, -6,
+    -17, -35, -12, -9, -52, -12, -12, -12,
+    -12, -12, -12, -12, -12, -12, -12, -12,
+    -12, -33, -15, -21, -21, 5, -12, -12,
+    -15, -12, -12, -26, -26, -2, -5, -23,
+    -12, 16, -12, -5, 12, -12, -12, -12,
+    -41, -23, 46, 26, 12, -97, -9, -23,
+    23, -12, -40, -12, -12, -12, -12, -6,
+    12, -14, -15, -15, -17, -14, -30, -29,
+    35, 5, -88, -13, -29, 12, -21, -9,
+    -44, -17, -26, -17, -17, -17, -26, -17,
+    -17, -17, -17, -17, -17, -26, -17, -26,
+    -17, -17, -15, -30, -29, 35, 5, -88,
+    -13, -29, 12, -21, -9, -44, -17, -26,
+    -17, -17, -17, -26, -17, -17, -17, -17,
+    -17, -17, -26, -17, -26, -17, -17, -15
+};
+
+/*Collect the kern pair's data in one place*/
+static const lv_font_fmt_txt_kern_pair_t kern_pairs =
+{
+    .glyph_ids = kern_pair_glyph_ids,
+    .values = kern_pair_values,
+    .pair_cnt = 344,
+    .glyph_ids_size = 0
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+/*In RAM: asset_bundle_mount points glyph_bitmap into the mapped bundle*/
+static lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = NULL,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_pairs,
+    .kern_scale = 16,
+    .cmap_num = 4,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t lv_font_montserrat_72 = {
+#else
+lv_font_t lv_font_montserrat_72 = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = asset_bundle_font_bitmap,   /*Function pointer to get glyph's bitmap*/
+    .line_height = 63,          /*The maximum line height required by the font*/
+    .base_line = 12,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -7,
+    .underline_thickness = 4,
+#endif
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
+
+
+
+#endif /*#if FONT_BUNDLED_MONTSERRAT_72*/
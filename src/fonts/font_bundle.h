@@ -0,0 +1,13 @@
+/* Generated by tools/asset_pipeline.py from src/assets.json - do not edit */
+
+#ifndef FONT_BUNDLE_H
+#define FONT_BUNDLE_H
+
+/* Subsets whose glyph bitmaps are in the asset bundle, compiled from src/fonts/bundled/ instead */
+#define FONT_SUBSET_MONTSERRAT_72 0
+
+/* Font, glyph bitmap bytes and CRC-32 the bundle must hold for it */
+#define FONT_BUNDLE_FONTS \
+    FONT_BUNDLE_FONT(lv_font_montserrat_72, 37876, 0x2597371d) \
+
+#endif /* FONT_BUNDLE_H */
@@ -0,0 +1,12 @@
+/* Generated by tools/font_subset.py from the UI sources - do not edit */
+
+#ifndef FONT_SUBSETS_H
+#define FONT_SUBSETS_H
+
+/* Built-in sizes replaced by the subsets in this directory */
+#define LV_FONT_MONTSERRAT_72 0
+
+#define FONT_SUBSETS_DECLARE \
+    LV_FONT_DECLARE(lv_font_montserrat_72) \
+
+#endif /* FONT_SUBSETS_H */
@@ -0,0 +1,154 @@
+#include "esp_log.h"
+
+#include "calib_screen.h"
+#include "layout.h"
+#include "../display/esp32_s3.h"
+#include "../task/touch_task.h"
+#include "../layouts/styles.h"
+
+#define CALIB_TARGET_SIZE 40
+
+static const char *TAG = "CALIB";
+
+static const lv_point_t target_pos_pct[5] = {
+    {CALIB_SCREEN_INSET, CALIB_SCREEN_INSET},
+    {100 - CALIB_SCREEN_INSET, CALIB_SCREEN_INSET},
+    {100 - CALIB_SCREEN_INSET, 100 - CALIB_SCREEN_INSET},
+    {CALIB_SCREEN_INSET, 100 - CALIB_SCREEN_INSET},
+    {50, 50},
+};
+
+static struct {
+    lv_obj_t *screen;
+    lv_obj_t *prev_screen;
+    lv_obj_t *target;
+    lv_obj_t *hint;
+    touch_calib_point_t raw[CALIB_SCREEN_POINTS];
+    touch_calib_point_t screen_pt[CALIB_SCREEN_POINTS];
+    int32_t sum_x;
+    int32_t sum_y;
+    uint32_t samples;
+    uint8_t index;
+} calib;
+
+static void show_target(void)
+{
+    lv_coord_t w = lv_obj_get_width(calib.screen);
+    lv_coord_t h = lv_obj_get_height(calib.screen);
+
+    calib.screen_pt[calib.index].x = w * target_pos_pct[calib.index].x / 100;
+    calib.screen_pt[calib.index].y = h * target_pos_pct[calib.index].y / 100;
+    lv_obj_set_pos(calib.target, calib.screen_pt[calib.index].x - CALIB_TARGET_SIZE / 2,
+                   calib.screen_pt[calib.index].y - CALIB_TARGET_SIZE / 2);
+    lv_label_set_text_fmt(calib.hint, "Tap the centre of the cross (%d/%d)", calib.index + 1, CALIB_SCREEN_POINTS);
+}
+
+static void finish(void)
+{
+    touch_calib_t result;
+    int32_t max_err = 0;
+
+    set_touch_raw(false);
+
+    if (touch_calib_solve(calib.raw, calib.screen_pt, CALIB_SCREEN_POINTS, &result, &max_err) &&
+        max_err <= TOUCH_CALIB_MAX_ERR_PX)
+    {
+        ESP_LOGI(TAG, "Calibrated, largest error %ldpx", max_err);
+        set_touch_calibration(&result);
+        touch_calib_save(&result);
+    }
+    else
+    {
+        ESP_LOGW(TAG, "Calibration rejected (largest error %ldpx), keeping the previous one", max_err);
+    }
+
+    lv_scr_load_anim(calib.prev_screen, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+    calib.screen = NULL;
+}
+
+static void calib_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_PRESSING)
+    {
+        // Average the raw points of one tap, from the touch task rather than the clamped LVGL pointer
+        touch_point_t p;
+        if (touch_task_get_points(&p, 1) == 0)
+            return;
+        calib.sum_x += p.x;
+        calib.sum_y += p.y;
+        calib.samples++;
+        return;
+    }
+
+    // LV_EVENT_RELEASED
+    if (calib.samples == 0)
+        return;
+
+    calib.raw[calib.index].x = calib.sum_x / (int32_t)calib.samples;
+    calib.raw[calib.index].y = calib.sum_y / (int32_t)calib.samples;
+    ESP_LOGI(TAG, "Point %d: raw (%ld, %ld) for screen (%ld, %ld)", calib.index,
+             calib.raw[calib.index].x, calib.raw[calib.index].y,
+             calib.screen_pt[calib.index].x, calib.screen_pt[calib.index].y);
+    calib.sum_x = calib.sum_y = 0;
+    calib.samples = 0;
+
+    if (++calib.index == CALIB_SCREEN_POINTS)
+    {
+        finish();
+        return;
+    }
+    show_target();
+}
+
+/**
+ * @brief Start Touch Calibration
+ *
+ * Shows a full screen with one cross at a time and records where the raw touch
+ * lands on it, without the filter, prediction, calibration or clamping to the
+ * panel the LVGL pointer goes through. The fitted matrix is applied and stored in NVS if it is
+ * consistent, then the previous screen comes back. Call with the LVGL mutex
+ * held.
+ */
+void calib_screen_start(void)
+{
+    if (calib.screen)
+        return;
+
+    // Samples as the controller reports them, unfiltered and unclamped
+    set_touch_raw(true);
+
+    calib.prev_screen = lv_scr_act();
+    calib.index = 0;
+    calib.sum_x = calib.sum_y = 0;
+    calib.samples = 0;
+
+    calib.screen = lv_obj_create(NULL);
+    layout_add_style(calib.screen, STYLE_SCREEN);
+    lv_obj_clear_flag(calib.screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(calib.screen, calib_event_cb, LV_EVENT_PRESSING, NULL);
+    lv_obj_add_event_cb(calib.screen, calib_event_cb, LV_EVENT_RELEASED, NULL);
+
+    calib.hint = lv_label_create(calib.screen);
+    layout_add_style(calib.hint, STYLE_CAPTION);
+    lv_obj_align(calib.hint, LV_ALIGN_CENTER, 0, -80);
+
+    // Cross made of two bars, not clickable so the screen gets the press
+    calib.target = lv_obj_create(calib.screen);
+    lv_obj_remove_style_all(calib.target);
+    lv_obj_set_size(calib.target, CALIB_TARGET_SIZE, CALIB_TARGET_SIZE);
+    lv_obj_clear_flag(calib.target, LV_OBJ_FLAG_CLICKABLE);
+    for (int i = 0; i < 2; i++)
+    {
+        lv_obj_t *bar = lv_obj_create(calib.target);
+        lv_obj_remove_style_all(bar);
+        layout_add_style(bar, STYLE_CALIB_BAR);
+        lv_obj_set_size(bar, i ? 2 : CALIB_TARGET_SIZE, i ? CALIB_TARGET_SIZE : 2);
+        lv_obj_center(bar);
+        lv_obj_clear_flag(bar, LV_OBJ_FLAG_CLICKABLE);
+    }
+
+    lv_obj_update_layout(calib.screen);
+    show_target();
+    lv_scr_load(calib.screen);
+    ESP_LOGI(TAG, "Touch calibration started");
+}
@@ -0,0 +1,20 @@
+#ifndef CALIB_SCREEN_H
+#define CALIB_SCREEN_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CALIB_SCREEN_POINTS 5  // 3 for an exact fit, 5 to average out tapping errors
+#define CALIB_SCREEN_INSET  10 // Target inset from the screen edges, in % of the size
+
+// Function declarations
+void calib_screen_start(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CALIB_SCREEN_H */
@@ -0,0 +1,301 @@
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+#include "digit_roll.h"
+#include "refr_period.h"
+#include "../display/glyph_cache.h"
+
+#define DIGIT_ROLL_CELLS 11 // '0'..'9' and a blank cell for leading zeros
+#define DIGIT_ROLL_BLANK 10
+
+static const char *TAG = "DIGIT_ROLL";
+
+typedef struct {
+    lv_obj_t obj;
+    lv_color_t *strip;  // Pre-rendered cells stacked vertically, cell_w * cell_h * DIGIT_ROLL_CELLS
+    lv_coord_t cell_w;
+    lv_coord_t cell_h;
+    uint8_t digits;
+    uint8_t from[DIGIT_ROLL_MAX_DIGITS]; // Cell shown in each column at progress 0
+    uint8_t to[DIGIT_ROLL_MAX_DIGITS];   // Cell shown in each column at progress 256
+    uint16_t progress;
+    bool rolling;
+    uint32_t value;
+    digit_roll_stats_t stats;
+} digit_roll_t;
+
+static void digit_roll_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void digit_roll_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t digit_roll_class = {
+    .destructor_cb = digit_roll_destructor,
+    .event_cb = digit_roll_event,
+    .instance_size = sizeof(digit_roll_t),
+    .base_class = &lv_obj_class,
+};
+
+static void column_area(const digit_roll_t *roll, uint8_t col, lv_area_t *area)
+{
+    area->x1 = roll->obj.coords.x1 + col * roll->cell_w;
+    area->x2 = area->x1 + roll->cell_w - 1;
+    area->y1 = roll->obj.coords.y1;
+    area->y2 = area->y1 + roll->cell_h - 1;
+}
+
+static void value_to_cells(uint32_t value, uint8_t digits, uint8_t *cells)
+{
+    for (int i = digits - 1; i >= 0; i--)
+    {
+        bool leading = value == 0 && i != digits - 1;
+        cells[i] = leading ? DIGIT_ROLL_BLANK : value % 10;
+        value /= 10;
+    }
+}
+
+static void roll_finish(digit_roll_t *roll)
+{
+    memcpy(roll->from, roll->to, sizeof(roll->from));
+    roll->progress = 0;
+    roll->rolling = false;
+    refr_period_release(&roll->obj);
+}
+
+static void anim_progress_cb(void *var, int32_t v)
+{
+    digit_roll_t *roll = var;
+    roll->progress = v;
+
+    // Only the columns that change are redrawn
+    for (uint8_t i = 0; i < roll->digits; i++)
+    {
+        if (roll->from[i] == roll->to[i])
+            continue;
+        lv_area_t area;
+        column_area(roll, i, &area);
+        lv_obj_invalidate_area(&roll->obj, &area);
+    }
+}
+
+static void anim_ready_cb(lv_anim_t *a)
+{
+    digit_roll_t *roll = a->var;
+    roll_finish(roll);
+
+    uint32_t avg = roll->stats.frames ? roll->stats.total_us / roll->stats.frames : 0;
+    ESP_LOGI(TAG, "Rolled to %lu: %lu frames, avg %luus, max %luus per frame",
+             roll->value, roll->stats.frames, avg, roll->stats.max_us);
+}
+
+/**
+ * @brief Render the Digit Strip
+ *
+ * Blends '0'..'9' once onto the background, one cell per digit, so that a
+ * rolling column is drawn with plain row copies.
+ */
+static bool render_strip(digit_roll_t *roll, const lv_font_t *font, lv_color_t fg, lv_color_t bg)
+{
+    lv_font_glyph_dsc_t g[10];
+    lv_coord_t base = font->line_height - font->base_line;
+    lv_coord_t top = 0;
+    lv_coord_t bottom = base; // Not line_height, which spans the descenders of the font's letters
+
+    roll->cell_w = 0;
+    for (int d = 0; d < 10; d++)
+    {
+        if (!lv_font_get_glyph_dsc(font, &g[d], '0' + d, '\0') || g[d].resolved_font == NULL)
+            return false;
+        // Wide enough for the advance and for the ink, which may stick out of it
+        roll->cell_w = LV_MAX(roll->cell_w, LV_MAX(g[d].adv_w, LV_MAX(g[d].box_w, g[d].ofs_x + g[d].box_w)));
+        top = LV_MIN(top, base - g[d].box_h - g[d].ofs_y);
+        bottom = LV_MAX(bottom, base - g[d].ofs_y);
+    }
+    roll->cell_h = bottom - top;
+
+    uint32_t cell_px = (uint32_t)roll->cell_w * roll->cell_h;
+    roll->strip = heap_caps_malloc(cell_px * DIGIT_ROLL_CELLS * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    if (roll->strip == NULL)
+        return false;
+
+    for (uint32_t i = 0; i < cell_px * DIGIT_ROLL_CELLS; i++)
+        roll->strip[i] = bg;
+
+    for (int d = 0; d < 10; d++)
+    {
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(g[d].resolved_font, '0' + d);
+        if (bitmap == NULL)
+            continue;
+        lv_coord_t x = LV_CLAMP(0, (roll->cell_w - g[d].adv_w) / 2 + g[d].ofs_x, roll->cell_w - g[d].box_w);
+        lv_coord_t y = base - g[d].box_h - g[d].ofs_y - top;
+        glyph_cache_blend(&g[d], bitmap, fg, bg, roll->strip + d * cell_px + y * roll->cell_w + x, roll->cell_w);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Blit the Visible Columns
+ *
+ * Each row of a column comes either from the outgoing cell, shifted up by the
+ * animation progress, or from the incoming cell right below it.
+ */
+static void draw_columns(digit_roll_t *roll, lv_draw_ctx_t *draw_ctx)
+{
+    lv_color_t *buf = draw_ctx->buf;
+    lv_coord_t stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_coord_t shift = (roll->progress * roll->cell_h) >> 8;
+    uint32_t cell_px = (uint32_t)roll->cell_w * roll->cell_h;
+
+    for (uint8_t i = 0; i < roll->digits; i++)
+    {
+        lv_area_t col;
+        lv_area_t clipped;
+        column_area(roll, i, &col);
+        if (!_lv_area_intersect(&clipped, &col, draw_ctx->clip_area))
+            continue;
+
+        lv_coord_t w = lv_area_get_width(&clipped);
+        lv_coord_t col_x = clipped.x1 - col.x1;
+        lv_color_t *dst = buf + (clipped.y1 - draw_ctx->buf_area->y1) * stride + (clipped.x1 - draw_ctx->buf_area->x1);
+        lv_coord_t row_shift = roll->from[i] == roll->to[i] ? 0 : shift;
+
+        for (lv_coord_t y = clipped.y1; y <= clipped.y2; y++, dst += stride)
+        {
+            lv_coord_t pos = y - col.y1 + row_shift;
+            uint8_t cell = pos < roll->cell_h ? roll->from[i] : roll->to[i];
+            lv_coord_t row = pos < roll->cell_h ? pos : pos - roll->cell_h;
+            memcpy(dst, roll->strip + cell * cell_px + row * roll->cell_w + col_x, w * sizeof(lv_color_t));
+        }
+    }
+}
+
+static void digit_roll_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    digit_roll_t *roll = (digit_roll_t *)obj;
+
+    if (lv_anim_del(obj, anim_progress_cb))
+        roll_finish(roll);
+    heap_caps_free(roll->strip);
+    roll->strip = NULL;
+}
+
+static void digit_roll_event(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    if (lv_obj_event_base(&digit_roll_class, e) != LV_RES_OK)
+        return;
+
+    if (lv_event_get_code(e) != LV_EVENT_DRAW_MAIN)
+        return;
+
+    digit_roll_t *roll = (digit_roll_t *)lv_event_get_target(e);
+    if (roll->strip == NULL)
+        return;
+
+    int64_t start = esp_timer_get_time();
+    draw_columns(roll, lv_event_get_draw_ctx(e));
+    if (roll->rolling)
+    {
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+        roll->stats.frames++;
+        roll->stats.total_us += elapsed;
+        roll->stats.max_us = LV_MAX(roll->stats.max_us, elapsed);
+    }
+}
+
+/**
+ * @brief Create a Rolling Digit Counter
+ *
+ * Digits are right-aligned, leading zeros are blank. The background must be
+ * the solid colour the widget sits on, since the cells are drawn opaque.
+ *
+ * @param[in] parent Parent object.
+ * @param[in] font Font used for the digits.
+ * @param[in] fg Digit colour.
+ * @param[in] bg Background colour.
+ * @param[in] digits Number of digit columns (1 to DIGIT_ROLL_MAX_DIGITS).
+ * @return The new object.
+ */
+lv_obj_t *digit_roll_create(lv_obj_t *parent, const lv_font_t *font, lv_color_t fg, lv_color_t bg, uint8_t digits)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(&digit_roll_class, parent);
+    lv_obj_class_init_obj(obj);
+
+    digit_roll_t *roll = (digit_roll_t *)obj;
+    roll->digits = LV_CLAMP(1, digits, DIGIT_ROLL_MAX_DIGITS);
+    value_to_cells(0, roll->digits, roll->from);
+    memcpy(roll->to, roll->from, sizeof(roll->to));
+
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    if (!render_strip(roll, font, fg, bg))
+    {
+        ESP_LOGE(TAG, "Failed to render digit strip");
+        return obj;
+    }
+    lv_obj_set_size(obj, roll->cell_w * roll->digits, roll->cell_h);
+
+    return obj;
+}
+
+/**
+ * @brief Set the Displayed Value
+ *
+ * With animation, only the columns whose digit changes roll to the new digit,
+ * and the display refreshes every DIGIT_ROLL_FRAME_MS until the roll ends.
+ *
+ * @param[in] obj Digit roll object.
+ * @param[in] value New value, truncated to the number of columns.
+ * @param[in] anim LV_ANIM_ON to roll, LV_ANIM_OFF to jump.
+ */
+void digit_roll_set_value(lv_obj_t *obj, uint32_t value, lv_anim_enable_t anim)
+{
+    digit_roll_t *roll = (digit_roll_t *)obj;
+    uint8_t cells[DIGIT_ROLL_MAX_DIGITS];
+
+    // Jump to the end of a roll that is still running
+    if (lv_anim_del(obj, anim_progress_cb))
+    {
+        roll_finish(roll);
+        lv_obj_invalidate(obj);
+    }
+
+    roll->value = value;
+    value_to_cells(value, roll->digits, cells);
+    if (memcmp(cells, roll->from, roll->digits) == 0)
+        return;
+
+    memcpy(roll->to, cells, roll->digits);
+    if (anim == LV_ANIM_OFF)
+    {
+        roll_finish(roll);
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    memset(&roll->stats, 0, sizeof(roll->stats));
+    roll->rolling = true;
+    refr_period_hold(obj, DIGIT_ROLL_FRAME_MS);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, roll);
+    lv_anim_set_exec_cb(&a, anim_progress_cb);
+    lv_anim_set_ready_cb(&a, anim_ready_cb);
+    lv_anim_set_values(&a, 0, 256);
+    lv_anim_set_time(&a, DIGIT_ROLL_ANIM_MS);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_start(&a);
+}
+
+uint32_t digit_roll_get_value(lv_obj_t *obj)
+{
+    return ((digit_roll_t *)obj)->value;
+}
+
+void digit_roll_get_stats(lv_obj_t *obj, digit_roll_stats_t *stats)
+{
+    *stats = ((digit_roll_t *)obj)->stats;
+}
@@ -0,0 +1,37 @@
+#ifndef DIGIT_ROLL_H
+#define DIGIT_ROLL_H
+
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DIGIT_ROLL_MAX_DIGITS 4
+#define DIGIT_ROLL_ANIM_MS    300
+#define DIGIT_ROLL_FRAME_MS   16 // Display refresh period while rolling (~60 fps with the 1 ms FreeRTOS tick)
+
+typedef struct {
+    uint32_t frames;   // Frames drawn while rolling
+    uint32_t total_us; // Time spent blitting those frames
+    uint32_t max_us;   // Slowest frame
+} digit_roll_stats_t;
+
+extern const lv_obj_class_t digit_roll_class;
+
+// Function declarations
+lv_obj_t *digit_roll_create(lv_obj_t *parent, const lv_font_t *font, lv_color_t fg, lv_color_t bg, uint8_t digits);
+
+void digit_roll_set_value(lv_obj_t *obj, uint32_t value, lv_anim_enable_t anim);
+
+uint32_t digit_roll_get_value(lv_obj_t *obj);
+
+void digit_roll_get_stats(lv_obj_t *obj, digit_roll_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIGIT_ROLL_H */
@@ -0,0 +1,69 @@
+#include <string.h>
+
+#include "history.h"
+
+// Plain C without ESP-IDF dependencies, so the ring indexing can be checked on the host
+
+static history_entry_t *entries;
+static uint32_t cap;
+static uint32_t head;   // Slot of the oldest entry
+static uint32_t count;
+
+/**
+ * @brief Start an Empty History
+ *
+ * The caller owns the buffer, which can be large: PSRAM keeps a day of reps.
+ *
+ * @param[in] buf Ring of entries.
+ * @param[in] capacity Number of entries in buf.
+ */
+void history_init(history_entry_t *buf, uint32_t capacity)
+{
+    entries = buf;
+    cap = capacity;
+    head = 0;
+    count = 0;
+}
+
+// Appended as the newest entry, over the oldest one when the ring is full
+void history_add(const history_entry_t *entry)
+{
+    if (cap == 0)
+        return;
+    if (count < cap)
+    {
+        entries[(head + count++) % cap] = *entry;
+        return;
+    }
+    entries[head] = *entry;
+    head = (head + 1) % cap;
+}
+
+uint32_t history_count(void)
+{
+    return count;
+}
+
+/**
+ * @brief Copy Entries Out of the History
+ *
+ * Entries are numbered from the oldest, in at most two copies across the
+ * end of the ring.
+ *
+ * @param[in] first Index of the first entry.
+ * @param[in] n Number of entries wanted.
+ * @param[out] out At least n entries.
+ * @return Number of entries copied, fewer past the newest.
+ */
+uint32_t history_read(uint32_t first, uint32_t n, history_entry_t *out)
+{
+    if (first >= count)
+        return 0;
+    n = n < count - first ? n : count - first;
+
+    uint32_t slot = (head + first) % cap;
+    uint32_t part = n < cap - slot ? n : cap - slot;
+    memcpy(out, &entries[slot], part * sizeof(*out));
+    memcpy(out + part, entries, (n - part) * sizeof(*out));
+    return n;
+}
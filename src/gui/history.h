@@ -0,0 +1,34 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HISTORY_ENTRIES 8192 // Reps kept, the oldest are dropped past it
+
+// One rep as reported by the Arduino
+typedef struct {
+    uint32_t time_s;   // Seconds since boot
+    int16_t kg;        // Set weight in CNS mode, reported effort in ADP mode
+    uint8_t reps;      // Reps of the set so far
+    uint8_t exercise;  // Index into the exercise names
+    uint8_t mode;      // view_mode_t
+} history_entry_t;
+
+// Function declarations
+void history_init(history_entry_t *buf, uint32_t capacity);
+
+void history_add(const history_entry_t *entry);
+
+uint32_t history_count(void);
+
+uint32_t history_read(uint32_t first, uint32_t n, history_entry_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HISTORY_H */
@@ -0,0 +1,110 @@
+#include "esp_log.h"
+
+#include "history_screen.h"
+#include "history.h"
+#include "layout.h"
+#include "main_view.h"
+#include "view_model.h"
+#include "vlist.h"
+#include "../layouts/styles.h"
+
+#define HISTORY_HEADER_H 90
+
+static const char *TAG = "HISTORY";
+
+// Rows of the history the list last fetched, the list binds from here
+static struct {
+    lv_obj_t *list;
+    history_entry_t window[VLIST_FETCH_ROWS];
+    uint32_t first;
+    uint32_t count;
+} view;
+
+static uint32_t source_count(void *user_data)
+{
+    return history_count();
+}
+
+static void source_fetch(uint32_t first, uint32_t count, void *user_data)
+{
+    view.first = first;
+    view.count = history_read(first, count < VLIST_FETCH_ROWS ? count : VLIST_FETCH_ROWS, view.window);
+}
+
+static lv_obj_t *source_create_row(lv_obj_t *parent, void *user_data)
+{
+    lv_obj_t *row = lv_label_create(parent);
+    layout_add_style(row, STYLE_CAPTION);
+    return row;
+}
+
+static void source_bind(lv_obj_t *row, uint32_t index, void *user_data)
+{
+    history_entry_t e;
+
+    if (index >= view.first && index - view.first < view.count)
+        e = view.window[index - view.first];
+    else if (history_read(index, 1, &e) == 0)
+        return;
+
+    lv_label_set_text_fmt(row, "%2lu:%02lu:%02lu   %s   %s %d KG   %d REPS", e.time_s / 3600, e.time_s / 60 % 60,
+                          e.time_s % 60, main_view_exercise_name(e.exercise), e.mode == VIEW_MODE_ADP ? "ADP" : "CNS",
+                          e.kg, e.reps);
+}
+
+static const vlist_source_t source = {
+    .count = source_count,
+    .fetch = source_fetch,
+    .create_row = source_create_row,
+    .bind = source_bind,
+};
+
+// A new rep was logged, rows are appended and a list at its end follows them
+static void show_reps(const view_model_t *vm, void *user_data)
+{
+    vlist_refresh(user_data);
+}
+
+/**
+ * @brief Create the History Screen
+ *
+ * Lists every rep logged since boot, oldest first, in a virtualised list:
+ * only the rows in view are objects, whatever the length of the history.
+ * Call with the LVGL mutex held.
+ *
+ * @param[in] back_cb Called when the title is tapped, to leave the screen.
+ * @return The screen object.
+ */
+lv_obj_t *history_screen_create(lv_event_cb_t back_cb)
+{
+    lv_coord_t w = lv_disp_get_hor_res(NULL);
+    lv_coord_t h = lv_disp_get_ver_res(NULL);
+
+    lv_obj_t *screen = lv_obj_create(NULL);
+    layout_add_style(screen, STYLE_SCREEN);
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE); // The list scrolls itself
+
+    lv_obj_t *title = lv_label_create(screen);
+    layout_add_style(title, STYLE_CAPTION);
+    lv_label_set_text(title, "HISTORY");
+    lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 30);
+    lv_obj_add_flag(title, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(title, back_cb, LV_EVENT_CLICKED, NULL);
+
+    view.list = vlist_create(screen, w - 80, h - HISTORY_HEADER_H, HISTORY_SCREEN_ROW_H, &source);
+    lv_obj_set_pos(view.list, 40, HISTORY_HEADER_H);
+    return screen;
+}
+
+// Opens on the latest reps, following those logged while shown
+void history_screen_show(lv_obj_t *screen)
+{
+    if (!view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_REPS), show_reps, view.list))
+        ESP_LOGE(TAG, "Out of view-model bindings, raise VIEW_MODEL_BINDINGS");
+    vlist_scroll_to(view.list, history_count());
+}
+
+void history_screen_hide(lv_obj_t *screen)
+{
+    view_model_unbind(show_reps, view.list);
+}
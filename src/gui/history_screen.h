@@ -0,0 +1,23 @@
+#ifndef HISTORY_SCREEN_H
+#define HISTORY_SCREEN_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HISTORY_SCREEN_ROW_H 48 // Row height, fits the caption font
+
+// Function declarations
+lv_obj_t *history_screen_create(lv_event_cb_t back_cb);
+
+void history_screen_show(lv_obj_t *screen);
+
+void history_screen_hide(lv_obj_t *screen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HISTORY_SCREEN_H */
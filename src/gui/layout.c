@@ -0,0 +1,129 @@
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "layout.h"
+#include "digit_roll.h"
+#include "../display/asset_bundle.h"
+#include "../display/lvgl_heap.h"
+
+static const char *TAG = "LAYOUT";
+
+// Tables for the resolution of the default display, the first ones if there are none
+static const layout_variant_t *find_variant(const layout_screen_t *screen)
+{
+    lv_coord_t hor_res = lv_disp_get_hor_res(NULL);
+    lv_coord_t ver_res = lv_disp_get_ver_res(NULL);
+
+    for (uint8_t i = 0; i < screen->variant_count; i++)
+    {
+        if (screen->variants[i].hor_res == hor_res && screen->variants[i].ver_res == ver_res)
+            return &screen->variants[i];
+    }
+    ESP_LOGW(TAG, "No %dx%d layout of screen \"%s\", using %dx%d", hor_res, ver_res, screen->name,
+             screen->variants[0].hor_res, screen->variants[0].ver_res);
+    return &screen->variants[0];
+}
+
+/**
+ * @brief Add a Registry Style to an Object
+ *
+ * The style is const and shared: LVGL only keeps a pointer to it, so adding
+ * it costs one style slot of the object and no copy of its properties.
+ *
+ * @param[in] obj Object to style.
+ * @param[in] id STYLE_<NAME> of src/layouts/styles.h.
+ */
+void layout_add_style(lv_obj_t *obj, uint8_t id)
+{
+    const layout_style_set_t *set = &layout_styles[id];
+
+    // LVGL never writes to a style created with LV_STYLE_CONST_INIT
+    for (uint8_t i = 0; i < set->count; i++)
+        lv_obj_add_style(obj, (lv_style_t *)set->parts[i].style, set->parts[i].selector);
+}
+
+static void add_styles(lv_obj_t *obj, uint32_t styles)
+{
+    for (uint8_t id = 0; styles; id++, styles >>= 1)
+    {
+        if (styles & 1)
+            layout_add_style(obj, id);
+    }
+}
+
+static lv_obj_t *create_obj(lv_obj_t *parent, const layout_obj_t *o)
+{
+    lv_obj_t *obj;
+
+    switch (o->type)
+    {
+    case LAYOUT_LABEL:
+        obj = lv_label_create(parent);
+        lv_label_set_text_static(obj, o->text); // The text stays in flash until the label is changed
+        break;
+    case LAYOUT_IMG:
+        obj = lv_img_create(parent);
+        lv_img_set_src(obj, asset_bundle_img(o->text));
+        break;
+    case LAYOUT_SWITCH:
+        obj = lv_switch_create(parent);
+        break;
+    case LAYOUT_ARC:
+        obj = lv_arc_create(parent);
+        lv_arc_set_range(obj, o->min, o->max);
+        lv_arc_set_value(obj, o->value);
+        lv_arc_set_bg_angles(obj, o->start_angle, o->end_angle);
+        if (o->flags & LAYOUT_NO_KNOB)
+            lv_obj_remove_style(obj, NULL, LV_PART_KNOB);
+        break;
+    case LAYOUT_DIGIT_ROLL:
+        obj = digit_roll_create(parent, o->font, lv_color_hex(o->color), lv_color_hex(o->bg_color), o->value);
+        break;
+    default:
+        ESP_LOGE(TAG, "Unknown object type %d", o->type);
+        obj = lv_obj_create(parent);
+        break;
+    }
+
+    add_styles(obj, o->styles);
+    if (o->w)
+        lv_obj_set_size(obj, o->w, o->h);
+    if (o->align == LV_ALIGN_DEFAULT)
+        lv_obj_set_pos(obj, o->x, o->y);
+    else
+        lv_obj_align(obj, o->align, o->x, o->y);
+    if (o->flags & LAYOUT_CLICKABLE)
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    if (o->flags & LAYOUT_HIDDEN)
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    return obj;
+}
+
+/**
+ * @brief Create a Screen from its Layout
+ *
+ * Builds every object of the layout for the resolution of the default
+ * display. Styles come from the const registry and are shared by all objects
+ * using them instead of being set per object, and positions were computed by the layout compiler, except for
+ * objects sized by their content which are aligned by LVGL.
+ *
+ * @param[in] screen Layout from src/layouts/<name>_layout.h.
+ * @param[out] objs Created objects, indexed by the layout's enum, obj_count entries.
+ * @return The new screen, not loaded.
+ */
+lv_obj_t *layout_create(const layout_screen_t *screen, lv_obj_t **objs)
+{
+    int64_t start = esp_timer_get_time();
+    uint32_t heap = lvgl_heap_used();
+    const layout_variant_t *variant = find_variant(screen);
+
+    lv_obj_t *scr = lv_obj_create(NULL);
+    add_styles(scr, screen->styles);
+    for (uint8_t i = 0; i < screen->obj_count; i++)
+        objs[i] = create_obj(scr, &variant->objs[i]);
+
+    ESP_LOGI(TAG, "Screen \"%s\" %dx%d: %u objects in %lldus, %d bytes of heap", screen->name, variant->hor_res,
+             variant->ver_res, screen->obj_count, esp_timer_get_time() - start,
+             (int)(lvgl_heap_used() - heap));
+    return scr;
+}
@@ -0,0 +1,86 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tables generated by tools/layout_compiler.py from src/layouts/*.json
+
+typedef enum {
+    LAYOUT_LABEL,
+    LAYOUT_IMG,
+    LAYOUT_SWITCH,
+    LAYOUT_ARC,
+    LAYOUT_DIGIT_ROLL,
+} layout_type_t;
+
+#define LAYOUT_HIDDEN    0x01
+#define LAYOUT_CLICKABLE 0x02
+#define LAYOUT_NO_KNOB   0x04 // Arc drawn as an indicator, without the theme's knob
+
+// A shared style and the parts and states it applies to
+typedef struct {
+    const lv_style_t *style;      // LV_STYLE_CONST_INIT, stays in flash
+    lv_style_selector_t selector;
+} layout_style_t;
+
+// Style of the registry (src/layouts/styles.h), one entry per part and state
+typedef struct {
+    const layout_style_t *parts;
+    uint8_t count;
+} layout_style_set_t;
+
+extern const layout_style_set_t layout_styles[];
+
+#define LAYOUT_STYLE(id) (1UL << (id)) // Bit of a registry style in layout_obj_t.styles
+
+typedef struct {
+    uint8_t type;                 // layout_type_t
+    uint8_t flags;                // LAYOUT_HIDDEN, LAYOUT_CLICKABLE, LAYOUT_NO_KNOB
+    uint8_t align;                // LV_ALIGN_DEFAULT when x, y are absolute, else aligned on the screen
+    uint32_t styles;              // LAYOUT_STYLE() bits of the registry styles
+    lv_coord_t x;
+    lv_coord_t y;
+    lv_coord_t w;                 // 0 keeps the size the widget is created with
+    lv_coord_t h;
+    const char *text;             // Label text, or image name in the asset bundle
+    const lv_font_t *font;        // Digit roll font
+    uint32_t color;               // Digit roll colours, 0xRRGGBB
+    uint32_t bg_color;
+    int16_t min;                  // Arc range
+    int16_t max;
+    int16_t value;                // Arc value, digit roll digits
+    uint16_t start_angle;         // Arc background angles
+    uint16_t end_angle;
+} layout_obj_t;
+
+// Objects of a screen for one display resolution
+typedef struct {
+    lv_coord_t hor_res;
+    lv_coord_t ver_res;
+    const layout_obj_t *objs;
+} layout_variant_t;
+
+typedef struct {
+    const char *name;
+    uint32_t styles;              // Styles of the screen object
+    uint8_t obj_count;
+    uint8_t variant_count;
+    const layout_variant_t *variants;
+} layout_screen_t;
+
+// Function declarations
+void layout_add_style(lv_obj_t *obj, uint8_t id);
+
+lv_obj_t *layout_create(const layout_screen_t *screen, lv_obj_t **objs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LAYOUT_H */
@@ -0,0 +1,207 @@
+#include <stdio.h>
+
+#include "esp_console.h"
+#include "esp_log.h"
+
+#include "main_view.h"
+#include "view_model.h"
+#include "digit_roll.h"
+#include "../layouts/main_layout.h"
+
+static const char *TAG = "MAIN_VIEW";
+
+static const char *const exercises[MAIN_VIEW_EXERCISES] = {"DEADLIFT", "SQUAT", "BENCH PRESS", "ROW"};
+
+// What the labels show, to skip formatting and redrawing an unchanged text
+static struct {
+    int16_t kg;
+    int16_t exercise;
+} shown;
+
+// Only touch the flag when it changes, adding or clearing it invalidates the object
+static void set_hidden(lv_obj_t *obj, bool hidden)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden)
+        return;
+    if (hidden)
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else
+        lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void show_mode_switch(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *mode_switch = user_data;
+    bool adp = vm->mode == VIEW_MODE_ADP;
+
+    if (lv_obj_has_state(mode_switch, LV_STATE_CHECKED) == adp)
+        return;
+    if (adp)
+        lv_obj_add_state(mode_switch, LV_STATE_CHECKED);
+    else
+        lv_obj_clear_state(mode_switch, LV_STATE_CHECKED);
+}
+
+// The set weight in CNS mode, the reported effort in ADP mode
+static void show_kg_value(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *kg_value_label = user_data;
+    int16_t kg = vm->mode == VIEW_MODE_ADP ? vm->effort : vm->weight;
+
+    if (kg == shown.kg)
+        return;
+    shown.kg = kg;
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%d", kg);
+    lv_label_set_text(kg_value_label, buf);
+}
+
+static void show_kg_slider(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *kg_slider = user_data;
+
+    set_hidden(kg_slider, vm->mode == VIEW_MODE_ADP);
+    lv_arc_set_value(kg_slider, vm->weight); // No-op when the arc already has the value
+}
+
+static void show_weight_bar(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *weight_bar = user_data;
+
+    set_hidden(weight_bar, vm->mode == VIEW_MODE_CNS);
+    lv_arc_set_value(weight_bar, vm->effort);
+}
+
+static void show_name(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *name_label = user_data;
+
+    set_hidden(name_label, vm->mode == VIEW_MODE_ADP);
+    if (vm->exercise == shown.exercise)
+        return;
+    shown.exercise = vm->exercise;
+    lv_label_set_text_static(name_label, exercises[vm->exercise]);
+}
+
+static void show_adp_name(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *adp_name_label = user_data;
+
+    set_hidden(adp_name_label, vm->mode == VIEW_MODE_CNS);
+}
+
+static void show_reps(const view_model_t *vm, void *user_data)
+{
+    lv_obj_t *rep_value_roll = user_data;
+
+    digit_roll_set_value(rep_value_roll, vm->reps, LV_ANIM_ON);
+}
+
+static void log_link(const view_model_t *vm, void *user_data)
+{
+    LV_UNUSED(user_data);
+
+    if (vm->link == VIEW_LINK_UP)
+        ESP_LOGI(TAG, "Arduino link up");
+    else if (vm->link == VIEW_LINK_DOWN)
+        ESP_LOGW(TAG, "Arduino link sends malformed data");
+}
+
+// Observer of one widget of the layout
+typedef struct {
+    uint32_t fields;
+    view_model_cb_t cb;
+    uint8_t ui; // Index of the widget in the layout objects
+} main_bind_t;
+
+static const main_bind_t binds[] = {
+    {VIEW_FIELD_BIT(VIEW_FIELD_MODE), show_mode_switch, MAIN_MODE_SWITCH},
+    {VIEW_FIELD_BIT(VIEW_FIELD_MODE) | VIEW_FIELD_BIT(VIEW_FIELD_WEIGHT) | VIEW_FIELD_BIT(VIEW_FIELD_EFFORT),
+     show_kg_value, MAIN_KG_VALUE_LABEL},
+    {VIEW_FIELD_BIT(VIEW_FIELD_MODE) | VIEW_FIELD_BIT(VIEW_FIELD_WEIGHT), show_kg_slider, MAIN_KG_SLIDER},
+    {VIEW_FIELD_BIT(VIEW_FIELD_MODE) | VIEW_FIELD_BIT(VIEW_FIELD_EFFORT), show_weight_bar, MAIN_WEIGHT_BAR},
+    {VIEW_FIELD_BIT(VIEW_FIELD_MODE) | VIEW_FIELD_BIT(VIEW_FIELD_EXERCISE), show_name, MAIN_NAME_LABEL},
+    {VIEW_FIELD_BIT(VIEW_FIELD_MODE), show_adp_name, MAIN_ADP_NAME_LABEL},
+    {VIEW_FIELD_BIT(VIEW_FIELD_REPS), show_reps, MAIN_REP_VALUE_ROLL},
+};
+
+#define MAIN_BINDS (sizeof(binds) / sizeof(binds[0]))
+
+// Widgets bound, kept to unbind them
+static lv_obj_t *bound[MAIN_BINDS];
+
+/**
+ * @brief Start the Observers Outside the Screen
+ *
+ * The link state is logged whichever screen is shown, so it is bound once
+ * for good rather than with the main screen. Call after view_model_init().
+ */
+void main_view_init(void)
+{
+    if (!view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_LINK), log_link, NULL))
+        ESP_LOGE(TAG, "Out of view-model bindings, raise VIEW_MODEL_BINDINGS");
+}
+
+/**
+ * @brief Bind the Main Screen to the View-Model
+ *
+ * Each widget is bound to the fields it shows and is only updated when one
+ * of them changes. Call with the LVGL mutex held, after view_model_init().
+ *
+ * @param[in] ui Objects of the screen from layout_create(&main_layout, ui).
+ */
+void main_view_bind(lv_obj_t **ui)
+{
+    // Every label is formatted once from the model, whatever text the layout gave it
+    shown.kg = -1;
+    shown.exercise = -1;
+    for (size_t i = 0; i < MAIN_BINDS; i++)
+    {
+        bound[i] = ui[binds[i].ui];
+        if (!view_model_bind(binds[i].fields, binds[i].cb, bound[i]))
+            ESP_LOGE(TAG, "Out of view-model bindings, raise VIEW_MODEL_BINDINGS");
+    }
+}
+
+// The screen keeps its widgets but stops following the model, until bound again
+void main_view_unbind(void)
+{
+    for (size_t i = 0; i < MAIN_BINDS; i++)
+        view_model_unbind(binds[i].cb, bound[i]);
+}
+
+const char *main_view_exercise_name(uint8_t exercise)
+{
+    return exercises[exercise % MAIN_VIEW_EXERCISES];
+}
+
+static int view_cmd(int argc, char **argv)
+{
+    const view_model_t *vm = view_model_get();
+    view_model_stats_t stats;
+
+    view_model_get_stats(&stats);
+    printf("Mode %s, weight %d kg, effort %d kg, %d reps, %s, link %s\n",
+           vm->mode == VIEW_MODE_ADP ? "ADP" : "CNS", vm->weight, vm->effort, vm->reps,
+           main_view_exercise_name(vm->exercise),
+           vm->link == VIEW_LINK_UP ? "up" : vm->link == VIEW_LINK_DOWN ? "down" : "unknown");
+    printf("%lu writes, %lu unchanged, %lu widget updates\n", stats.sets, stats.unchanged, stats.notified);
+    return 0;
+}
+
+/**
+ * @brief Register the view Console Command
+ *
+ * "view" prints the view-model and how many writes changed nothing.
+ */
+void main_view_register_console(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "view",
+        .help = "Print the view-model of the main screen and its update counters",
+        .hint = NULL,
+        .func = view_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+    ESP_LOGI(TAG, "Console command 'view' registered");
+}
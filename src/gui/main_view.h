@@ -0,0 +1,29 @@
+#ifndef MAIN_VIEW_H
+#define MAIN_VIEW_H
+
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAIN_VIEW_EXERCISES 4
+
+// Function declarations
+void main_view_init(void);
+
+void main_view_bind(lv_obj_t **ui);
+
+void main_view_unbind(void);
+
+const char *main_view_exercise_name(uint8_t exercise);
+
+void main_view_register_console(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_VIEW_H */
@@ -0,0 +1,92 @@
+#include <stdbool.h>
+
+#include "esp_log.h"
+
+#include "refr_period.h"
+
+static const char *TAG = "REFR_PERIOD";
+
+typedef struct {
+    lv_obj_t *obj;
+    uint32_t period;
+} refr_hold_t;
+
+// The board has a single display, every hold applies to the default one
+static refr_hold_t holds[REFR_PERIOD_HOLDERS];
+static bool saved;
+static uint32_t saved_period; // Period found before the first hold, restored after the last release
+
+// Run the display at the shortest period held, or back at the saved one
+static void apply(void)
+{
+    lv_timer_t *refr_timer = _lv_disp_get_refr_timer(lv_disp_get_default());
+    uint32_t period = UINT32_MAX;
+
+    for (int i = 0; i < REFR_PERIOD_HOLDERS; i++)
+    {
+        if (holds[i].obj)
+            period = LV_MIN(period, holds[i].period);
+    }
+    if (period == UINT32_MAX)
+    {
+        period = saved_period;
+        saved = false;
+    }
+    if (refr_timer)
+        lv_timer_set_period(refr_timer, period);
+}
+
+/**
+ * @brief Refresh the Display Faster While an Object Animates
+ *
+ * Digit rolls, list scrolls and the like each hold the period they need;
+ * the display runs at the shortest one held, and returns to the period it
+ * had before the first hold once every holder has released. Holding again
+ * only updates the period. Call with the LVGL mutex held.
+ *
+ * @param[in] obj Object animating, identifies the hold.
+ * @param[in] period Display refresh period it needs, in ms.
+ */
+void refr_period_hold(lv_obj_t *obj, uint32_t period)
+{
+    refr_hold_t *free_slot = NULL;
+
+    for (int i = 0; i < REFR_PERIOD_HOLDERS; i++)
+    {
+        if (holds[i].obj == obj)
+        {
+            holds[i].period = period;
+            apply();
+            return;
+        }
+        if (holds[i].obj == NULL && free_slot == NULL)
+            free_slot = &holds[i];
+    }
+    if (free_slot == NULL)
+    {
+        ESP_LOGW(TAG, "No room to hold the refresh period, raise REFR_PERIOD_HOLDERS");
+        return;
+    }
+
+    if (!saved)
+    {
+        lv_timer_t *refr_timer = _lv_disp_get_refr_timer(lv_disp_get_default());
+        saved = true;
+        saved_period = refr_timer ? refr_timer->period : LV_DISP_DEF_REFR_PERIOD;
+    }
+    *free_slot = (refr_hold_t){obj, period};
+    apply();
+}
+
+// Drop the hold of obj, if any
+void refr_period_release(lv_obj_t *obj)
+{
+    for (int i = 0; i < REFR_PERIOD_HOLDERS; i++)
+    {
+        if (holds[i].obj != obj)
+            continue;
+        holds[i].obj = NULL;
+        apply();
+        return;
+    }
+}
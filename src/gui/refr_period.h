@@ -0,0 +1,21 @@
+#ifndef REFR_PERIOD_H
+#define REFR_PERIOD_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define REFR_PERIOD_HOLDERS 8 // Objects that may ask for a faster refresh at the same time
+
+// Function declarations
+void refr_period_hold(lv_obj_t *obj, uint32_t period);
+
+void refr_period_release(lv_obj_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFR_PERIOD_H */
@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_console.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "screen_mgr.h"
+#include "../display/lvgl_heap.h"
+
+static const char *TAG = "SCREEN_MGR";
+
+typedef struct {
+    lv_obj_t *obj;       // NULL until created, again once evicted
+    uint32_t cost;       // LVGL heap the last creation took, 0 before the first
+    uint32_t last_shown; // lv_tick_get() when last shown, for the LRU eviction
+    uint32_t created;
+    uint32_t hits;
+} screen_state_t;
+
+static const screen_def_t *defs;
+static uint8_t def_count;
+static screen_state_t screens[SCREEN_MGR_MAX];
+static uint8_t active = SCREEN_MGR_NONE;
+static screen_mgr_stats_t stats;
+
+// LVGL heap a screen counts against the budget when not shown, pinned ones stay whatever the budget
+static uint32_t charge(uint8_t id)
+{
+    return (defs[id].flags & SCREEN_PINNED) ? 0 : screens[id].cost;
+}
+
+static bool create(uint8_t id)
+{
+    screen_state_t *s = &screens[id];
+    uint32_t heap = lvgl_heap_used();
+    int64_t start = esp_timer_get_time();
+
+    s->obj = defs[id].create();
+    if (s->obj == NULL)
+    {
+        ESP_LOGE(TAG, "Creating %s failed", defs[id].name);
+        return false;
+    }
+    s->cost = lvgl_heap_used() - heap;
+    s->created++;
+    stats.created++;
+    ESP_LOGI(TAG, "Created %s in %lld ms, %lu bytes", defs[id].name, (esp_timer_get_time() - start) / 1000, s->cost);
+    return true;
+}
+
+static void destroy(uint8_t id)
+{
+    screen_state_t *s = &screens[id];
+
+    // Deleted after the event being handled, which may come from the screen itself
+    lv_obj_del_async(s->obj);
+    s->obj = NULL;
+    stats.cached -= charge(id);
+    stats.evicted++;
+    ESP_LOGI(TAG, "Deleted %s, %lu bytes freed", defs[id].name, s->cost);
+}
+
+// Delete least recently shown screens until the cached ones fit in limit, keeping the shown one and keep
+static void evict(uint32_t limit, uint8_t keep)
+{
+    while (stats.cached > limit)
+    {
+        uint8_t lru = SCREEN_MGR_NONE;
+        for (uint8_t i = 0; i < def_count; i++)
+        {
+            if (screens[i].obj == NULL || i == active || i == keep || (defs[i].flags & SCREEN_PINNED))
+                continue;
+            if (lru == SCREEN_MGR_NONE || screens[i].last_shown < screens[lru].last_shown)
+                lru = i;
+        }
+        if (lru == SCREEN_MGR_NONE)
+            return; // Only screens that must stay
+        destroy(lru);
+    }
+}
+
+// Build the screen likely shown next while LVGL has nothing to draw
+static void preload_timer_cb(lv_timer_t *timer)
+{
+    LV_UNUSED(timer);
+
+    if (active == SCREEN_MGR_NONE || defs[active].next == SCREEN_MGR_NONE)
+        return;
+    if (screens[defs[active].next].obj || lv_timer_get_idle() < SCREEN_MGR_PRELOAD_IDLE || lv_anim_count_running())
+        return;
+    if (screen_mgr_preload(defs[active].next))
+        stats.preloaded++;
+}
+
+/**
+ * @brief Initialize the Screen Manager
+ *
+ * Screens are only built when first shown or preloaded, and the one shown
+ * now names the one likely to come next, which is built in an idle frame
+ * so showing it costs nothing. Screens not shown stay cached for a quick
+ * return while the LVGL heap they hold fits in SCREEN_MGR_BUDGET; past it,
+ * the least recently shown are deleted. Call with the LVGL mutex held.
+ *
+ * @param[in] table Screens, indexed by their id. Must stay valid.
+ * @param[in] count Number of screens, at most SCREEN_MGR_MAX.
+ */
+void screen_mgr_init(const screen_def_t *table, uint8_t count)
+{
+    defs = table;
+    def_count = count < SCREEN_MGR_MAX ? count : SCREEN_MGR_MAX;
+    memset(screens, 0, sizeof(screens));
+    memset(&stats, 0, sizeof(stats));
+    active = SCREEN_MGR_NONE;
+    lv_timer_create(preload_timer_cb, SCREEN_MGR_PRELOAD_PERIOD, NULL);
+}
+
+/**
+ * @brief Show a Screen
+ *
+ * Builds the screen unless it is cached, binds it and loads it. The screen
+ * shown before is unbound, then deleted if it is SCREEN_DISCARD, else
+ * cached within the budget. Call with the LVGL mutex held.
+ *
+ * @param[in] id Index of the screen in the table.
+ * @return false when the screen could not be built.
+ */
+bool screen_mgr_show(uint8_t id)
+{
+    if (id >= def_count)
+        return false;
+    if (id == active)
+        return true;
+
+    screen_state_t *s = &screens[id];
+    if (s->obj)
+    {
+        s->hits++;
+        stats.hits++;
+        stats.cached -= charge(id);
+    }
+    else if (!create(id))
+        return false;
+
+    // Bound before the first frame, so the widgets already show the data
+    if (defs[id].show)
+        defs[id].show(s->obj);
+    lv_scr_load(s->obj);
+    s->last_shown = lv_tick_get();
+
+    uint8_t prev = active;
+    active = id;
+    if (prev != SCREEN_MGR_NONE)
+    {
+        if (defs[prev].hide)
+            defs[prev].hide(screens[prev].obj);
+        stats.cached += charge(prev);
+        if (defs[prev].flags & SCREEN_DISCARD)
+            destroy(prev);
+    }
+    evict(SCREEN_MGR_BUDGET, defs[id].next);
+    return true;
+}
+
+uint8_t screen_mgr_active(void)
+{
+    return active;
+}
+
+// Object of the screen, NULL unless it is built
+lv_obj_t *screen_mgr_get(uint8_t id)
+{
+    return id < def_count ? screens[id].obj : NULL;
+}
+
+/**
+ * @brief Build a Screen Ahead of Showing It
+ *
+ * Makes room in the budget for what the screen took the last time it was
+ * built. It is not bound until shown. Call with the LVGL mutex held.
+ *
+ * @param[in] id Index of the screen in the table.
+ * @return true when the screen was built now.
+ */
+bool screen_mgr_preload(uint8_t id)
+{
+    if (id >= def_count || screens[id].obj)
+        return false;
+
+    uint32_t cost = charge(id);
+    evict(cost < SCREEN_MGR_BUDGET ? SCREEN_MGR_BUDGET - cost : 0, id);
+    if (stats.cached + cost > SCREEN_MGR_BUDGET || !create(id))
+        return false;
+    stats.cached += charge(id);
+    return true;
+}
+
+void screen_mgr_get_stats(screen_mgr_stats_t *out)
+{
+    *out = stats;
+}
+
+static int screens_cmd(int argc, char **argv)
+{
+    for (uint8_t i = 0; i < def_count; i++)
+    {
+        const screen_state_t *s = &screens[i];
+        printf("%-10s %-6s %6lu bytes, built %lu times, %lu hits\n", defs[i].name,
+               i == active ? "shown" : s->obj ? "cached" : "-", s->cost, s->created, s->hits);
+    }
+    printf("%lu of %d bytes cached, %lu built (%lu preloaded), %lu hits, %lu deleted\n", stats.cached,
+           SCREEN_MGR_BUDGET, stats.created, stats.preloaded, stats.hits, stats.evicted);
+    return 0;
+}
+
+/**
+ * @brief Register the screens Console Command
+ *
+ * "screens" lists which screens are built, what they cost and how often
+ * they were shown from the cache.
+ */
+void screen_mgr_register_console(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "screens",
+        .help = "List the screens, their LVGL heap cost and the cache counters",
+        .hint = NULL,
+        .func = screens_cmd,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+    ESP_LOGI(TAG, "Console command 'screens' registered");
+}
@@ -0,0 +1,59 @@
+#ifndef SCREEN_MGR_H
+#define SCREEN_MGR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCREEN_MGR_MAX            8           // Screens in the table
+#define SCREEN_MGR_BUDGET         (24 * 1024) // LVGL heap cached screens may hold while not shown
+#define SCREEN_MGR_PRELOAD_PERIOD 100         // ms between checks for an idle frame to preload in
+#define SCREEN_MGR_PRELOAD_IDLE   60          // LVGL idle % above which the next screen is built
+
+#define SCREEN_MGR_NONE 0xFF
+
+#define SCREEN_DISCARD 0x01 // Deleted as soon as another screen is shown (splash)
+#define SCREEN_PINNED  0x02 // Never evicted once created, outside the budget
+
+typedef struct {
+    const char *name;
+    uint8_t flags;                        // SCREEN_DISCARD, SCREEN_PINNED
+    uint8_t next;                         // Screen likely shown after this one, or SCREEN_MGR_NONE
+    lv_obj_t *(*create)(void);            // Builds the screen and its event callbacks
+    void (*show)(lv_obj_t *screen);       // Binds the data sources, before the screen is loaded; may be NULL
+    void (*hide)(lv_obj_t *screen);       // Unbinds them, after another screen is loaded; may be NULL
+} screen_def_t;
+
+typedef struct {
+    uint32_t created;   // Screens built, on demand or preloaded
+    uint32_t preloaded; // Built in an idle frame
+    uint32_t hits;      // Shown without being built first
+    uint32_t evicted;   // Deleted to stay in the budget, or discarded
+    uint32_t cached;    // LVGL heap held by the screens not shown, pinned ones excluded
+} screen_mgr_stats_t;
+
+// Function declarations
+void screen_mgr_init(const screen_def_t *defs, uint8_t count);
+
+bool screen_mgr_show(uint8_t id);
+
+uint8_t screen_mgr_active(void);
+
+lv_obj_t *screen_mgr_get(uint8_t id);
+
+bool screen_mgr_preload(uint8_t id);
+
+void screen_mgr_get_stats(screen_mgr_stats_t *stats);
+
+void screen_mgr_register_console(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCREEN_MGR_H */
@@ -0,0 +1,87 @@
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "lvgl.h"
+#include "layout.h"
+#include "style_bench.h"
+#include "../display/lvgl_heap.h"
+#include "../layouts/styles.h"
+
+#define STYLE_BENCH_LABELS  12   // About the labels of the main screen
+#define STYLE_BENCH_LOOKUPS 2000 // Style lookups per label
+
+static const char *TAG = "STYLE_BENCH";
+
+// LVGL mutex (from esp32_s3.c)
+extern SemaphoreHandle_t lvgl_mux;
+
+// Title label styled as before the registry, with a local style per object
+static void style_local(lv_obj_t *label)
+{
+    lv_obj_set_style_text_color(label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_72, LV_PART_MAIN);
+}
+
+static void style_shared(lv_obj_t *label)
+{
+    layout_add_style(label, STYLE_TITLE);
+}
+
+static void measure(const char *mode, void (*style)(lv_obj_t *label))
+{
+    lv_obj_t *labels[STYLE_BENCH_LABELS];
+    uint32_t sink = 0;
+
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    lv_obj_t *scr = lv_obj_create(NULL);
+    uint32_t heap = lvgl_heap_used();
+    for (int i = 0; i < STYLE_BENCH_LABELS; i++)
+    {
+        labels[i] = lv_label_create(scr);
+        lv_label_set_text_static(labels[i], "KG");
+        style(labels[i]);
+    }
+    int heap_used = (int)(lvgl_heap_used() - heap);
+
+    // What drawing a label looks up: the styled properties and ones falling back to their default
+    int64_t start = esp_timer_get_time();
+    for (int n = 0; n < STYLE_BENCH_LOOKUPS; n++)
+    {
+        for (int i = 0; i < STYLE_BENCH_LABELS; i++)
+        {
+            sink += lv_obj_get_style_text_color(labels[i], LV_PART_MAIN).full;
+            sink += (uintptr_t)lv_obj_get_style_text_font(labels[i], LV_PART_MAIN);
+            sink += lv_obj_get_style_text_letter_space(labels[i], LV_PART_MAIN);
+        }
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    lv_obj_del(scr);
+    xSemaphoreGiveRecursive(lvgl_mux);
+
+    ESP_LOGI(TAG, "%s: %d labels use %d bytes of heap (%d per label), %lldns per lookup (%lu)", mode,
+             STYLE_BENCH_LABELS, heap_used, heap_used / STYLE_BENCH_LABELS,
+             elapsed * 1000 / (STYLE_BENCH_LOOKUPS * STYLE_BENCH_LABELS * 3), sink);
+}
+
+/**
+ * @brief Run the Shared Style Benchmark
+ *
+ * Builds the same title labels, off screen, once with local styles set per
+ * object and once with the const registry style, and reports the heap they
+ * take and the time of a style property lookup.
+ *
+ * The before and after figures of the style registry were not measured.
+ * The bench needs the device, where the LVGL heap and the style lookups
+ * are the real ones, and it has not been run on one yet. To get them,
+ * define CONFIG_STYLE_BENCH in main.c and read the two STYLE_BENCH lines
+ * at boot: "Local styles" is before the registry and "Const shared style"
+ * is after it.
+ */
+void style_bench_run(void)
+{
+    measure("Local styles", style_local);
+    measure("Const shared style", style_shared);
+}
@@ -0,0 +1,15 @@
+#ifndef STYLE_BENCH_H
+#define STYLE_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Function declarations
+void style_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STYLE_BENCH_H */
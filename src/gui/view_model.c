@@ -0,0 +1,154 @@
+#include <string.h>
+
+#include "view_model.h"
+
+// Plain C without ESP-IDF dependencies, so the change tracking can be checked on the host
+
+typedef struct {
+    uint32_t fields;    // VIEW_FIELD_BIT() of the fields observed, 0 for a free slot
+    view_model_cb_t cb;
+    void *user_data;
+} view_binding_t;
+
+static view_model_t model;
+static view_binding_t bindings[VIEW_MODEL_BINDINGS];
+static view_model_stats_t stats;
+
+static int32_t get_field(view_field_t field)
+{
+    switch (field)
+    {
+    case VIEW_FIELD_MODE:
+        return model.mode;
+    case VIEW_FIELD_WEIGHT:
+        return model.weight;
+    case VIEW_FIELD_EFFORT:
+        return model.effort;
+    case VIEW_FIELD_REPS:
+        return model.reps;
+    case VIEW_FIELD_EXERCISE:
+        return model.exercise;
+    case VIEW_FIELD_LINK:
+        return model.link;
+    default:
+        return 0;
+    }
+}
+
+static void set_field(view_field_t field, int32_t value)
+{
+    switch (field)
+    {
+    case VIEW_FIELD_MODE:
+        model.mode = (view_mode_t)value;
+        break;
+    case VIEW_FIELD_WEIGHT:
+        model.weight = (int16_t)value;
+        break;
+    case VIEW_FIELD_EFFORT:
+        model.effort = (int16_t)value;
+        break;
+    case VIEW_FIELD_REPS:
+        model.reps = (int16_t)value;
+        break;
+    case VIEW_FIELD_EXERCISE:
+        model.exercise = (uint8_t)value;
+        break;
+    case VIEW_FIELD_LINK:
+        model.link = (view_link_t)value;
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Reset the View-Model
+ *
+ * Drops every binding. Bindings added afterwards are synchronised with
+ * these values when they are bound.
+ */
+void view_model_init(const view_model_t *initial)
+{
+    model = *initial;
+    memset(bindings, 0, sizeof(bindings));
+    memset(&stats, 0, sizeof(stats));
+}
+
+const view_model_t *view_model_get(void)
+{
+    return &model;
+}
+
+/**
+ * @brief Bind an Observer to Fields of the View-Model
+ *
+ * The observer is called once right away, so its widgets match the model,
+ * then each time one of the fields changes value.
+ *
+ * @param[in] fields VIEW_FIELD_BIT() of the fields the observer shows.
+ * @param[in] cb Observer.
+ * @param[in] user_data Passed to the observer, usually the widget.
+ * @return false when all VIEW_MODEL_BINDINGS are in use.
+ */
+bool view_model_bind(uint32_t fields, view_model_cb_t cb, void *user_data)
+{
+    for (int i = 0; i < VIEW_MODEL_BINDINGS; i++)
+    {
+        if (bindings[i].fields == 0)
+        {
+            bindings[i].fields = fields;
+            bindings[i].cb = cb;
+            bindings[i].user_data = user_data;
+            stats.notified++;
+            cb(&model, user_data);
+            return true;
+        }
+    }
+    return false;
+}
+
+void view_model_unbind(view_model_cb_t cb, void *user_data)
+{
+    for (int i = 0; i < VIEW_MODEL_BINDINGS; i++)
+    {
+        if (bindings[i].cb == cb && bindings[i].user_data == user_data)
+            bindings[i].fields = 0;
+    }
+}
+
+/**
+ * @brief Change one Field of the View-Model
+ *
+ * Only the observers bound to the field are called, and none when the value
+ * is the one the field already has. Observers update widgets, so call with
+ * the LVGL mutex held.
+ *
+ * @return true if the value changed.
+ */
+bool view_model_set(view_field_t field, int32_t value)
+{
+    stats.sets++;
+    if (field >= VIEW_FIELD_COUNT || get_field(field) == value)
+    {
+        stats.unchanged++;
+        return false;
+    }
+    set_field(field, value);
+
+    uint32_t bit = VIEW_FIELD_BIT(field);
+    for (int i = 0; i < VIEW_MODEL_BINDINGS; i++)
+    {
+        if (bindings[i].fields & bit)
+        {
+            stats.notified++;
+            bindings[i].cb(&model, bindings[i].user_data);
+        }
+    }
+    return true;
+}
+
+void view_model_get_stats(view_model_stats_t *out)
+{
+    *out = stats;
+}
@@ -0,0 +1,72 @@
+#ifndef VIEW_MODEL_H
+#define VIEW_MODEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VIEW_MODEL_BINDINGS 16 // Observers bound at once
+
+typedef enum {
+    VIEW_MODE_CNS = 0, // Constant weight, set with the slider
+    VIEW_MODE_ADP,     // Adaptive, the Arduino reports the effort
+} view_mode_t;
+
+typedef enum {
+    VIEW_LINK_UNKNOWN = 0, // Nothing received from the Arduino yet
+    VIEW_LINK_UP,          // Last frame from the Arduino was well formed
+    VIEW_LINK_DOWN,        // Last frame was malformed
+} view_link_t;
+
+typedef enum {
+    VIEW_FIELD_MODE = 0,
+    VIEW_FIELD_WEIGHT,
+    VIEW_FIELD_EFFORT,
+    VIEW_FIELD_REPS,
+    VIEW_FIELD_EXERCISE,
+    VIEW_FIELD_LINK,
+    VIEW_FIELD_COUNT,
+} view_field_t;
+
+#define VIEW_FIELD_BIT(field) (1U << (field))
+
+// What the screens show, the single source of truth for their widgets
+typedef struct {
+    view_mode_t mode;
+    int16_t weight;    // kg set in CNS mode
+    int16_t effort;    // kg reported in ADP mode
+    int16_t reps;
+    uint8_t exercise;  // Index into the exercise names
+    view_link_t link;
+} view_model_t;
+
+// Called with the whole model when one of the fields it is bound to changed
+typedef void (*view_model_cb_t)(const view_model_t *vm, void *user_data);
+
+typedef struct {
+    uint32_t sets;      // Field writes
+    uint32_t unchanged; // Writes of the value a field already had, nothing notified
+    uint32_t notified;  // Observer calls
+} view_model_stats_t;
+
+// Function declarations
+void view_model_init(const view_model_t *initial);
+
+const view_model_t *view_model_get(void);
+
+bool view_model_bind(uint32_t fields, view_model_cb_t cb, void *user_data);
+
+void view_model_unbind(view_model_cb_t cb, void *user_data);
+
+bool view_model_set(view_field_t field, int32_t value);
+
+void view_model_get_stats(view_model_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIEW_MODEL_H */
@@ -0,0 +1,318 @@
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "vlist.h"
+#include "refr_period.h"
+
+#define VLIST_UNBOUND       UINT32_MAX
+#define VLIST_THROW_MIN     64  // Slowest throw that keeps scrolling, in 1/256 px per frame
+#define VLIST_THROW_HOLD_MS 100 // Pause before the release that cancels the throw
+
+static const char *TAG = "VLIST";
+
+typedef struct {
+    lv_obj_t obj;
+    vlist_source_t src;
+    lv_obj_t *rows[VLIST_MAX_ROWS];
+    uint32_t bound[VLIST_MAX_ROWS]; // Row each object shows, VLIST_UNBOUND for none
+    uint8_t row_count;
+    lv_coord_t row_h;
+    lv_coord_t height;
+    uint32_t count;
+    int32_t scroll;                 // Content offset at the top of the list, in px, past LVGL's 16-bit coordinates
+    uint32_t fetched_first;         // Rows the source was last asked for
+    uint32_t fetched_end;
+    lv_coord_t drag_y;              // Last point of the drag
+    uint32_t drag_tick;
+    int32_t speed;                  // 1/256 px per frame, positive towards the end
+    int32_t throw_frac;             // Sub-pixel part of the throw
+    lv_timer_t *throw_timer;
+    bool scrolling;
+    vlist_stats_t stats;
+} vlist_t;
+
+static void vlist_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void vlist_event(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t vlist_class = {
+    .destructor_cb = vlist_destructor,
+    .event_cb = vlist_event,
+    .instance_size = sizeof(vlist_t),
+    .base_class = &lv_obj_class,
+};
+
+static int32_t max_scroll(const vlist_t *list)
+{
+    return LV_MAX(0, (int32_t)list->count * list->row_h - list->height);
+}
+
+// Only touch the flag when it changes, adding or clearing it invalidates the object
+static void set_hidden(lv_obj_t *obj, bool hidden)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden)
+        return;
+    if (hidden)
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else
+        lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Ask the source for a page of rows, ahead in the direction of the scroll
+static void fetch(vlist_t *list, uint32_t first, uint32_t end, int dir)
+{
+    uint32_t n = LV_MAX(VLIST_FETCH_ROWS, end - first);
+    uint32_t from = dir < 0 && end > n ? end - n : first;
+    uint32_t to = LV_MIN(from + n, list->count);
+
+    if (list->src.fetch)
+    {
+        list->src.fetch(from, to - from, list->src.user_data);
+        list->stats.fetches++;
+    }
+    list->fetched_first = from;
+    list->fetched_end = to;
+}
+
+/**
+ * @brief Place the Rows in View
+ *
+ * Row i is shown by object i % row_count, so an object only needs to be
+ * rebound when the row it shows scrolls out of view, and the rows entering
+ * at one edge take the objects of those leaving at the other.
+ */
+static void place_rows(vlist_t *list, int dir)
+{
+    int64_t start = esp_timer_get_time();
+    uint32_t first = list->scroll / list->row_h;
+    uint32_t end = (list->scroll + list->height + list->row_h - 1) / list->row_h;
+
+    first = first > VLIST_MARGIN_ROWS ? first - VLIST_MARGIN_ROWS : 0;
+    end = LV_MIN(end + VLIST_MARGIN_ROWS, list->count);
+    end = LV_MIN(end, first + list->row_count);
+    if (first < end && (first < list->fetched_first || end > list->fetched_end))
+        fetch(list, first, end, dir);
+
+    for (uint8_t s = 0; s < list->row_count; s++)
+    {
+        lv_obj_t *row = list->rows[s];
+        uint32_t i = first + (s + list->row_count - first % list->row_count) % list->row_count;
+        if (i >= end)
+        {
+            set_hidden(row, true);
+            continue;
+        }
+        if (list->bound[s] != i)
+        {
+            list->src.bind(row, i, list->src.user_data);
+            list->bound[s] = i;
+            list->stats.binds++;
+        }
+        lv_obj_set_y(row, (lv_coord_t)((int32_t)i * list->row_h - list->scroll));
+        set_hidden(row, false);
+    }
+
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    list->stats.frames++;
+    list->stats.total_us += elapsed;
+    list->stats.max_us = LV_MAX(list->stats.max_us, elapsed);
+}
+
+static bool scroll_to_px(vlist_t *list, int32_t scroll)
+{
+    scroll = LV_CLAMP(0, scroll, max_scroll(list));
+    if (scroll == list->scroll)
+        return false;
+
+    int dir = scroll > list->scroll ? 1 : -1;
+    list->scroll = scroll;
+    place_rows(list, dir);
+    return true;
+}
+
+// Refresh at VLIST_FRAME_MS while the finger or a throw moves the list
+static void scroll_begin(vlist_t *list)
+{
+    if (list->scrolling)
+        return;
+    list->scrolling = true;
+    memset(&list->stats, 0, sizeof(list->stats));
+    refr_period_hold(&list->obj, VLIST_FRAME_MS);
+}
+
+static void scroll_end(vlist_t *list)
+{
+    if (list->throw_timer)
+    {
+        lv_timer_del(list->throw_timer);
+        list->throw_timer = NULL;
+    }
+    if (!list->scrolling)
+        return;
+    list->scrolling = false;
+    refr_period_release(&list->obj);
+
+    uint32_t avg = list->stats.frames ? list->stats.total_us / list->stats.frames : 0;
+    ESP_LOGI(TAG, "Scrolled to row %lu of %lu: %lu steps, %lu rows bound, %lu fetches, avg %luus, max %luus",
+             (uint32_t)(list->scroll / list->row_h), list->count, list->stats.frames, list->stats.binds,
+             list->stats.fetches, avg, list->stats.max_us);
+}
+
+static void throw_timer_cb(lv_timer_t *timer)
+{
+    vlist_t *list = timer->user_data;
+
+    list->throw_frac += list->speed;
+    int32_t dy = list->throw_frac / 256;
+    list->throw_frac -= dy * 256;
+    list->speed = list->speed * VLIST_THROW_DECAY / 100;
+
+    bool moved = dy == 0 || scroll_to_px(list, list->scroll + dy);
+    if (!moved || LV_ABS(list->speed) < VLIST_THROW_MIN)
+        scroll_end(list); // Stopped, or ran into an end of the list
+}
+
+static void vlist_destructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    scroll_end((vlist_t *)obj);
+}
+
+/**
+ * @brief Drag and Throw
+ *
+ * The list scrolls itself rather than through LVGL, whose 16-bit
+ * coordinates cannot hold thousands of rows. The speed of the finger at
+ * release carries on, slowing by VLIST_THROW_DECAY every frame.
+ */
+static void vlist_event(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    if (lv_obj_event_base(&vlist_class, e) != LV_RES_OK)
+        return;
+
+    vlist_t *list = (vlist_t *)lv_event_get_target(e);
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_point_t p;
+
+    if (code == LV_EVENT_PRESSED)
+    {
+        scroll_end(list);
+        lv_indev_get_point(lv_indev_get_act(), &p);
+        list->drag_y = p.y;
+        list->drag_tick = lv_tick_get();
+        list->speed = 0;
+    }
+    else if (code == LV_EVENT_PRESSING)
+    {
+        lv_indev_get_point(lv_indev_get_act(), &p);
+        int32_t dy = list->drag_y - p.y;
+        uint32_t ms = LV_MAX(1, lv_tick_elaps(list->drag_tick));
+        if (dy == 0)
+            return;
+        scroll_begin(list);
+        list->drag_y = p.y;
+        list->drag_tick = lv_tick_get();
+        // Finger speed in 1/256 px per frame, averaged over the last reads
+        list->speed = (list->speed + dy * 256 * VLIST_FRAME_MS / (int32_t)ms) / 2;
+        scroll_to_px(list, list->scroll + dy);
+    }
+    else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST)
+    {
+        // A finger held still before lifting does not throw
+        if (lv_tick_elaps(list->drag_tick) > VLIST_THROW_HOLD_MS)
+            list->speed = 0;
+        if (LV_ABS(list->speed) < VLIST_THROW_MIN)
+        {
+            scroll_end(list);
+            return;
+        }
+        list->throw_frac = 0;
+        list->throw_timer = lv_timer_create(throw_timer_cb, VLIST_FRAME_MS, list);
+    }
+}
+
+/**
+ * @brief Create a Virtualised List
+ *
+ * Only the rows in view and VLIST_MARGIN_ROWS on each side are objects,
+ * created once and rebound from the source while scrolling, so memory and
+ * the work per frame do not depend on the number of rows. Rows are fetched
+ * from the source VLIST_FETCH_ROWS at a time as they come into view.
+ *
+ * @param[in] parent Parent object, should not scroll itself.
+ * @param[in] w Width of the list.
+ * @param[in] h Height of the list.
+ * @param[in] row_h Height of every row.
+ * @param[in] src Data source, copied.
+ * @return The new object.
+ */
+lv_obj_t *vlist_create(lv_obj_t *parent, lv_coord_t w, lv_coord_t h, lv_coord_t row_h, const vlist_source_t *src)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(&vlist_class, parent);
+    lv_obj_class_init_obj(obj);
+
+    vlist_t *list = (vlist_t *)obj;
+    list->src = *src;
+    list->row_h = LV_MAX(1, row_h);
+    list->height = h;
+
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, w, h);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+
+    // Partly visible rows at both edges, plus the margins
+    uint32_t needed = (h + list->row_h - 1) / list->row_h + 1 + 2 * VLIST_MARGIN_ROWS;
+    if (needed > VLIST_MAX_ROWS)
+        ESP_LOGW(TAG, "%lu rows in view, raise VLIST_MAX_ROWS", needed);
+    list->row_count = LV_MIN(needed, VLIST_MAX_ROWS);
+    for (uint8_t s = 0; s < list->row_count; s++)
+    {
+        list->rows[s] = src->create_row(obj, src->user_data);
+        lv_obj_set_size(list->rows[s], w, list->row_h);
+        lv_obj_clear_flag(list->rows[s], LV_OBJ_FLAG_CLICKABLE); // The list takes the drag
+        lv_obj_add_flag(list->rows[s], LV_OBJ_FLAG_HIDDEN);
+        list->bound[s] = VLIST_UNBOUND;
+    }
+
+    vlist_refresh(obj);
+    return obj;
+}
+
+/**
+ * @brief Reload the Rows From the Source
+ *
+ * Rereads the row count and rebinds the rows in view. A list scrolled to
+ * its end stays there, so it follows the rows appended to it.
+ *
+ * @param[in] obj Virtualised list object.
+ */
+void vlist_refresh(lv_obj_t *obj)
+{
+    vlist_t *list = (vlist_t *)obj;
+    bool at_end = list->count > 0 && list->scroll >= max_scroll(list);
+
+    list->count = list->src.count(list->src.user_data);
+    list->fetched_first = list->fetched_end = 0;
+    for (uint8_t s = 0; s < list->row_count; s++)
+        list->bound[s] = VLIST_UNBOUND;
+    list->scroll = at_end ? max_scroll(list) : LV_MIN(list->scroll, max_scroll(list));
+    place_rows(list, at_end ? -1 : 1);
+}
+
+// Scroll so that row index is at the top, or as close as the end of the list allows
+void vlist_scroll_to(lv_obj_t *obj, uint32_t index)
+{
+    vlist_t *list = (vlist_t *)obj;
+
+    scroll_end(list);
+    // The source may have grown since the last refresh, e.g. while the list was preloaded and not shown
+    if (list->src.count(list->src.user_data) != list->count)
+        vlist_refresh(obj);
+    scroll_to_px(list, (int32_t)LV_MIN(index, list->count) * list->row_h);
+}
+
+void vlist_get_stats(lv_obj_t *obj, vlist_stats_t *stats)
+{
+    *stats = ((vlist_t *)obj)->stats;
+}
@@ -0,0 +1,50 @@
+#ifndef VLIST_H
+#define VLIST_H
+
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VLIST_MAX_ROWS    24  // Row objects recycled, visible rows plus the margins
+#define VLIST_MARGIN_ROWS 2   // Rows kept bound above and below the visible ones
+#define VLIST_FETCH_ROWS  32  // Rows asked from the source at once
+#define VLIST_FRAME_MS    16  // Display refresh period while scrolling (~60 fps with the 1 ms FreeRTOS tick)
+#define VLIST_THROW_DECAY 94  // % of the speed kept per frame after a throw
+
+// Rows come from the source, the list only ever holds the ones in view
+typedef struct {
+    uint32_t (*count)(void *user_data);                                 // Rows in the list
+    void (*fetch)(uint32_t first, uint32_t count, void *user_data);     // Get rows ready to bind; may be NULL
+    lv_obj_t *(*create_row)(lv_obj_t *parent, void *user_data);         // Build one recycled row object
+    void (*bind)(lv_obj_t *row, uint32_t index, void *user_data);       // Show row index in a recycled object
+    void *user_data;
+} vlist_source_t;
+
+typedef struct {
+    uint32_t frames;   // Scroll steps drawn
+    uint32_t binds;    // Rows rebound, those scrolled into view
+    uint32_t fetches;  // Calls of the source's fetch
+    uint32_t total_us; // Time spent placing and binding rows
+    uint32_t max_us;   // Slowest step
+} vlist_stats_t;
+
+extern const lv_obj_class_t vlist_class;
+
+// Function declarations
+lv_obj_t *vlist_create(lv_obj_t *parent, lv_coord_t w, lv_coord_t h, lv_coord_t row_h, const vlist_source_t *src);
+
+void vlist_refresh(lv_obj_t *obj);
+
+void vlist_scroll_to(lv_obj_t *obj, uint32_t index);
+
+void vlist_get_stats(lv_obj_t *obj, vlist_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VLIST_H */
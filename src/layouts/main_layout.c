@@ -0,0 +1,47 @@
+/* Generated by tools/layout_compiler.py from src/layouts/main.json - do not edit */
+
+#include "main_layout.h"
+#include "styles.h"
+
+static const layout_obj_t objs_1024x600[MAIN_OBJ_COUNT] = {
+    [MAIN_SMALL_LOGO] = {.type = LAYOUT_IMG, .flags = LAYOUT_CLICKABLE, .align = LV_ALIGN_DEFAULT, .x = 92, .y = 44, .w = 176, .h = 30, .text = "helbur_small_opaque"},
+    [MAIN_CNS_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 620, .y = 50, .styles = LAYOUT_STYLE(STYLE_CAPTION), .text = "CNS"},
+    [MAIN_MODE_SWITCH] = {.type = LAYOUT_SWITCH, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 703, .y = 53, .w = 80, .h = 30, .styles = LAYOUT_STYLE(STYLE_MODE_SWITCH)},
+    [MAIN_ADP_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 810, .y = 50, .styles = LAYOUT_STYLE(STYLE_CAPTION), .text = "ADP"},
+    [MAIN_KG_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 200, .y = 250, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "KG"},
+    [MAIN_KG_VALUE_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 200, .y = 330, .styles = LAYOUT_STYLE(STYLE_VALUE), .text = "15"},
+    [MAIN_KG_SLIDER] = {.type = LAYOUT_ARC, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 362, .y = 150, .w = 300, .h = 300, .styles = LAYOUT_STYLE(STYLE_ARC) | LAYOUT_STYLE(STYLE_ARC_KNOB), .min = 15, .max = 50, .value = 15, .start_angle = 135, .end_angle = 45},
+    [MAIN_WEIGHT_BAR] = {.type = LAYOUT_ARC, .flags = LAYOUT_HIDDEN | LAYOUT_NO_KNOB, .align = LV_ALIGN_DEFAULT, .x = 362, .y = 150, .w = 300, .h = 300, .styles = LAYOUT_STYLE(STYLE_ARC), .min = 15, .max = 50, .value = 15, .start_angle = 135, .end_angle = 45},
+    [MAIN_REP_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 750, .y = 250, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "REPS"},
+    [MAIN_REP_VALUE_ROLL] = {.type = LAYOUT_DIGIT_ROLL, .flags = LAYOUT_CLICKABLE, .align = LV_ALIGN_DEFAULT, .x = 750, .y = 330, .font = &lv_font_montserrat_72, .color = 0x87A2AB, .bg_color = 0x223A44, .value = 2},
+    [MAIN_NAME_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_BOTTOM_MID, .x = 0, .y = -50, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "DEADLIFT"},
+    [MAIN_ADP_NAME_LABEL] = {.type = LAYOUT_LABEL, .flags = LAYOUT_HIDDEN, .align = LV_ALIGN_BOTTOM_MID, .x = 0, .y = -50, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "ADAPTIVE MODE"},
+};
+
+static const layout_obj_t objs_800x480[MAIN_OBJ_COUNT] = {
+    [MAIN_SMALL_LOGO] = {.type = LAYOUT_IMG, .flags = LAYOUT_CLICKABLE, .align = LV_ALIGN_DEFAULT, .x = 72, .y = 35, .w = 176, .h = 30, .text = "helbur_small_opaque"},
+    [MAIN_CNS_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 484, .y = 40, .styles = LAYOUT_STYLE(STYLE_CAPTION), .text = "CNS"},
+    [MAIN_MODE_SWITCH] = {.type = LAYOUT_SWITCH, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 549, .y = 42, .w = 80, .h = 30, .styles = LAYOUT_STYLE(STYLE_MODE_SWITCH)},
+    [MAIN_ADP_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 633, .y = 40, .styles = LAYOUT_STYLE(STYLE_CAPTION), .text = "ADP"},
+    [MAIN_KG_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 156, .y = 200, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "KG"},
+    [MAIN_KG_VALUE_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 156, .y = 264, .styles = LAYOUT_STYLE(STYLE_VALUE), .text = "15"},
+    [MAIN_KG_SLIDER] = {.type = LAYOUT_ARC, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 283, .y = 123, .w = 234, .h = 234, .styles = LAYOUT_STYLE(STYLE_ARC) | LAYOUT_STYLE(STYLE_ARC_KNOB), .min = 15, .max = 50, .value = 15, .start_angle = 135, .end_angle = 45},
+    [MAIN_WEIGHT_BAR] = {.type = LAYOUT_ARC, .flags = LAYOUT_HIDDEN | LAYOUT_NO_KNOB, .align = LV_ALIGN_DEFAULT, .x = 283, .y = 123, .w = 234, .h = 234, .styles = LAYOUT_STYLE(STYLE_ARC), .min = 15, .max = 50, .value = 15, .start_angle = 135, .end_angle = 45},
+    [MAIN_REP_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 586, .y = 200, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "REPS"},
+    [MAIN_REP_VALUE_ROLL] = {.type = LAYOUT_DIGIT_ROLL, .flags = LAYOUT_CLICKABLE, .align = LV_ALIGN_DEFAULT, .x = 586, .y = 264, .font = &lv_font_montserrat_72, .color = 0x87A2AB, .bg_color = 0x223A44, .value = 2},
+    [MAIN_NAME_LABEL] = {.type = LAYOUT_LABEL, .flags = 0, .align = LV_ALIGN_BOTTOM_MID, .x = 0, .y = -40, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "DEADLIFT"},
+    [MAIN_ADP_NAME_LABEL] = {.type = LAYOUT_LABEL, .flags = LAYOUT_HIDDEN, .align = LV_ALIGN_BOTTOM_MID, .x = 0, .y = -40, .styles = LAYOUT_STYLE(STYLE_TITLE), .text = "ADAPTIVE MODE"},
+};
+
+static const layout_variant_t variants[] = {
+    {1024, 600, objs_1024x600},
+    {800, 480, objs_800x480},
+};
+
+const layout_screen_t main_layout = {
+    .name = "main",
+    .styles = LAYOUT_STYLE(STYLE_SCREEN),
+    .obj_count = MAIN_OBJ_COUNT,
+    .variant_count = 2,
+    .variants = variants,
+};
@@ -0,0 +1,27 @@
+/* Generated by tools/layout_compiler.py from src/layouts/main.json - do not edit */
+
+#ifndef MAIN_LAYOUT_H
+#define MAIN_LAYOUT_H
+
+#include "../gui/layout.h"
+
+// Objects of the screen, indices into the array filled by layout_create()
+enum {
+    MAIN_SMALL_LOGO,
+    MAIN_CNS_LABEL,
+    MAIN_MODE_SWITCH,
+    MAIN_ADP_LABEL,
+    MAIN_KG_LABEL,
+    MAIN_KG_VALUE_LABEL,
+    MAIN_KG_SLIDER,
+    MAIN_WEIGHT_BAR,
+    MAIN_REP_LABEL,
+    MAIN_REP_VALUE_ROLL,
+    MAIN_NAME_LABEL,
+    MAIN_ADP_NAME_LABEL,
+    MAIN_OBJ_COUNT
+};
+
+extern const layout_screen_t main_layout;
+
+#endif /* MAIN_LAYOUT_H */
@@ -0,0 +1,25 @@
+/* Generated by tools/layout_compiler.py from src/layouts/splash.json - do not edit */
+
+#include "splash_layout.h"
+#include "styles.h"
+
+static const layout_obj_t objs_1024x600[SPLASH_OBJ_COUNT] = {
+    [SPLASH_LOGO] = {.type = LAYOUT_IMG, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 312, .y = 265, .w = 400, .h = 70, .text = "helbur_splash_opaque"},
+};
+
+static const layout_obj_t objs_800x480[SPLASH_OBJ_COUNT] = {
+    [SPLASH_LOGO] = {.type = LAYOUT_IMG, .flags = 0, .align = LV_ALIGN_DEFAULT, .x = 200, .y = 205, .w = 400, .h = 70, .text = "helbur_splash_opaque"},
+};
+
+static const layout_variant_t variants[] = {
+    {1024, 600, objs_1024x600},
+    {800, 480, objs_800x480},
+};
+
+const layout_screen_t splash_layout = {
+    .name = "splash",
+    .styles = LAYOUT_STYLE(STYLE_SCREEN),
+    .obj_count = SPLASH_OBJ_COUNT,
+    .variant_count = 2,
+    .variants = variants,
+};
@@ -0,0 +1,16 @@
+/* Generated by tools/layout_compiler.py from src/layouts/splash.json - do not edit */
+
+#ifndef SPLASH_LAYOUT_H
+#define SPLASH_LAYOUT_H
+
+#include "../gui/layout.h"
+
+// Objects of the screen, indices into the array filled by layout_create()
+enum {
+    SPLASH_LOGO,
+    SPLASH_OBJ_COUNT
+};
+
+extern const layout_screen_t splash_layout;
+
+#endif /* SPLASH_LAYOUT_H */
@@ -0,0 +1,138 @@
+/* Generated by tools/layout_compiler.py from src/layouts/styles.json - do not edit */
+
+#include "styles.h"
+
+// Const styles, read by LVGL from flash and shared by every object using them
+
+static const lv_style_const_prop_t style_screen_main_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x22, 0x3A, 0x44)),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_screen_main, style_screen_main_props);
+
+static const lv_style_const_prop_t style_caption_main_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x87, 0xA2, 0xAB)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_30),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_caption_main, style_caption_main_props);
+
+static const lv_style_const_prop_t style_title_main_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x87, 0xA2, 0xAB)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_72),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_title_main, style_title_main_props);
+
+static const lv_style_const_prop_t style_value_main_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xBC, 0xD2, 0x4B)),
+    LV_STYLE_CONST_TEXT_FONT(&lv_font_montserrat_72),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_value_main, style_value_main_props);
+
+static const lv_style_const_prop_t style_mode_switch_main_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2E, 0x4E, 0x5C)),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_mode_switch_main, style_mode_switch_main_props);
+
+static const lv_style_const_prop_t style_mode_switch_indicator_checked_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x2E, 0x4E, 0x5C)),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_mode_switch_indicator_checked, style_mode_switch_indicator_checked_props);
+
+static const lv_style_const_prop_t style_mode_switch_knob_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xBC, 0xD2, 0x4B)),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_WIDTH(30),
+    LV_STYLE_CONST_HEIGHT(30),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_mode_switch_knob, style_mode_switch_knob_props);
+
+static const lv_style_const_prop_t style_arc_main_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(30),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0x2E, 0x4E, 0x5C)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_arc_main, style_arc_main_props);
+
+static const lv_style_const_prop_t style_arc_indicator_props[] = {
+    LV_STYLE_CONST_ARC_WIDTH(30),
+    LV_STYLE_CONST_ARC_COLOR(LV_COLOR_MAKE(0xBC, 0xD2, 0x4B)),
+    LV_STYLE_CONST_ARC_OPA(255),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_arc_indicator, style_arc_indicator_props);
+
+static const lv_style_const_prop_t style_arc_knob_knob_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xBC, 0xD2, 0x4B)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_CONST_PAD_TOP(10),
+    LV_STYLE_CONST_PAD_BOTTOM(10),
+    LV_STYLE_CONST_PAD_LEFT(10),
+    LV_STYLE_CONST_PAD_RIGHT(10),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_arc_knob_knob, style_arc_knob_knob_props);
+
+static const lv_style_const_prop_t style_calib_bar_main_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xBC, 0xD2, 0x4B)),
+    LV_STYLE_CONST_BG_OPA(255),
+    LV_STYLE_PROP_INV,
+};
+static LV_STYLE_CONST_INIT(style_calib_bar_main, style_calib_bar_main_props);
+
+static const layout_style_t screen_parts[] = {
+    {&style_screen_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t caption_parts[] = {
+    {&style_caption_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t title_parts[] = {
+    {&style_title_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t value_parts[] = {
+    {&style_value_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t mode_switch_parts[] = {
+    {&style_mode_switch_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+    {&style_mode_switch_indicator_checked, LV_PART_INDICATOR | LV_STATE_CHECKED},
+    {&style_mode_switch_knob, LV_PART_KNOB | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t arc_parts[] = {
+    {&style_arc_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+    {&style_arc_indicator, LV_PART_INDICATOR | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t arc_knob_parts[] = {
+    {&style_arc_knob_knob, LV_PART_KNOB | LV_STATE_DEFAULT},
+};
+
+static const layout_style_t calib_bar_parts[] = {
+    {&style_calib_bar_main, LV_PART_MAIN | LV_STATE_DEFAULT},
+};
+
+const layout_style_set_t layout_styles[STYLE_COUNT] = {
+    [STYLE_SCREEN] = {screen_parts, sizeof(screen_parts) / sizeof(screen_parts[0])},
+    [STYLE_CAPTION] = {caption_parts, sizeof(caption_parts) / sizeof(caption_parts[0])},
+    [STYLE_TITLE] = {title_parts, sizeof(title_parts) / sizeof(title_parts[0])},
+    [STYLE_VALUE] = {value_parts, sizeof(value_parts) / sizeof(value_parts[0])},
+    [STYLE_MODE_SWITCH] = {mode_switch_parts, sizeof(mode_switch_parts) / sizeof(mode_switch_parts[0])},
+    [STYLE_ARC] = {arc_parts, sizeof(arc_parts) / sizeof(arc_parts[0])},
+    [STYLE_ARC_KNOB] = {arc_knob_parts, sizeof(arc_knob_parts) / sizeof(arc_knob_parts[0])},
+    [STYLE_CALIB_BAR] = {calib_bar_parts, sizeof(calib_bar_parts) / sizeof(calib_bar_parts[0])},
+};
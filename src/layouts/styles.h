@@ -0,0 +1,21 @@
+/* Generated by tools/layout_compiler.py from src/layouts/styles.json - do not edit */
+
+#ifndef STYLES_H
+#define STYLES_H
+
+#include "../gui/layout.h"
+
+// Style registry, ids for layout_add_style()
+enum {
+    STYLE_SCREEN,
+    STYLE_CAPTION,
+    STYLE_TITLE,
+    STYLE_VALUE,
+    STYLE_MODE_SWITCH,
+    STYLE_ARC,
+    STYLE_ARC_KNOB,
+    STYLE_CALIB_BAR,
+    STYLE_COUNT
+};
+
+#endif /* STYLES_H */
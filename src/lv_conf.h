@@ -16,7 +16,25 @@
 
 #ifndef LV_CONF_H
 #define LV_CONF_H
+
+/*Font subsets generated by tools/font_subset.py; they disable the built-in sizes they replace*/
+#if defined(__has_include)
+#if __has_include("fonts/font_subsets.h")
+#include "fonts/font_subsets.h"
+#endif
+#endif
+
+/*Subsets whose glyph bitmaps tools/asset_pipeline.py moved to the asset bundle; it disables them*/
+#if defined(__has_include)
+#if __has_include("fonts/font_bundle.h")
+#include "fonts/font_bundle.h"
+#endif
+#endif
+
+/*Digits only fallback in src/, until the subsets are generated*/
+#ifndef LV_FONT_MONTSERRAT_72
 #define LV_FONT_MONTSERRAT_72 1
+#endif
 
 #include <stdint.h>
 
@@ -61,10 +79,11 @@
     #endif
 
 #else       /*LV_MEM_CUSTOM*/
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    /*Small allocations in an internal SRAM pool, large buffers in PSRAM*/
+    #define LV_MEM_CUSTOM_INCLUDE "display/lvgl_heap.h"   /*Header for the dynamic memory function*/
+    #define LV_MEM_CUSTOM_ALLOC   lvgl_heap_alloc
+    #define LV_MEM_CUSTOM_FREE    lvgl_heap_free
+    #define LV_MEM_CUSTOM_REALLOC lvgl_heap_realloc
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -361,28 +380,35 @@
  *===================*/
 
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
- *https://fonts.google.com/specimen/Montserrat*/
-#define LV_FONT_MONTSERRAT_8  1
-#define LV_FONT_MONTSERRAT_10 1
-#define LV_FONT_MONTSERRAT_12 1
+ *https://fonts.google.com/specimen/Montserrat
+ *Only the sizes the UI uses; 14 is the default font, the others are replaced by subsets when generated*/
+#define LV_FONT_MONTSERRAT_8  0
+#define LV_FONT_MONTSERRAT_10 0
+#define LV_FONT_MONTSERRAT_12 0
 #define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_20 1
-#define LV_FONT_MONTSERRAT_22 1
-#define LV_FONT_MONTSERRAT_24 1
-#define LV_FONT_MONTSERRAT_26 1
-#define LV_FONT_MONTSERRAT_28 1
+#define LV_FONT_MONTSERRAT_16 0
+#define LV_FONT_MONTSERRAT_18 0
+#define LV_FONT_MONTSERRAT_20 0
+#define LV_FONT_MONTSERRAT_22 0
+#define LV_FONT_MONTSERRAT_24 0
+#define LV_FONT_MONTSERRAT_26 0
+#define LV_FONT_MONTSERRAT_28 0
+#ifndef LV_FONT_MONTSERRAT_30
 #define LV_FONT_MONTSERRAT_30 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_34 1
-#define LV_FONT_MONTSERRAT_36 1
-#define LV_FONT_MONTSERRAT_38 1
+#endif
+#define LV_FONT_MONTSERRAT_32 0
+#define LV_FONT_MONTSERRAT_34 0
+#define LV_FONT_MONTSERRAT_36 0
+#define LV_FONT_MONTSERRAT_38 0
+#ifndef LV_FONT_MONTSERRAT_40
 #define LV_FONT_MONTSERRAT_40 1
+#endif
 #define LV_FONT_MONTSERRAT_42 0
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
+#ifndef LV_FONT_MONTSERRAT_48
 #define LV_FONT_MONTSERRAT_48 1
+#endif
 
 /*Demonstrate special features*/
 #define LV_FONT_MONTSERRAT_12_SUBPX      0
@@ -397,7 +423,11 @@
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
  *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)*/
+#ifdef FONT_SUBSETS_DECLARE
+#define LV_FONT_CUSTOM_DECLARE FONT_SUBSETS_DECLARE
+#else
 #define LV_FONT_CUSTOM_DECLARE
+#endif
 
 /*Always set a default font*/
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
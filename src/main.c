@@ -2,25 +2,51 @@
 #include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_attr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "lvgl.h"
-#include "helbur_small.h"
-#include "helbur_splash.h"
 #include "display/esp32_s3.h"
-#include "display/matouch_7inch_1024x600.h"
+#include "display/area_bench.h"
+#include "display/render_bench.h"
+#include "display/img_bench.h"
 #include "task/counter_task.h"
+#include "task/touch_bench.h"
+#include "task/touch_task.h"
+#include "task/trace_bench.h"
+#include "task/console.h"
+#include "task/boot_mem.h"
+#include "display/latency.h"
+#include "display/asset_bundle.h"
+#include "display/lvgl_heap.h"
+#include "gui/calib_screen.h"
+#include "gui/history.h"
+#include "gui/history_screen.h"
+#include "gui/main_view.h"
+#include "gui/view_model.h"
+#include "gui/screen_mgr.h"
+#include "gui/style_bench.h"
+#include "gui/layout.h"
+#include "layouts/main_layout.h"
+#include "layouts/splash_layout.h"
+#include "layouts/styles.h"
 #include "lvgl/lv_font_montserrat_72.h"
 #include "driver/uart.h"
+#include "nvs_flash.h"
 
 static const char *TAG = "MAIN";
 
+// #define CONFIG_AREA_BENCH 1
+// #define CONFIG_RENDER_BENCH 1
+// #define CONFIG_IMG_BENCH 1
+// #define CONFIG_STYLE_BENCH 1
+// #define CONFIG_TOUCH_BENCH 1
+// #define CONFIG_TRACE_BENCH 1
+// #define CONFIG_TRACE_RECORD 1
+
 // LVGL mutex (from esp32_s3.c)
 extern SemaphoreHandle_t lvgl_mux;
 
-// Display configuration (from matouch_7inch_1024x600.h)
-#define LCD_WIDTH LCD_H_RES  // 1024
-#define LCD_HEIGHT LCD_V_RES // 600
-
 // Function prototypes
 void display_init(void);
 
@@ -28,17 +54,16 @@ void display_init(void);
 static void kg_slider_event_cb(lv_event_t *e)
 {
     lv_obj_t *slider = lv_event_get_target(e);
-    lv_obj_t *label = (lv_obj_t *)lv_event_get_user_data(e);
+    latency_event();
     int32_t value = lv_arc_get_value(slider);
     // Constrain value to 15–50 kg
     value = (value < 15) ? 15 : (value > 50) ? 50
                                              : value;
-    char buf[8];
-    snprintf(buf, sizeof(buf), "%d", (int)value);
     xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
-    lv_label_set_text(label, buf);
-    lv_arc_set_value(slider, value);
+    bool changed = view_model_set(VIEW_FIELD_WEIGHT, value);
     xSemaphoreGiveRecursive(lvgl_mux);
+    if (!changed)
+        return;
     // Send weight to Arduino
     char uart_buf[32];
     snprintf(uart_buf, sizeof(uart_buf), "WEIGHT:%d\n", (int)value);
@@ -46,83 +71,224 @@ static void kg_slider_event_cb(lv_event_t *e)
     ESP_LOGI(TAG, "Sent weight command: %s, bytes written: %d", uart_buf, bytes_written);
 }
 
+// Switch between CNS and ADP, the bound widgets follow. Call with the LVGL mutex held
+static void set_mode(view_mode_t mode)
+{
+    // CNS starts again from the lightest weight, set while the slider is still hidden
+    if (mode == VIEW_MODE_CNS)
+        view_model_set(VIEW_FIELD_WEIGHT, 15);
+    if (!view_model_set(VIEW_FIELD_MODE, mode))
+        return;
+
+    // Send the mode to Arduino
+    char buf[32];
+    snprintf(buf, sizeof(buf), "MODE:%s\n", mode == VIEW_MODE_ADP ? "ADP" : "CNS");
+    uart_write_bytes(UART_NUM_1, buf, strlen(buf));
+    ESP_LOGI(TAG, "Switched to %s mode", mode == VIEW_MODE_ADP ? "ADP" : "CNS");
+}
+
 // Toggle switch callback
 void mode_switch_event_cb(lv_event_t *e)
 {
     lv_obj_t *mode_switch = lv_event_get_target(e);
-    lv_obj_t *kg_slider = (lv_obj_t *)lv_event_get_user_data(e);
-    lv_obj_t *kg_value_label = kg_slider ? kg_slider->user_data : NULL;
-    lv_obj_t *weight_bar = kg_value_label ? kg_value_label->user_data : NULL;
-    // Access name labels stored in kg_slider->user_data chain
-    lv_obj_t *name_label = weight_bar ? weight_bar->user_data : NULL;
-    lv_obj_t *adp_name_label = name_label ? name_label->user_data : NULL;
 
     xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
-    if (lv_obj_has_state(mode_switch, LV_STATE_CHECKED))
+    set_mode(lv_obj_has_state(mode_switch, LV_STATE_CHECKED) ? VIEW_MODE_ADP : VIEW_MODE_CNS);
+    xSemaphoreGiveRecursive(lvgl_mux);
+}
+
+typedef enum {
+    SCREEN_SPLASH = 0,
+    SCREEN_MAIN,
+    SCREEN_HISTORY,
+    SCREEN_COUNT,
+} screen_id_t;
+
+// Every rep since boot, in PSRAM (CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY)
+EXT_RAM_BSS_ATTR static history_entry_t history_buf[HISTORY_ENTRIES];
+
+static lv_obj_t *splash_logo;
+static lv_timer_t *splash_timer;
+static lv_obj_t *main_ui[MAIN_OBJ_COUNT];
+
+// Timer callback to hide splash logo
+static void hide_splash_logo_cb(lv_timer_t *timer)
+{
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    lv_obj_add_flag(splash_logo, LV_OBJ_FLAG_HIDDEN);
+    ESP_LOGI(TAG, "Hid splash logo");
+    xSemaphoreGiveRecursive(lvgl_mux);
+    lv_timer_del(timer); // One-shot timer
+    splash_timer = NULL;
+}
+
+// Gestures only count when they start on the background, not on a widget
+static bool gesture_on_background(const gesture_t *gesture)
+{
+    lv_obj_t *screen = lv_scr_act();
+    lv_point_t start = {gesture->x, gesture->y};
+    lv_obj_t *obj = lv_indev_search_obj(screen, &start);
+    while (obj && obj != screen && !lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE))
+        obj = lv_obj_get_parent(obj);
+    return obj == NULL || obj == screen;
+}
+
+static void change_exercise(int step)
+{
+    uint8_t exercise = (view_model_get()->exercise + MAIN_VIEW_EXERCISES + step) % MAIN_VIEW_EXERCISES;
+    view_model_set(VIEW_FIELD_EXERCISE, exercise);
+    // Send exercise to Arduino
+    char buf[32];
+    snprintf(buf, sizeof(buf), "EXERCISE:%s\n", main_view_exercise_name(exercise));
+    uart_write_bytes(UART_NUM_1, buf, strlen(buf));
+    ESP_LOGI(TAG, "Exercise changed to %s", main_view_exercise_name(exercise));
+}
+
+// Gesture timer callback: swipe left/right toggles CNS/ADP, swipe up/down changes
+// the exercise, long press resets the rep count
+static void gesture_timer_cb(lv_timer_t *timer)
+{
+    gesture_t gesture;
+    while (touch_task_pop_gesture(&gesture))
     {
-        // ADP mode
-        if (kg_slider)
-            lv_obj_add_flag(kg_slider, LV_OBJ_FLAG_HIDDEN);
-        if (weight_bar)
-            lv_obj_clear_flag(weight_bar, LV_OBJ_FLAG_HIDDEN);
-        if (kg_value_label)
+        xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+        if (lv_scr_act() != screen_mgr_get(SCREEN_MAIN) || !gesture_on_background(&gesture))
         {
-            int32_t bar_value = weight_bar ? lv_arc_get_value(weight_bar) : 15;
-            char buf[8];
-            snprintf(buf, sizeof(buf), "%d", (int)bar_value);
-            lv_label_set_text(kg_value_label, buf);
+            xSemaphoreGiveRecursive(lvgl_mux);
+            continue;
         }
-        if (name_label)
-            lv_obj_add_flag(name_label, LV_OBJ_FLAG_HIDDEN);
-        if (adp_name_label)
-            lv_obj_clear_flag(adp_name_label, LV_OBJ_FLAG_HIDDEN);
-        // Send ADP mode to Arduino
-        char buf[32];
-        snprintf(buf, sizeof(buf), "MODE:ADP\n");
-        uart_write_bytes(UART_NUM_1, buf, strlen(buf));
-        ESP_LOGI(TAG, "Switched to ADP mode");
-    }
-    else
-    {
-        // CNS mode
-        if (kg_slider)
+
+        switch (gesture.type)
         {
-            lv_arc_set_value(kg_slider, 15);
-            lv_obj_clear_flag(kg_slider, LV_OBJ_FLAG_HIDDEN);
-        }
-        if (weight_bar)
-            lv_obj_add_flag(weight_bar, LV_OBJ_FLAG_HIDDEN);
-        if (kg_value_label)
+        case GESTURE_SWIPE_LEFT:
+        case GESTURE_SWIPE_RIGHT:
+            set_mode(view_model_get()->mode == VIEW_MODE_ADP ? VIEW_MODE_CNS : VIEW_MODE_ADP);
+            break;
+        case GESTURE_SWIPE_UP:
+            change_exercise(1);
+            break;
+        case GESTURE_SWIPE_DOWN:
+            change_exercise(-1);
+            break;
+        case GESTURE_LONG_PRESS:
         {
-            int32_t slider_value = kg_slider ? lv_arc_get_value(kg_slider) : 15;
-            char buf[8];
-            snprintf(buf, sizeof(buf), "%d", (int)slider_value);
-            lv_label_set_text(kg_value_label, buf);
+            view_model_set(VIEW_FIELD_REPS, 0);
+            // Send rep reset to Arduino
+            char buf[32];
+            snprintf(buf, sizeof(buf), "REPS:RESET\n");
+            uart_write_bytes(UART_NUM_1, buf, strlen(buf));
+            ESP_LOGI(TAG, "Rep count reset");
+            break;
+        }
+        default:
+            break;
         }
-        if (name_label)
-            lv_obj_clear_flag(name_label, LV_OBJ_FLAG_HIDDEN);
-        if (adp_name_label)
-            lv_obj_add_flag(adp_name_label, LV_OBJ_FLAG_HIDDEN);
-        // Send CNS mode to Arduino
-        char buf[32];
-        snprintf(buf, sizeof(buf), "MODE:CNS\n");
-        uart_write_bytes(UART_NUM_1, buf, strlen(buf));
-        ESP_LOGI(TAG, "Switched to CNS mode");
+        xSemaphoreGiveRecursive(lvgl_mux);
     }
+}
+
+// Log each rep the Arduino reports, a reset to 0 is not a rep
+static void record_rep(const view_model_t *vm, void *user_data)
+{
+    LV_UNUSED(user_data);
+
+    if (vm->reps == 0)
+        return;
+    history_entry_t entry = {
+        .time_s = (uint32_t)(esp_timer_get_time() / 1000000),
+        .kg = vm->mode == VIEW_MODE_ADP ? vm->effort : vm->weight,
+        .reps = (uint8_t)vm->reps,
+        .exercise = vm->exercise,
+        .mode = vm->mode,
+    };
+    history_add(&entry);
+}
+
+// Long press on the rep counter opens the history
+static void rep_long_press_cb(lv_event_t *e)
+{
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    screen_mgr_show(SCREEN_HISTORY);
     xSemaphoreGiveRecursive(lvgl_mux);
 }
 
-// Timer callback to hide splash logo
-static void hide_splash_logo_cb(lv_timer_t *timer)
+// Tap on the history title goes back
+static void history_back_cb(lv_event_t *e)
 {
-    lv_obj_t *splash_img = (lv_obj_t *)timer->user_data;
     xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
-    lv_obj_add_flag(splash_img, LV_OBJ_FLAG_HIDDEN);
-    ESP_LOGI(TAG, "Hid splash logo");
+    screen_mgr_show(SCREEN_MAIN);
     xSemaphoreGiveRecursive(lvgl_mux);
-    lv_timer_del(timer); // One-shot timer
 }
 
+// Long press on the logo opens the touch calibration
+static void logo_long_press_cb(lv_event_t *e)
+{
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    calib_screen_start();
+    xSemaphoreGiveRecursive(lvgl_mux);
+}
+
+static lv_obj_t *create_splash(void)
+{
+    lv_obj_t *splash[SPLASH_OBJ_COUNT];
+    lv_obj_t *screen = layout_create(&splash_layout, splash);
+    splash_logo = splash[SPLASH_LOGO];
+    return screen;
+}
+
+// Hide the logo at 2s
+static void show_splash(lv_obj_t *screen)
+{
+    LV_UNUSED(screen);
+    splash_timer = lv_timer_create(hide_splash_logo_cb, 2000, NULL);
+}
+
+// The timer must not fire on the deleted logo when the splash is left early
+static void hide_splash(lv_obj_t *screen)
+{
+    LV_UNUSED(screen);
+    if (splash_timer)
+        lv_timer_del(splash_timer);
+    splash_timer = NULL;
+}
+
+static lv_obj_t *create_main(void)
+{
+    lv_obj_t *screen = layout_create(&main_layout, main_ui);
+
+    // Long press on the Helbur logo opens the touch calibration, on the rep counter the history
+    lv_obj_add_event_cb(main_ui[MAIN_SMALL_LOGO], logo_long_press_cb, LV_EVENT_LONG_PRESSED, NULL);
+    lv_obj_add_event_cb(main_ui[MAIN_REP_VALUE_ROLL], rep_long_press_cb, LV_EVENT_LONG_PRESSED, NULL);
+    lv_obj_add_event_cb(main_ui[MAIN_KG_SLIDER], kg_slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(main_ui[MAIN_MODE_SWITCH], mode_switch_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    return screen;
+}
+
+// Widgets show the view-model while the screen is shown, events and UART data only change the model
+static void show_main(lv_obj_t *screen)
+{
+    LV_UNUSED(screen);
+    main_view_bind(main_ui);
+}
+
+static void hide_main(lv_obj_t *screen)
+{
+    LV_UNUSED(screen);
+    main_view_unbind();
+}
+
+static lv_obj_t *create_history(void)
+{
+    return history_screen_create(history_back_cb);
+}
+
+// Indexed by screen_id_t. The main screen is built while the splash is shown, the history while the main one is
+static const screen_def_t screens[SCREEN_COUNT] = {
+    {"splash", SCREEN_DISCARD, SCREEN_MAIN, create_splash, show_splash, hide_splash},
+    {"main", SCREEN_PINNED, SCREEN_HISTORY, create_main, show_main, hide_main},
+    {"history", 0, SCREEN_MAIN, create_history, history_screen_show, history_screen_hide},
+};
+
 void app_main(void)
 {
     printf("Starting app_main\n");
@@ -149,165 +315,80 @@ void app_main(void)
     }
     ESP_LOGI(TAG, "Sent INIT to Arduino");
 
+    // NVS holds the touch calibration, loaded by display_init
+    esp_err_t nvs_err = nvs_flash_init();
+    if (nvs_err == ESP_ERR_NVS_NO_FREE_PAGES || nvs_err == ESP_ERR_NVS_NEW_VERSION_FOUND)
+    {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        nvs_err = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(nvs_err);
+
+    // Images and the glyphs of the bundled fonts live in the assets partition, without it they are left blank
+    asset_bundle_mount();
+
+    // What the main screen shows, before the console can print it
+    const view_model_t initial = {.mode = VIEW_MODE_CNS, .weight = 15, .effort = 15, .reps = 0};
+    view_model_init(&initial);
+    // Bound first, so a rep is logged before the history screen shows it
+    history_init(history_buf, HISTORY_ENTRIES);
+    boot_mem_register("Rep history", history_buf, sizeof(history_buf));
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_REPS), record_rep, NULL);
+    main_view_init();
+
     display_init();
+    console_start();
 
     xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
     ESP_LOGI(TAG, "Setting background color");
     lv_disp_t *disp = lv_disp_get_default();
-    lv_obj_set_style_bg_color(disp->screens[0], lv_color_hex(0x223A44), LV_PART_MAIN);
+    layout_add_style(disp->screens[0], STYLE_SCREEN);
     xSemaphoreGiveRecursive(lvgl_mux);
 
     xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
-    ESP_LOGI(TAG, "Creating splash screen");
-    lv_obj_t *splash_screen = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(splash_screen, lv_color_hex(0x223A44), LV_PART_MAIN);
-
-    lv_obj_t *splash_img = lv_img_create(splash_screen);
-    lv_img_set_src(splash_img, &helbur_splash);
-    lv_obj_set_pos(splash_img, (LCD_WIDTH - 400) / 2, (LCD_HEIGHT - 70) / 2);
-
     ESP_LOGI(TAG, "Loading splash screen");
-    lv_scr_load(splash_screen);
+    screen_mgr_init(screens, SCREEN_COUNT);
+    screen_mgr_show(SCREEN_SPLASH);
     ESP_LOGI(TAG, "Splash screen loaded");
     xSemaphoreGiveRecursive(lvgl_mux);
-    // Start timer to hide logo at 2s
-    ESP_LOGI(TAG, "Starting timer to hide splash logo");
-    lv_timer_create(hide_splash_logo_cb, 2000, splash_img); // 2s delay
+    // The main screen is built in the idle frames of the splash
     ESP_LOGI(TAG, "Delaying for 3 seconds");
     vTaskDelay(pdMS_TO_TICKS(3000));
     ESP_LOGI(TAG, "Delay complete");
 
     xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
-    ESP_LOGI(TAG, "Creating main UI");
-    lv_obj_t *main_screen = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(main_screen, lv_color_hex(0x223A44), LV_PART_MAIN);
-
-    // Helbur logo (100x17, scaled to ~176x30), at (50, 50)
-    ESP_LOGI(TAG, "Adding small logo");
-    lv_obj_t *small_logo = lv_img_create(main_screen);
-    lv_img_set_src(small_logo, &helbur_small);
-    lv_img_set_zoom(small_logo, 450);
-    lv_obj_set_pos(small_logo, 130, 50);
-
-    // Toggle switch with "CNS" and "ADP" labels on either side
-    lv_obj_t *cns_label = lv_label_create(main_screen);
-    lv_label_set_text(cns_label, "CNS");
-    lv_obj_set_style_text_color(cns_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(cns_label, &lv_font_montserrat_30, LV_PART_MAIN);
-    lv_obj_set_pos(cns_label, 620, 50);
-
-    lv_obj_t *mode_switch = lv_switch_create(main_screen);
-    lv_obj_set_style_bg_color(mode_switch, lv_color_hex(0x2E4E5C), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(mode_switch, lv_color_hex(0x2E4E5C), LV_PART_INDICATOR | LV_STATE_CHECKED);
-    lv_obj_set_style_bg_color(mode_switch, lv_color_hex(0xBCD24B), LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_size(mode_switch, 80, 30);
-    lv_obj_set_style_height(mode_switch, 30, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_height(mode_switch, 30, LV_PART_INDICATOR | LV_STATE_CHECKED);
-    lv_obj_set_style_pad_all(mode_switch, 0, LV_PART_KNOB);
-    lv_obj_set_style_size(mode_switch, 30, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_pos(mode_switch, 703, 53);
-
-    lv_obj_t *adp_label = lv_label_create(main_screen);
-    lv_label_set_text(adp_label, "ADP");
-    lv_obj_set_style_text_color(adp_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(adp_label, &lv_font_montserrat_30, LV_PART_MAIN);
-    lv_obj_set_pos(adp_label, 810, 50);
-
-    // KG Label (left side, above value)
-    lv_obj_t *kg_label = lv_label_create(main_screen);
-    lv_label_set_text(kg_label, "KG");
-    lv_obj_set_style_text_color(kg_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(kg_label, &lv_font_montserrat_72, LV_PART_MAIN);
-    lv_obj_set_pos(kg_label, 200, 250);
-
-    // KG Value Label (below "KG")
-    lv_obj_t *kg_value_label = lv_label_create(main_screen);
-    lv_label_set_text(kg_value_label, "15");
-    lv_obj_set_style_text_color(kg_value_label, lv_color_hex(0xBCD24B), LV_PART_MAIN);
-    lv_obj_set_style_text_font(kg_value_label, &lv_font_montserrat_72, LV_PART_MAIN);
-    lv_obj_set_pos(kg_value_label, 200, 330);
-
-    // CNS Mode: Arc Slider (15 to 50 kg)
-    ESP_LOGI(TAG, "Adding KG arc slider");
-    lv_obj_t *kg_slider = lv_arc_create(main_screen);
-    lv_arc_set_range(kg_slider, 15, 50);
-    lv_arc_set_value(kg_slider, 15);
-    lv_obj_set_size(kg_slider, 300, 300);
-    lv_obj_set_style_arc_width(kg_slider, 30, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(kg_slider, 30, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_color(kg_slider, lv_color_hex(0x2E4E5C), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(kg_slider, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_color(kg_slider, lv_color_hex(0xBCD24B), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(kg_slider, LV_OPA_COVER, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_color(kg_slider, lv_color_hex(0xBCD24B), LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(kg_slider, LV_OPA_COVER, LV_PART_KNOB | LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_all(kg_slider, 10, LV_PART_KNOB);
-    lv_arc_set_bg_angles(kg_slider, 135, 45);
-    lv_obj_align(kg_slider, LV_ALIGN_CENTER, 0, 0); // Moved 50px up
-
-    // Add the event callback here
-    lv_obj_add_event_cb(kg_slider, kg_slider_event_cb, LV_EVENT_VALUE_CHANGED, kg_value_label);
-
-    // ADP Mode: Arc Progress Indicator (15 to 50 kg)
-    lv_obj_t *weight_bar = lv_arc_create(main_screen);
-    lv_arc_set_range(weight_bar, 15, 50);
-    lv_arc_set_value(weight_bar, 15);
-    lv_obj_set_size(weight_bar, 300, 300);
-    lv_obj_set_style_arc_width(weight_bar, 30, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_width(weight_bar, 30, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_color(weight_bar, lv_color_hex(0x2E4E5C), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(weight_bar, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_color(weight_bar, lv_color_hex(0xBCD24B), LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_set_style_arc_opa(weight_bar, LV_OPA_COVER, LV_PART_INDICATOR | LV_STATE_DEFAULT);
-    lv_obj_remove_style(weight_bar, NULL, LV_PART_KNOB);
-    lv_arc_set_bg_angles(weight_bar, 135, 45);
-    lv_obj_align(weight_bar, LV_ALIGN_BOTTOM_MID, 0, -150);
-    lv_obj_add_flag(weight_bar, LV_OBJ_FLAG_HIDDEN);
-    ESP_LOGI(TAG, "Weight bar initialized, range 15-50 kg");
-
-    // Rep Counter Label (right side, aligned with "KG")
-    ESP_LOGI(TAG, "Adding rep counter");
-    lv_obj_t *rep_label = lv_label_create(main_screen);
-    lv_label_set_text(rep_label, "REPS");
-    lv_obj_set_style_text_color(rep_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(rep_label, &lv_font_montserrat_72, LV_PART_MAIN);
-    lv_obj_set_pos(rep_label, 750, 250);
-
-    // Rep Value Label (below "REPS")
-    lv_obj_t *rep_value_label = lv_label_create(main_screen);
-    lv_label_set_text(rep_value_label, "0");
-    lv_obj_set_style_text_color(rep_value_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(rep_value_label, &lv_font_montserrat_72, LV_PART_MAIN);
-    lv_obj_set_pos(rep_value_label, 750, 330);
-
-    // CNS Mode: Name Label ("DEADLIFT")
-    lv_obj_t *name_label = lv_label_create(main_screen);
-    lv_label_set_text(name_label, "DEADLIFT");
-    lv_obj_set_style_text_color(name_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(name_label, &lv_font_montserrat_72, LV_PART_MAIN);
-    lv_obj_align(name_label, LV_ALIGN_BOTTOM_MID, 0, -50); // 50px from bottom
-
-    // ADP Mode: Name Label ("ADAPTIVE MODE")
-    lv_obj_t *adp_name_label = lv_label_create(main_screen);
-    lv_label_set_text(adp_name_label, "ADAPTIVE MODE");
-    lv_obj_set_style_text_color(adp_name_label, lv_color_hex(0x87A2AB), LV_PART_MAIN);
-    lv_obj_set_style_text_font(adp_name_label, &lv_font_montserrat_72, LV_PART_MAIN);
-    lv_obj_align(adp_name_label, LV_ALIGN_BOTTOM_MID, 0, -50); // 50px from bottom
-    lv_obj_add_flag(adp_name_label, LV_OBJ_FLAG_HIDDEN);       // Hidden initially (CNS mode)
-
-    // Link objects for mode switch callback
-    kg_slider->user_data = kg_value_label;
-    kg_value_label->user_data = weight_bar;
-    weight_bar->user_data = name_label;
-    name_label->user_data = adp_name_label;
-
-    lv_obj_add_event_cb(mode_switch, mode_switch_event_cb, LV_EVENT_VALUE_CHANGED, kg_slider);
+    // Touch gestures, recognised in the touch task
+    lv_timer_create(gesture_timer_cb, TOUCH_INDEV_READ_PERIOD, NULL);
 
     ESP_LOGI(TAG, "Loading main UI");
-    lv_scr_load(main_screen);
+    screen_mgr_show(SCREEN_MAIN);
     ESP_LOGI(TAG, "Main UI loaded");
+    lvgl_heap_log("Main UI");
+    boot_mem_report();
     xSemaphoreGiveRecursive(lvgl_mux);
 
+#if CONFIG_AREA_BENCH
+    area_bench_run();
+#endif
+#if CONFIG_RENDER_BENCH
+    render_bench_run();
+#endif
+#if CONFIG_IMG_BENCH
+    img_bench_run();
+#endif
+#if CONFIG_STYLE_BENCH
+    style_bench_run();
+#endif
+#if CONFIG_TOUCH_BENCH
+    touch_bench_run();
+#endif
+#if CONFIG_TRACE_BENCH
+    trace_bench_run(main_ui[MAIN_KG_SLIDER]);
+#endif
+#if CONFIG_TRACE_RECORD
+    trace_bench_record(10000);
+#endif
+
     ESP_LOGI(TAG, "Entering main loop");
     while (1)
     {
@@ -321,24 +402,20 @@ void app_main(void)
             int value;
             if (sscanf(rx_buf, "REPS:%d", &value) == 1 && value >= 0 && value <= 99)
             {
-                char buf[8];
-                snprintf(buf, sizeof(buf), "%d", value);
-                lv_label_set_text(rep_value_label, buf);
-                ESP_LOGI(TAG, "Rep count updated: %d", value);
+                view_model_set(VIEW_FIELD_LINK, VIEW_LINK_UP);
+                if (view_model_set(VIEW_FIELD_REPS, value))
+                    ESP_LOGI(TAG, "Rep count updated: %d", value);
             }
             else if (sscanf(rx_buf, "EFFORT:%d", &value) == 1 && value >= 15 && value <= 50)
             {
-                if (lv_obj_has_state(mode_switch, LV_STATE_CHECKED))
-                {
-                    lv_arc_set_value(weight_bar, value);
-                    char buf[8];
-                    snprintf(buf, sizeof(buf), "%d", value);
-                    lv_label_set_text(kg_value_label, buf);
-                    ESP_LOGI(TAG, "Effort updated: %d kg, arc set to %d", value, lv_arc_get_value(weight_bar));
-                }
+                view_model_set(VIEW_FIELD_LINK, VIEW_LINK_UP);
+                // Effort only applies in ADP mode
+                if (view_model_get()->mode == VIEW_MODE_ADP && view_model_set(VIEW_FIELD_EFFORT, value))
+                    ESP_LOGI(TAG, "Effort updated: %d kg", value);
             }
             else
             {
+                view_model_set(VIEW_FIELD_LINK, VIEW_LINK_DOWN);
                 ESP_LOGW(TAG, "Malformed UART data: %s", rx_buf);
             }
             xSemaphoreGiveRecursive(lvgl_mux);
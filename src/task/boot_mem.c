@@ -0,0 +1,97 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_memory_utils.h"
+
+#include "boot_mem.h"
+
+static const char *TAG = "BOOT_MEM";
+
+// Section bounds from the ESP-IDF linker scripts
+extern int _data_start, _data_end;
+extern int _bss_start, _bss_end;
+#if CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY
+extern int _ext_ram_bss_start, _ext_ram_bss_end;
+#endif
+
+typedef struct {
+    const char *name;
+    const void *addr;
+    size_t size;
+} boot_mem_region_t;
+
+static boot_mem_region_t regions[BOOT_MEM_REGIONS];
+static int region_count;
+
+/**
+ * @brief Record a Statically Allocated Region
+ *
+ * Long-lived RTOS objects, task stacks and buffers are static, so their
+ * memory is fixed at link time; registering them names them in the boot
+ * memory map. Call from the init functions, before boot_mem_report().
+ */
+void boot_mem_register(const char *name, const void *addr, size_t size)
+{
+    if (region_count == BOOT_MEM_REGIONS)
+    {
+        ESP_LOGW(TAG, "No room for region \"%s\", raise BOOT_MEM_REGIONS", name);
+        return;
+    }
+    regions[region_count++] = (boot_mem_region_t){name, addr, size};
+}
+
+static void report_heap(const char *name, uint32_t caps, size_t reserve)
+{
+    size_t free_bytes = heap_caps_get_free_size(caps);
+    size_t largest = heap_caps_get_largest_free_block(caps);
+    size_t min_free = heap_caps_get_minimum_free_size(caps);
+
+    ESP_LOGI(TAG, "%-8s heap: %u free (lowest %u), largest block %u, of %u", name, free_bytes, min_free, largest,
+             heap_caps_get_total_size(caps));
+    if (free_bytes >= reserve)
+        ESP_LOGI(TAG, "%-8s headroom: %u bytes above the %u reserved for runtime features", name,
+                 free_bytes - reserve, reserve);
+    else
+        ESP_LOGE(TAG, "%-8s headroom: %u bytes short of the %u reserved for runtime features", name,
+                 reserve - free_bytes, reserve);
+}
+
+/**
+ * @brief Log the Boot Memory Map
+ *
+ * Lists the registered static regions with where they live, the size of
+ * the static sections, and the heap left in internal SRAM and PSRAM against
+ * the BOOT_MEM_RESERVE_* headroom. Call once the boot is complete: what is
+ * left then is what runtime features can count on.
+ */
+void boot_mem_report(void)
+{
+    size_t internal = 0;
+    size_t psram = 0;
+
+    ESP_LOGI(TAG, "Static regions:");
+    for (int i = 0; i < region_count; i++)
+    {
+        const boot_mem_region_t *r = &regions[i];
+        bool ext = esp_ptr_external_ram(r->addr);
+        if (ext)
+            psram += r->size;
+        else
+            internal += r->size;
+        ESP_LOGI(TAG, "  %p %7u  %-6s %s", r->addr, r->size, ext ? "PSRAM" : "SRAM", r->name);
+    }
+    ESP_LOGI(TAG, "Registered: %u bytes in SRAM, %u in PSRAM", internal, psram);
+
+    ESP_LOGI(TAG, "Sections: .data %u, .bss %u", (size_t)((uint8_t *)&_data_end - (uint8_t *)&_data_start),
+             (size_t)((uint8_t *)&_bss_end - (uint8_t *)&_bss_start));
+#if CONFIG_SPIRAM_ALLOW_BSS_SEG_EXTERNAL_MEMORY
+    ESP_LOGI(TAG, "Sections: PSRAM .bss %u",
+             (size_t)((uint8_t *)&_ext_ram_bss_end - (uint8_t *)&_ext_ram_bss_start));
+#endif
+
+    report_heap("Internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, BOOT_MEM_RESERVE_INTERNAL);
+    report_heap("PSRAM", MALLOC_CAP_SPIRAM, BOOT_MEM_RESERVE_PSRAM);
+}
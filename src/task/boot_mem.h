@@ -0,0 +1,25 @@
+#ifndef BOOT_MEM_H
+#define BOOT_MEM_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BOOT_MEM_REGIONS          24           // Static regions listed in the memory map
+
+// Heap that must still be free once booted, for the features started later
+#define BOOT_MEM_RESERVE_INTERNAL (48 * 1024)  // Console, NVS, image streaming, driver buffers
+#define BOOT_MEM_RESERVE_PSRAM    (1024 * 1024) // Decoded image cache, glyph cache, traces
+
+// Function declarations
+void boot_mem_register(const char *name, const void *addr, size_t size);
+
+void boot_mem_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_MEM_H */
@@ -0,0 +1,35 @@
+#include "esp_console.h"
+#include "esp_log.h"
+
+#include "console.h"
+#include "../display/latency.h"
+#include "../display/lvgl_heap.h"
+#include "../gui/main_view.h"
+#include "../gui/screen_mgr.h"
+
+static const char *TAG = "CONSOLE";
+
+/**
+ * @brief Start the Diagnostics Console
+ *
+ * Runs an esp_console REPL on the default console UART (the log output, not
+ * the Arduino link on UART1) with the diagnostic commands registered.
+ */
+void console_start(void)
+{
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = CONSOLE_PROMPT;
+
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_uart(&uart_config, &repl_config, &repl));
+
+    esp_console_register_help_command();
+    latency_register_console();
+    lvgl_heap_register_console();
+    main_view_register_console();
+    screen_mgr_register_console();
+
+    ESP_ERROR_CHECK(esp_console_start_repl(repl));
+    ESP_LOGI(TAG, "Console started, type 'help' for commands");
+}
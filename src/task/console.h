@@ -0,0 +1,17 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CONSOLE_PROMPT "helbur> "
+
+// Function declarations
+void console_start(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONSOLE_H */
@@ -0,0 +1,181 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "gesture.h"
+
+// Plain C without ESP-IDF dependencies, so recorded touch traces can be replayed on the host
+
+static bool emit(gesture_t *out, gesture_type_t type, int64_t time_us, int16_t x, int16_t y)
+{
+    out->type = type;
+    out->time_us = time_us;
+    out->x = x;
+    out->y = y;
+    return true;
+}
+
+// Octagonal approximation of the distance between the two points, within 8%
+static int16_t finger_distance(const gesture_input_t *in)
+{
+    int32_t dx = abs(in->x2 - in->x);
+    int32_t dy = abs(in->y2 - in->y);
+    int32_t d = dx > dy ? dx + dy / 2 : dy + dx / 2;
+    return d > INT16_MAX ? INT16_MAX : d;
+}
+
+static bool swipe(const gesture_recognizer_t *rec, int64_t time_us, gesture_t *out)
+{
+    int32_t dx = rec->last_x - rec->start_x;
+    int32_t dy = rec->last_y - rec->start_y;
+    int32_t adx = abs(dx);
+    int32_t ady = abs(dy);
+
+    if (time_us - rec->start_us > GESTURE_SWIPE_MAX_US)
+        return false;
+
+    // Mostly along one axis: the main one at least twice the other
+    if (adx >= GESTURE_SWIPE_MIN_PX && adx >= 2 * ady)
+        return emit(out, dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT, time_us, rec->start_x, rec->start_y);
+    if (ady >= GESTURE_SWIPE_MIN_PX && ady >= 2 * adx)
+        return emit(out, dy < 0 ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN, time_us, rec->start_x, rec->start_y);
+
+    return false;
+}
+
+static bool release(gesture_recognizer_t *rec, int64_t time_us, gesture_t *out)
+{
+    int64_t duration = time_us - rec->start_us;
+
+    rec->down = false;
+    if (rec->long_fired)
+        return false;
+
+    if (rec->max_points >= 2)
+    {
+        rec->tap_pending = false;
+        if (rec->pinch_start >= 0)
+        {
+            int32_t change = rec->pinch_last - rec->pinch_start;
+            if (change <= -GESTURE_PINCH_MIN_PX)
+                return emit(out, GESTURE_PINCH_IN, time_us, rec->start_x, rec->start_y);
+            if (change >= GESTURE_PINCH_MIN_PX)
+                return emit(out, GESTURE_PINCH_OUT, time_us, rec->start_x, rec->start_y);
+        }
+        if (!rec->moved && duration <= GESTURE_TAP_MAX_US)
+            return emit(out, GESTURE_TWO_FINGER_TAP, time_us, rec->start_x, rec->start_y);
+        return false;
+    }
+
+    if (rec->moved)
+    {
+        rec->tap_pending = false;
+        return swipe(rec, time_us, out);
+    }
+
+    if (duration > GESTURE_TAP_MAX_US)
+    {
+        rec->tap_pending = false;
+        return false;
+    }
+
+    // A tap; the second one close in time and place makes a double tap
+    if (rec->tap_pending && rec->start_us - rec->tap_us <= GESTURE_DOUBLE_TAP_US &&
+        abs(rec->start_x - rec->tap_x) <= 2 * GESTURE_SLOP_PX && abs(rec->start_y - rec->tap_y) <= 2 * GESTURE_SLOP_PX)
+    {
+        rec->tap_pending = false;
+        return emit(out, GESTURE_DOUBLE_TAP, time_us, rec->tap_x, rec->tap_y);
+    }
+
+    rec->tap_pending = true;
+    rec->tap_us = time_us;
+    rec->tap_x = rec->start_x;
+    rec->tap_y = rec->start_y;
+    return false;
+}
+
+void gesture_init(gesture_recognizer_t *rec)
+{
+    memset(rec, 0, sizeof(*rec));
+}
+
+/**
+ * @brief Feed One Touch Sample
+ *
+ * Streaming recogniser with constant work per sample. Pressed samples are
+ * expected at the touch report rate, so a long press fires from the sample that
+ * crosses GESTURE_LONG_PRESS_US without a timer. Single taps are left to LVGL.
+ * A pinch is measured from the moment the second finger lands to the release.
+ *
+ * @param[in,out] rec Recogniser state.
+ * @param[in] in Touch sample, points == 0 for the release.
+ * @param[out] out Recognised gesture, valid when true is returned.
+ * @return true if this sample completed a gesture.
+ */
+bool gesture_feed(gesture_recognizer_t *rec, const gesture_input_t *in, gesture_t *out)
+{
+    if (in->points == 0)
+        return rec->down ? release(rec, in->time_us, out) : false;
+
+    if (!rec->down)
+    {
+        rec->down = true;
+        rec->moved = false;
+        rec->long_fired = false;
+        rec->max_points = in->points;
+        rec->start_us = in->time_us;
+        rec->start_x = in->x;
+        rec->start_y = in->y;
+        rec->pinch_start = -1;
+    }
+    else if (in->points > rec->max_points)
+    {
+        rec->max_points = in->points;
+    }
+
+    rec->last_x = in->x;
+    rec->last_y = in->y;
+    if (in->points >= 2)
+    {
+        rec->pinch_last = finger_distance(in);
+        if (rec->pinch_start < 0)
+            rec->pinch_start = rec->pinch_last;
+    }
+    if (abs(in->x - rec->start_x) > GESTURE_SLOP_PX || abs(in->y - rec->start_y) > GESTURE_SLOP_PX)
+        rec->moved = true;
+
+    if (!rec->moved && !rec->long_fired && rec->max_points == 1 && in->time_us - rec->start_us >= GESTURE_LONG_PRESS_US)
+    {
+        rec->long_fired = true;
+        rec->tap_pending = false;
+        return emit(out, GESTURE_LONG_PRESS, in->time_us, rec->start_x, rec->start_y);
+    }
+
+    return false;
+}
+
+const char *gesture_name(gesture_type_t type)
+{
+    switch (type)
+    {
+    case GESTURE_SWIPE_LEFT:
+        return "swipe left";
+    case GESTURE_SWIPE_RIGHT:
+        return "swipe right";
+    case GESTURE_SWIPE_UP:
+        return "swipe up";
+    case GESTURE_SWIPE_DOWN:
+        return "swipe down";
+    case GESTURE_LONG_PRESS:
+        return "long press";
+    case GESTURE_DOUBLE_TAP:
+        return "double tap";
+    case GESTURE_TWO_FINGER_TAP:
+        return "two-finger tap";
+    case GESTURE_PINCH_IN:
+        return "pinch in";
+    case GESTURE_PINCH_OUT:
+        return "pinch out";
+    default:
+        return "none";
+    }
+}
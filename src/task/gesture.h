@@ -0,0 +1,77 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GESTURE_SLOP_PX           20     // Movement still counted as holding still
+#define GESTURE_SWIPE_MIN_PX      120    // Shortest swipe
+#define GESTURE_SWIPE_MAX_US      600000 // Slowest swipe
+#define GESTURE_TAP_MAX_US        250000 // Longest tap
+#define GESTURE_DOUBLE_TAP_US     350000 // Longest gap between the taps of a double tap
+#define GESTURE_LONG_PRESS_US     800000 // Hold time of a long press
+#define GESTURE_PINCH_MIN_PX      60     // Smallest change of the distance between two fingers
+
+typedef enum {
+    GESTURE_NONE = 0,
+    GESTURE_SWIPE_LEFT,
+    GESTURE_SWIPE_RIGHT,
+    GESTURE_SWIPE_UP,
+    GESTURE_SWIPE_DOWN,
+    GESTURE_LONG_PRESS,
+    GESTURE_DOUBLE_TAP,
+    GESTURE_TWO_FINGER_TAP,
+    GESTURE_PINCH_IN,
+    GESTURE_PINCH_OUT,
+} gesture_type_t;
+
+typedef struct {
+    int64_t time_us;  // Sample timestamp
+    int16_t x;        // First point, screen coordinates
+    int16_t y;
+    int16_t x2;       // Second point, valid when points >= 2
+    int16_t y2;
+    uint8_t points;   // Fingers down, 0 on release
+} gesture_input_t;
+
+typedef struct {
+    gesture_type_t type;
+    int64_t time_us;  // Time the gesture was recognised
+    int16_t x;        // Where the gesture started
+    int16_t y;
+} gesture_t;
+
+typedef struct {
+    bool down;
+    bool moved;
+    bool long_fired;
+    bool tap_pending;
+    uint8_t max_points;
+    int64_t start_us;
+    int64_t tap_us;
+    int16_t start_x;
+    int16_t start_y;
+    int16_t last_x;
+    int16_t last_y;
+    int16_t tap_x;
+    int16_t tap_y;
+    int16_t pinch_start; // Finger distance when the second finger landed, -1 if none yet
+    int16_t pinch_last;  // Last finger distance seen with two fingers down
+} gesture_recognizer_t;
+
+// Function declarations
+void gesture_init(gesture_recognizer_t *rec);
+
+bool gesture_feed(gesture_recognizer_t *rec, const gesture_input_t *in, gesture_t *out);
+
+const char *gesture_name(gesture_type_t type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GESTURE_H */
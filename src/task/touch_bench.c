@@ -0,0 +1,102 @@
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "sdkconfig.h"
+
+#include "esp_lcd_touch_gt911.h"
+#include "../display/touch_filter.h"
+#include "touch_bench.h"
+
+#define TOUCH_BENCH_DURATION_MS 5000
+
+static const char *TAG = "TOUCH_BENCH";
+
+// Touch filter (from esp32_s3.c)
+extern touch_filter_t touch_filter;
+
+static uint32_t average(uint64_t total_us, uint32_t count)
+{
+    return count ? (uint32_t)(total_us / count) : 0;
+}
+
+// CPU time of the touch task so far, from the FreeRTOS run time counter (esp_timer microseconds)
+static uint32_t touch_task_cpu_us(void)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    TaskHandle_t task = xTaskGetHandle("touch");
+    TaskStatus_t status;
+
+    if (task == NULL)
+        return 0;
+    vTaskGetInfo(task, &status, pdFALSE, eRunning);
+    return status.ulRunTimeCounter;
+#else
+    return 0;
+#endif
+}
+
+static void log_filter_stats(void)
+{
+    touch_filter_stats_t stats;
+    touch_filter_get_stats(&touch_filter, &stats);
+
+    if (stats.samples == 0 || stats.raw_jitter == 0)
+    {
+        ESP_LOGI(TAG, "Filter: no strokes, drag a finger during the run");
+        return;
+    }
+
+    // Jitter in 1/100 px per sample, lag and lead in ms at the stroke speed
+    ESP_LOGI(TAG, "Filter, %lu samples: jitter %lu -> %lu (1/100 px), reduced to %lu%%",
+             stats.samples, (uint32_t)(stats.raw_jitter * 100 / 16 / stats.samples),
+             (uint32_t)(stats.out_jitter * 100 / 16 / stats.samples), (uint32_t)(stats.out_jitter * 100 / stats.raw_jitter));
+    if (stats.speed)
+    {
+        ESP_LOGI(TAG, "Filter: smoothing lag %lums, predicted lead %lums",
+                 (uint32_t)(stats.filter_lag * 1000 / stats.speed), (uint32_t)(stats.lead * 1000 / stats.speed));
+    }
+}
+
+/**
+ * @brief Run the Touch Read Benchmark
+ *
+ * Collects the GT911 timing counters while the touch task keeps polling for
+ * TOUCH_BENCH_DURATION_MS, along with the touch filter statistics. Drag a
+ * finger during the run to include new reports and filter strokes.
+ *
+ * The CPU time of the touch task per poll compares the blocking and the
+ * asynchronous I2C bus: run it once with I2C_QUEUE_DEPTH 0 and once above.
+ * The baseline is the blocking i2c_master path, not the legacy I2C driver
+ * the board used before; the report names the mode it measured.
+ */
+void touch_bench_run(void)
+{
+    esp_lcd_touch_gt911_stats_t stats;
+
+    esp_lcd_touch_gt911_reset_stats();
+    touch_filter_reset_stats(&touch_filter);
+    uint32_t cpu_start = touch_task_cpu_us();
+    vTaskDelay(pdMS_TO_TICKS(TOUCH_BENCH_DURATION_MS));
+    uint32_t cpu_us = touch_task_cpu_us() - cpu_start;
+    esp_lcd_touch_gt911_get_stats(&stats);
+
+    if (stats.queued)
+        ESP_LOGI(TAG, "I2C: asynchronous i2c_master, %lu transfers queued", stats.queued);
+    else
+        ESP_LOGI(TAG, "I2C: blocking i2c_master (I2C_QUEUE_DEPTH 0), the baseline; not the legacy driver");
+    ESP_LOGI(TAG, "%lu polls: avg %luus, max %luus per poll, %lu errors",
+             stats.polls, average(stats.poll_us, stats.polls), stats.poll_max_us, stats.errors);
+    ESP_LOGI(TAG, "%lu burst reads: avg %luus, max %luus, avg %luus asleep",
+             stats.reads, average(stats.read_us, stats.reads), stats.read_max_us, average(stats.wait_us, stats.reads));
+    ESP_LOGI(TAG, "%lu status clears: avg %luus, max %luus", stats.clears, average(stats.clear_us, stats.clears), stats.clear_max_us);
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    ESP_LOGI(TAG, "Touch task CPU: %luus in %lums, %luus per poll", cpu_us, (uint32_t)TOUCH_BENCH_DURATION_MS,
+             average(cpu_us, stats.polls));
+#else
+    (void)cpu_us;
+    ESP_LOGI(TAG, "Touch task CPU: enable CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS");
+#endif
+    log_filter_stats();
+}
@@ -0,0 +1,15 @@
+#ifndef TOUCH_BENCH_H
+#define TOUCH_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Function declarations
+void touch_bench_run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOUCH_BENCH_H */
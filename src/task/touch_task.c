@@ -0,0 +1,348 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "touch_task.h"
+#include "boot_mem.h"
+
+
+static const char* TAG = "TOUCH";
+
+static TaskHandle_t touch_task_handle;
+static bool touch_has_int;
+
+// Static, so starting the touch task allocates nothing
+static StaticTask_t touch_task_tcb;
+static StackType_t touch_task_stack[TOUCH_TASK_STACK_SIZE];
+static StaticQueue_t gesture_queue_buf;
+static uint8_t gesture_queue_storage[TOUCH_GESTURE_QUEUE_LEN * sizeof(gesture_t)];
+
+// Gestures are recognised here, outside the LVGL task, and handed to the UI through a queue
+static gesture_recognizer_t gesture_rec;
+static QueueHandle_t gesture_queue;
+
+// Trace being recorded from the live samples, and trace replayed in their place
+static touch_trace_t *record_trace;
+static const touch_trace_t *replay_trace;
+
+// Latest points of all fingers, for multi-touch consumers outside LVGL
+static touch_point_t points[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+static uint8_t point_count;
+static portMUX_TYPE points_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Single producer (touch task), single consumer (LVGL indev) ring buffer
+static touch_sample_t queue[TOUCH_QUEUE_LEN];
+static uint32_t queue_head; // Written by the producer only
+static uint32_t queue_tail; // Written by the consumer only
+
+static void IRAM_ATTR touch_isr(esp_lcd_touch_handle_t tp)
+{
+    BaseType_t high_task_awoken = pdFALSE;
+
+    vTaskNotifyGiveFromISR(touch_task_handle, &high_task_awoken);
+    portYIELD_FROM_ISR(high_task_awoken);
+}
+
+static void queue_push(const touch_sample_t *sample)
+{
+    uint32_t head = queue_head;
+    uint32_t tail = __atomic_load_n(&queue_tail, __ATOMIC_ACQUIRE);
+
+    // Drop the oldest sample when LVGL falls behind
+    if (head - tail == TOUCH_QUEUE_LEN) {
+        uint32_t next = tail + 1;
+        __atomic_compare_exchange_n(&queue_tail, &tail, next, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    queue[head % TOUCH_QUEUE_LEN] = *sample;
+    __atomic_store_n(&queue_head, head + 1, __ATOMIC_RELEASE);
+}
+
+bool touch_task_pop(touch_sample_t *sample)
+{
+    uint32_t tail = __atomic_load_n(&queue_tail, __ATOMIC_ACQUIRE);
+
+    while (tail != __atomic_load_n(&queue_head, __ATOMIC_ACQUIRE)) {
+        *sample = queue[tail % TOUCH_QUEUE_LEN];
+        // Fails only if the producer dropped this sample meanwhile; retry with the new tail
+        if (__atomic_compare_exchange_n(&queue_tail, &tail, tail + 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool touch_task_pending(void)
+{
+    return __atomic_load_n(&queue_tail, __ATOMIC_ACQUIRE) != __atomic_load_n(&queue_head, __ATOMIC_ACQUIRE);
+}
+
+bool touch_task_pop_gesture(gesture_t *gesture)
+{
+    return gesture_queue && xQueueReceive(gesture_queue, gesture, 0) == pdTRUE;
+}
+
+/**
+ * @brief Copy the Latest Touch Points
+ *
+ * Every finger of the last report with its track ID, which stays the same
+ * while the finger stays down.
+ *
+ * @param[out] out Points, in controller order.
+ * @param[in] max Size of out.
+ * @return Number of points copied, 0 when nothing touches the panel.
+ */
+uint8_t touch_task_get_points(touch_point_t *out, uint8_t max)
+{
+    portENTER_CRITICAL(&points_lock);
+    uint8_t n = point_count < max ? point_count : max;
+    memcpy(out, points, n * sizeof(touch_point_t));
+    portEXIT_CRITICAL(&points_lock);
+
+    return n;
+}
+
+static void feed_gesture(const gesture_input_t *in)
+{
+    gesture_t gesture;
+
+    if (gesture_feed(&gesture_rec, in, &gesture)) {
+        ESP_LOGI(TAG, "Gesture: %s at (%d, %d)", gesture_name(gesture.type), gesture.x, gesture.y);
+        xQueueSend(gesture_queue, &gesture, 0);
+    }
+}
+
+/**
+ * @brief Replay a Trace
+ *
+ * Pushes the recorded samples into the LVGL queue and the gesture recogniser at
+ * their recorded pace, exactly as the live samples would be.
+ */
+static void replay(const touch_trace_t *trace)
+{
+    int64_t due = esp_timer_get_time();
+
+    ESP_LOGI(TAG, "Replaying %lu samples", trace->header.count);
+    for (uint32_t i = 0; i < trace->header.count; i++) {
+        const touch_trace_record_t *r = &trace->records[i];
+
+        due += r->dt_us;
+        int64_t wait_us = due - esp_timer_get_time();
+        if (wait_us > 0) {
+            vTaskDelay(pdMS_TO_TICKS((wait_us + 999) / 1000));
+        }
+
+        touch_sample_t sample = {
+            .time_us = esp_timer_get_time(),
+            .x = r->x,
+            .y = r->y,
+            .strength = r->strength,
+            .points = r->points,
+            .pressed = r->flags & TOUCH_TRACE_PRESSED,
+        };
+        queue_push(&sample);
+
+        // Traces hold the first point only
+        gesture_input_t in = {
+            .time_us = sample.time_us,
+            .x = sample.x,
+            .y = sample.y,
+            .x2 = sample.x,
+            .y2 = sample.y,
+            .points = sample.pressed ? sample.points : 0,
+        };
+        feed_gesture(&in);
+    }
+
+    __atomic_store_n(&replay_trace, NULL, __ATOMIC_RELEASE);
+    ESP_LOGI(TAG, "Replay done");
+}
+
+static void touch_task(void *pvParameter){
+
+    esp_lcd_touch_handle_t tp = (esp_lcd_touch_handle_t)pvParameter;
+    bool was_pressed = false;
+    bool was_touched = false;
+    // The first finger down drives the LVGL pointer until it lifts. If other fingers stay down,
+    // the pointer stays released until all of them are up, so it never jumps between fingers.
+    bool primary_down = false;
+    bool primary_lost = false;
+    uint8_t primary_id = 0;
+    touch_sample_t last = {0};
+
+    // Wait until touch_task_start has finished the interrupt setup
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    ESP_LOGI(TAG, "Starting touch task (%s)", touch_has_int ? "interrupt" : "polling");
+
+    for (;;) {
+
+        const touch_trace_t *trace = __atomic_load_n(&replay_trace, __ATOMIC_ACQUIRE);
+        if (trace) {
+            replay(trace);
+            was_pressed = false;
+            was_touched = false;
+            primary_down = false;
+            primary_lost = false;
+            continue;
+        }
+
+        if (touch_has_int) {
+            // Sleep until the GT911 signals a new report
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(was_touched ? TOUCH_POLL_PERIOD_MS : TOUCH_IDLE_POLL_MS));
+        }
+
+        if (esp_lcd_touch_read_data(tp) != ESP_OK) {
+            continue;
+        }
+
+        uint16_t x[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+        uint16_t y[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+        uint16_t strength[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+        uint8_t track_id[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+        uint8_t n = 0;
+        if (!esp_lcd_touch_get_points(tp, x, y, strength, track_id, &n, CONFIG_ESP_LCD_TOUCH_MAX_POINTS)) {
+            n = 0;
+        }
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&points_lock);
+        for (uint8_t i = 0; i < n; i++) {
+            points[i] = (touch_point_t){ .x = x[i], .y = y[i], .strength = strength[i], .track_id = track_id[i] };
+        }
+        point_count = n;
+        portEXIT_CRITICAL(&points_lock);
+
+        // Follow the primary finger by its track ID, not by its position in the report
+        uint8_t p = 0;
+        if (n == 0) {
+            primary_down = false;
+            primary_lost = false;
+        } else if (!primary_down && !primary_lost) {
+            primary_down = true;
+            primary_id = track_id[0];
+        }
+        if (primary_down) {
+            while (p < n && track_id[p] != primary_id) {
+                p++;
+            }
+            if (p == n) {
+                primary_down = false;
+                primary_lost = true;
+                p = 0;
+            }
+        }
+
+        touch_sample_t sample = last;
+        sample.time_us = now;
+        sample.points = n;
+        sample.pressed = primary_down;
+        if (primary_down) {
+            sample.x = x[p];
+            sample.y = y[p];
+            sample.strength = strength[p];
+        }
+
+        // Forward every point while pressed, and the release once
+        if (sample.pressed || was_pressed) {
+            queue_push(&sample);
+
+            touch_trace_t *rec = __atomic_load_n(&record_trace, __ATOMIC_ACQUIRE);
+            if (rec && !touch_trace_append(rec, sample.time_us, sample.x, sample.y, sample.strength, sample.points, sample.pressed)) {
+                ESP_LOGW(TAG, "Trace full, recording stopped");
+                __atomic_store_n(&record_trace, NULL, __ATOMIC_RELEASE);
+            }
+        }
+
+        // Gestures see every finger, also after the primary one has lifted
+        if (n > 0 || was_touched) {
+            uint8_t q = (p == 0 && n > 1) ? 1 : 0;
+            gesture_input_t in = {
+                .time_us = now,
+                .x = n ? x[p] : last.x,
+                .y = n ? y[p] : last.y,
+                .x2 = n ? x[q] : last.x,
+                .y2 = n ? y[q] : last.y,
+                .points = n,
+            };
+            feed_gesture(&in);
+        }
+
+        was_pressed = sample.pressed;
+        was_touched = n > 0;
+        last = sample;
+    }
+}
+
+/**
+ * @brief Start the Touch Acquisition Task
+ *
+ * Reads the controller outside the LVGL task. When the GT911 INT line is
+ * routed, the controller is only read after it signals new data; otherwise it
+ * is polled, slowly while nothing touches the panel.
+ *
+ * @param[in] tp Touch controller handle.
+ */
+void touch_task_start(esp_lcd_touch_handle_t tp){
+
+    gesture_init(&gesture_rec);
+    gesture_queue = xQueueCreateStatic(TOUCH_GESTURE_QUEUE_LEN, sizeof(gesture_t), gesture_queue_storage,
+                                       &gesture_queue_buf);
+
+    touch_task_handle = xTaskCreateStatic(touch_task, "touch", TOUCH_TASK_STACK_SIZE, tp, TOUCH_TASK_PRIORITY,
+                                          touch_task_stack, &touch_task_tcb);
+    boot_mem_register("Touch task stack", touch_task_stack, sizeof(touch_task_stack));
+
+    touch_has_int = tp->config.int_gpio_num != GPIO_NUM_NC &&
+                    esp_lcd_touch_register_interrupt_callback(tp, touch_isr) == ESP_OK;
+
+    // Start the task; with INT this also triggers a first read in case the line is already asserted
+    xTaskNotifyGive(touch_task_handle);
+}
+
+/**
+ * @brief Record the Live Samples into a Trace
+ *
+ * Records what LVGL receives: filtered, calibrated points with their timing.
+ * Recording stops on touch_task_record_stop or when the trace is full.
+ *
+ * @param[in] trace Initialized trace, appended to.
+ */
+void touch_task_record_start(touch_trace_t *trace){
+
+    __atomic_store_n(&record_trace, trace, __ATOMIC_RELEASE);
+}
+
+void touch_task_record_stop(void){
+
+    __atomic_store_n(&record_trace, NULL, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Replay a Trace in Place of the Touch Controller
+ *
+ * The controller is not read during the replay. The trace must stay valid
+ * until touch_task_replay_active returns false.
+ *
+ * @param[in] trace Trace to replay.
+ */
+void touch_task_replay_start(const touch_trace_t *trace){
+
+    __atomic_store_n(&replay_trace, trace, __ATOMIC_RELEASE);
+    // Wake the task if it waits for the GT911 interrupt
+    xTaskNotifyGive(touch_task_handle);
+}
+
+bool touch_task_replay_active(void){
+
+    return __atomic_load_n(&replay_trace, __ATOMIC_ACQUIRE) != NULL;
+}
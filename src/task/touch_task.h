@@ -0,0 +1,54 @@
+#ifndef TOUCH_TASK_H
+#define TOUCH_TASK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_lcd_touch.h"
+
+#include "gesture.h"
+#include "touch_trace.h"
+
+#define TOUCH_TASK_STACK_SIZE    (3 * 1024)
+#define TOUCH_TASK_PRIORITY      4
+#define TOUCH_QUEUE_LEN          16 // Power of two
+#define TOUCH_POLL_PERIOD_MS     10 // Polling period while touched, if INT is not routed
+#define TOUCH_IDLE_POLL_MS       50 // Polling period while released, if INT is not routed (no supported board routes it)
+#define TOUCH_INDEV_READ_PERIOD  10 // LVGL indev read period, reads only drain the queue
+#define TOUCH_GESTURE_QUEUE_LEN  4
+
+typedef struct {
+    int64_t time_us;   // Timestamp at I2C completion
+    uint16_t x;
+    uint16_t y;
+    uint16_t strength;
+    uint8_t points;    // Fingers down
+    bool pressed;      // Primary finger down
+} touch_sample_t;
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t strength;
+    uint8_t track_id;  // Stable while the finger stays down
+} touch_point_t;
+
+void touch_task_start(esp_lcd_touch_handle_t tp);
+
+bool touch_task_pop(touch_sample_t *sample);
+
+bool touch_task_pending(void);
+
+bool touch_task_pop_gesture(gesture_t *gesture);
+
+uint8_t touch_task_get_points(touch_point_t *out, uint8_t max);
+
+void touch_task_record_start(touch_trace_t *trace);
+
+void touch_task_record_stop(void);
+
+void touch_task_replay_start(const touch_trace_t *trace);
+
+bool touch_task_replay_active(void);
+
+#endif
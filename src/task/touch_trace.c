@@ -0,0 +1,187 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "touch_trace.h"
+
+// Plain C without ESP-IDF dependencies, so traces can be written and replayed by host tools
+
+#define TOUCH_TRACE_DUMP_BYTES 32 // Bytes per line of the hex dump
+
+/**
+ * @brief Initialize an Empty Trace
+ *
+ * @param[out] trace Trace.
+ * @param[in] records Storage for the samples.
+ * @param[in] capacity Number of samples that fit in records.
+ */
+void touch_trace_init(touch_trace_t *trace, touch_trace_record_t *records, uint32_t capacity)
+{
+    memset(trace, 0, sizeof(*trace));
+    trace->header.magic = TOUCH_TRACE_MAGIC;
+    trace->header.version = TOUCH_TRACE_VERSION;
+    trace->header.record_size = sizeof(touch_trace_record_t);
+    trace->records = records;
+    trace->capacity = capacity;
+}
+
+/**
+ * @brief Append a Sample
+ *
+ * @return false if the trace is full.
+ */
+bool touch_trace_append(touch_trace_t *trace, int64_t time_us, uint16_t x, uint16_t y, uint16_t strength,
+                        uint8_t points, bool pressed)
+{
+    if (trace->header.count >= trace->capacity)
+        return false;
+
+    touch_trace_record_t *r = &trace->records[trace->header.count];
+    int64_t dt = trace->header.count ? time_us - trace->last_us : 0;
+    r->dt_us = dt < 0 ? 0 : (dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt);
+    r->x = x;
+    r->y = y;
+    r->strength = strength;
+    r->points = points;
+    r->flags = pressed ? TOUCH_TRACE_PRESSED : 0;
+
+    trace->last_us = time_us;
+    trace->header.count++;
+    return true;
+}
+
+/**
+ * @brief Generate a Drag Along an Arc
+ *
+ * One finger pressed at start_deg, moved at constant speed to end_deg and
+ * released. Angles follow LVGL: 0 is to the right, growing clockwise. A
+ * drag shorter than one period still moves in one step.
+ *
+ * @return false if the trace is too small for the drag, or period_us is 0.
+ */
+bool touch_trace_make_arc_drag(touch_trace_t *trace, int16_t cx, int16_t cy, int16_t radius,
+                               int16_t start_deg, int16_t end_deg, uint32_t duration_us, uint32_t period_us)
+{
+    if (period_us == 0)
+        return false;
+
+    uint32_t steps = duration_us / period_us;
+    int64_t t = 0;
+
+    if (steps == 0)
+        steps = 1;
+
+    for (uint32_t i = 0; i <= steps; i++, t += period_us)
+    {
+        double a = (start_deg + (double)(end_deg - start_deg) * i / steps) * M_PI / 180.0;
+        uint16_t x = (uint16_t)lround(cx + radius * cos(a));
+        uint16_t y = (uint16_t)lround(cy + radius * sin(a));
+        if (!touch_trace_append(trace, t, x, y, 40, 1, true))
+            return false;
+    }
+
+    touch_trace_record_t *last = &trace->records[trace->header.count - 1];
+    return touch_trace_append(trace, t, last->x, last->y, 0, 0, false);
+}
+
+uint32_t touch_trace_duration_us(const touch_trace_t *trace)
+{
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < trace->header.count; i++)
+        total += trace->records[i].dt_us;
+    return total;
+}
+
+static void dump_bytes(const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+        printf("%02x%s", data[i], (i + 1) % TOUCH_TRACE_DUMP_BYTES == 0 || i + 1 == len ? "\n" : "");
+}
+
+/**
+ * @brief Print a Trace as Hex
+ *
+ * Header followed by the samples, between TRACE BEGIN and TRACE END lines, so
+ * it can be cut from a serial log and turned back into the binary trace.
+ */
+void touch_trace_dump(const touch_trace_t *trace)
+{
+    printf("TRACE BEGIN %lu\n", (unsigned long)trace->header.count);
+    dump_bytes((const uint8_t *)&trace->header, sizeof(trace->header));
+    dump_bytes((const uint8_t *)trace->records, trace->header.count * sizeof(touch_trace_record_t));
+    printf("TRACE END\n");
+}
+
+static int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// Bytes of a dump line, 0 for any other line (log output interleaved with the dump)
+static uint32_t parse_hex_line(const char *line, uint8_t *out, uint32_t max)
+{
+    uint32_t n = 0;
+
+    while (line[0] && line[0] != '\n' && line[0] != '\r')
+    {
+        int hi = hex_digit(line[0]);
+        int lo = hi < 0 ? -1 : hex_digit(line[1]);
+        if (lo < 0 || n == max)
+            return 0;
+        out[n++] = (uint8_t)(hi << 4 | lo);
+        line += 2;
+    }
+    return n;
+}
+
+/**
+ * @brief Read a Trace Back From its Hex Dump
+ *
+ * Skips to the next TRACE BEGIN line, so a serial log holding several dumps
+ * is read one trace per call. Lines that are not hex, such as log output
+ * printed during the dump, are ignored.
+ *
+ * @param[out] trace Trace initialised with touch_trace_init, for its storage.
+ * @param[in] f Log or dump file.
+ * @return false at the end of the file, or when the dump is malformed or
+ *         holds more samples than the trace can.
+ */
+bool touch_trace_load(touch_trace_t *trace, FILE *f)
+{
+    char line[160];
+    uint8_t bytes[TOUCH_TRACE_DUMP_BYTES];
+    uint8_t *header = (uint8_t *)&trace->header;
+    uint8_t *records = (uint8_t *)trace->records;
+    uint32_t header_len = 0;
+    uint32_t records_len = 0;
+    uint32_t capacity_len = trace->capacity * sizeof(touch_trace_record_t);
+
+    while (fgets(line, sizeof(line), f) && strncmp(line, "TRACE BEGIN", 11) != 0)
+        ;
+    if (feof(f))
+        return false;
+
+    while (fgets(line, sizeof(line), f) && strncmp(line, "TRACE END", 9) != 0)
+    {
+        uint32_t n = parse_hex_line(line, bytes, sizeof(bytes));
+        for (uint32_t i = 0; i < n; i++)
+        {
+            if (header_len < sizeof(trace->header))
+                header[header_len++] = bytes[i];
+            else if (records_len < capacity_len)
+                records[records_len++] = bytes[i];
+            else
+                return false;
+        }
+    }
+
+    return header_len == sizeof(trace->header) && trace->header.magic == TOUCH_TRACE_MAGIC &&
+           trace->header.version == TOUCH_TRACE_VERSION && trace->header.record_size == sizeof(touch_trace_record_t) &&
+           records_len == trace->header.count * sizeof(touch_trace_record_t);
+}
@@ -0,0 +1,60 @@
+#ifndef TOUCH_TRACE_H
+#define TOUCH_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOUCH_TRACE_MAGIC    0x43525454 // "TTRC"
+#define TOUCH_TRACE_VERSION  1
+
+#define TOUCH_TRACE_PRESSED  0x01
+
+// 12 bytes per sample, times are deltas so a trace replays at any start time
+typedef struct __attribute__((packed)) {
+    uint32_t dt_us;     // Time since the previous sample
+    uint16_t x;
+    uint16_t y;
+    uint16_t strength;
+    uint8_t points;     // Fingers down
+    uint8_t flags;      // TOUCH_TRACE_PRESSED
+} touch_trace_record_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t count;
+} touch_trace_header_t;
+
+typedef struct {
+    touch_trace_header_t header;
+    touch_trace_record_t *records;
+    uint32_t capacity;
+    int64_t last_us;    // Timestamp of the last appended sample
+} touch_trace_t;
+
+// Function declarations
+void touch_trace_init(touch_trace_t *trace, touch_trace_record_t *records, uint32_t capacity);
+
+bool touch_trace_append(touch_trace_t *trace, int64_t time_us, uint16_t x, uint16_t y, uint16_t strength,
+                        uint8_t points, bool pressed);
+
+bool touch_trace_make_arc_drag(touch_trace_t *trace, int16_t cx, int16_t cy, int16_t radius,
+                               int16_t start_deg, int16_t end_deg, uint32_t duration_us, uint32_t period_us);
+
+uint32_t touch_trace_duration_us(const touch_trace_t *trace);
+
+void touch_trace_dump(const touch_trace_t *trace);
+
+bool touch_trace_load(touch_trace_t *trace, FILE *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOUCH_TRACE_H */
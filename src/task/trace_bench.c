@@ -0,0 +1,123 @@
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "touch_task.h"
+#include "trace_bench.h"
+
+#define TRACE_BENCH_RUNS        3
+#define TRACE_BENCH_DRAG_US     1500000 // Canned drag along the whole arc
+#define TRACE_BENCH_SETTLE_MS   300     // Let the last frames flush after the release
+#define TRACE_BENCH_MAX_SAMPLES 1024    // Recording capacity, 12 KB
+
+static const char *TAG = "TRACE_BENCH";
+
+// LVGL mutex (from esp32_s3.c)
+extern SemaphoreHandle_t lvgl_mux;
+
+static struct {
+    uint32_t frames;
+    uint32_t total_ms;
+    uint32_t max_ms;
+    uint32_t commands;
+} bench;
+
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time, uint32_t px)
+{
+    bench.frames++;
+    bench.total_ms += time;
+    bench.max_ms = LV_MAX(bench.max_ms, time);
+}
+
+static void value_changed_cb(lv_event_t *e)
+{
+    // Each value change sends one WEIGHT command to the Arduino
+    bench.commands++;
+}
+
+/**
+ * @brief Run the Touch Replay Benchmark
+ *
+ * Replays the same canned drag along the arc TRACE_BENCH_RUNS times and logs
+ * the frame count and times LVGL reports, and the rate of value changes (one
+ * UART command each), so runs can be compared across builds.
+ *
+ * @param[in] arc Arc to drag, e.g. kg_slider; must be visible.
+ */
+void trace_bench_run(lv_obj_t *arc)
+{
+    static touch_trace_record_t records[TRACE_BENCH_DRAG_US / (TOUCH_POLL_PERIOD_MS * 1000) + 2];
+    touch_trace_t trace;
+
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    lv_disp_t *disp = lv_obj_get_disp(arc);
+    lv_area_t coords;
+    lv_obj_get_coords(arc, &coords);
+    lv_coord_t radius = lv_area_get_width(&coords) / 2 - lv_obj_get_style_arc_width(arc, LV_PART_MAIN) / 2;
+    lv_coord_t cx = coords.x1 + lv_area_get_width(&coords) / 2;
+    lv_coord_t cy = coords.y1 + lv_area_get_height(&coords) / 2;
+    void (*prev_monitor_cb)(lv_disp_drv_t *, uint32_t, uint32_t) = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = monitor_cb;
+    lv_obj_add_event_cb(arc, value_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    xSemaphoreGiveRecursive(lvgl_mux);
+
+    // From the start to the end of the arc's background, at the touch report rate
+    touch_trace_init(&trace, records, sizeof(records) / sizeof(records[0]));
+    touch_trace_make_arc_drag(&trace, cx, cy, radius, 135, 405, TRACE_BENCH_DRAG_US, TOUCH_POLL_PERIOD_MS * 1000);
+
+    for (int run = 0; run < TRACE_BENCH_RUNS; run++)
+    {
+        memset(&bench, 0, sizeof(bench));
+        touch_task_replay_start(&trace);
+        while (touch_task_replay_active())
+            vTaskDelay(pdMS_TO_TICKS(50));
+        vTaskDelay(pdMS_TO_TICKS(TRACE_BENCH_SETTLE_MS));
+
+        uint32_t seconds_x100 = (touch_trace_duration_us(&trace) + TRACE_BENCH_SETTLE_MS * 1000) / 10000;
+        ESP_LOGI(TAG, "Run %d: %lu frames, avg %lums, max %lums per frame, %lu commands (%lu/s)",
+                 run + 1, bench.frames, bench.frames ? bench.total_ms / bench.frames : 0, bench.max_ms,
+                 bench.commands, bench.commands * 100 / seconds_x100);
+    }
+
+    xSemaphoreTakeRecursive(lvgl_mux, portMAX_DELAY);
+    lv_obj_remove_event_cb(arc, value_changed_cb);
+    disp->driver->monitor_cb = prev_monitor_cb;
+    xSemaphoreGiveRecursive(lvgl_mux);
+}
+
+/**
+ * @brief Record a Touch Trace
+ *
+ * Records the live touch samples for duration_ms and prints the trace as hex
+ * (see touch_trace_dump) to be kept as a canned interaction.
+ *
+ * @param[in] duration_ms Recording time.
+ */
+void trace_bench_record(uint32_t duration_ms)
+{
+    touch_trace_record_t *records = heap_caps_malloc(TRACE_BENCH_MAX_SAMPLES * sizeof(*records), MALLOC_CAP_SPIRAM);
+    touch_trace_t trace;
+
+    if (records == NULL)
+    {
+        ESP_LOGE(TAG, "No memory for the trace");
+        return;
+    }
+
+    touch_trace_init(&trace, records, TRACE_BENCH_MAX_SAMPLES);
+    ESP_LOGI(TAG, "Recording touch for %lums", duration_ms);
+    touch_task_record_start(&trace);
+    vTaskDelay(pdMS_TO_TICKS(duration_ms));
+    touch_task_record_stop();
+    // Let a sample being appended land before the trace is read
+    vTaskDelay(pdMS_TO_TICKS(2 * TOUCH_POLL_PERIOD_MS));
+
+    ESP_LOGI(TAG, "Recorded %lu samples", trace.header.count);
+    touch_trace_dump(&trace);
+    heap_caps_free(records);
+}
@@ -0,0 +1,19 @@
+#ifndef TRACE_BENCH_H
+#define TRACE_BENCH_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Function declarations
+void trace_bench_run(lv_obj_t *arc);
+
+void trace_bench_record(uint32_t duration_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_BENCH_H */
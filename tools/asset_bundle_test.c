@@ -0,0 +1,196 @@
+/*
+ * Host check of an asset bundle and of the fonts attached to it.
+ *
+ * Opens a bundle packed by tools/asset_pipeline.py, verifies every asset and
+ * that a flipped byte is caught, then attaches the bundled fonts the way
+ * asset_bundle_mount does. Each font must match the size and CRC-32 in
+ * src/fonts/font_bundle.h, draw nothing before it is attached, and after it
+ * draw every glyph from inside its bundle entry. The 72 px font is compared
+ * glyph by glyph with the compiled-in subset it replaces:
+ *
+ *   python tools/asset_pipeline.py --force
+ *   cc -O2 -Itools/host -Isrc -Isrc/display tools/asset_bundle_test.c src/display/asset_bundle.c \
+ *      src/fonts/bundled/lv_font_montserrat_72.c tools/host/lvgl_host.c -o asset_bundle_test
+ *   ./asset_bundle_test assets.bin
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "asset_bundle.h"
+
+// The subset as compiled in without the bundle, under another name than the bundled copy's; before
+// font_bundle.h, which disables it
+#define lv_font_montserrat_72 compiled_montserrat_72
+#include "fonts/lv_font_montserrat_72.c"
+#undef lv_font_montserrat_72
+#undef FONT_SUBSET_MONTSERRAT_72
+
+#include "fonts/font_bundle.h"
+
+extern const lv_font_t lv_font_montserrat_72;
+
+#define FONT_BUNDLE_FONT(font, size, crc) {#font, &font, size, crc},
+static const struct {
+    const char *name;
+    const lv_font_t *font;
+    uint32_t size;
+    uint32_t crc;
+} fonts[] = {FONT_BUNDLE_FONTS{NULL, NULL, 0, 0}};
+
+static int failed;
+
+static void expect(bool ok, const char *what, const char *name)
+{
+    printf("%-4s %s: %s\n", ok ? "ok" : "FAIL", name, what);
+    failed += !ok;
+}
+
+static uint8_t *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(*len);
+    if (data == NULL || fread(data, 1, *len, f) != *len)
+    {
+        fprintf(stderr, "%s: read failed\n", path);
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static size_t glyph_bytes(const lv_font_glyph_dsc_t *g)
+{
+    return ((size_t)g->box_w * g->box_h * g->bpp + 7) / 8;
+}
+
+// Every glyph of the font is drawn from inside the entry; returns the number of glyphs
+static uint32_t check_glyphs(const asset_bundle_t *bundle, int i, const lv_font_t *font, const char *name)
+{
+    const uint8_t *start = bundle->base + bundle->index[i].offset;
+    const uint8_t *end = start + bundle->index[i].size;
+    uint32_t glyphs = 0;
+
+    for (uint32_t letter = 0; letter <= 0xFFFF; letter++)
+    {
+        lv_font_glyph_dsc_t g;
+        if (!lv_font_get_glyph_dsc(font, &g, letter, 0))
+            continue;
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, letter);
+        if (bitmap == NULL || bitmap < start || bitmap + glyph_bytes(&g) > end)
+        {
+            printf("FAIL %s: glyph U+%04X outside its bundle entry\n", name, letter);
+            failed++;
+            return glyphs;
+        }
+        glyphs++;
+    }
+    return glyphs;
+}
+
+static void check_same_as_compiled(const lv_font_t *bundled, const lv_font_t *compiled, const char *name)
+{
+    uint32_t glyphs = 0;
+    bool same = true;
+
+    for (uint32_t letter = 0; letter <= 0xFFFF && same; letter++)
+    {
+        lv_font_glyph_dsc_t g, c;
+        bool has = lv_font_get_glyph_dsc(bundled, &g, letter, 0);
+        if (has != lv_font_get_glyph_dsc(compiled, &c, letter, 0))
+            same = false;
+        else if (has)
+        {
+            same = g.adv_w == c.adv_w && g.box_w == c.box_w && g.box_h == c.box_h && g.ofs_x == c.ofs_x &&
+                   g.ofs_y == c.ofs_y && g.bpp == c.bpp &&
+                   memcmp(lv_font_get_glyph_bitmap(bundled, letter), lv_font_get_glyph_bitmap(compiled, letter),
+                          glyph_bytes(&g)) == 0;
+            glyphs++;
+        }
+    }
+    char what[64];
+    snprintf(what, sizeof(what), "%u glyphs drawn as by the compiled-in subset", glyphs);
+    expect(same && glyphs > 0, what, name);
+}
+
+static void check_fonts(const asset_bundle_t *bundle)
+{
+    for (int f = 0; fonts[f].name; f++)
+    {
+        const char *name = fonts[f].name;
+        int i = asset_bundle_find(bundle, name);
+        if (i < 0)
+        {
+            expect(false, "in the bundle", name);
+            continue;
+        }
+        const asset_bundle_entry_t *entry = &bundle->index[i];
+        expect(entry->type == ASSET_TYPE_FONT && entry->size == fonts[f].size && entry->crc == fonts[f].crc,
+               "entry matches the size and CRC-32 the firmware was built for", name);
+        expect(lv_font_get_glyph_bitmap(fonts[f].font, '0') == NULL, "nothing drawn before it is attached", name);
+        expect(asset_bundle_attach_font(bundle, i, fonts[f].font), "attached", name);
+
+        char what[64];
+        snprintf(what, sizeof(what), "%u glyphs drawn from the entry", check_glyphs(bundle, i, fonts[f].font, name));
+        expect(true, what, name);
+    }
+
+    int i = asset_bundle_find(bundle, "lv_font_montserrat_72");
+    if (i >= 0)
+    {
+        check_same_as_compiled(&lv_font_montserrat_72, &compiled_montserrat_72, "lv_font_montserrat_72");
+        expect(!asset_bundle_attach_font(bundle, i, &compiled_montserrat_72),
+               "compiled-in subset, const, not attached", "lv_font_montserrat_72");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "assets.bin";
+    size_t len;
+    uint8_t *data = read_file(path, &len);
+    if (data == NULL)
+        return 1;
+
+    asset_bundle_t bundle;
+    if (!asset_bundle_open(&bundle, data, len))
+    {
+        fprintf(stderr, "%s: not a valid asset bundle\n", path);
+        return 1;
+    }
+    for (int i = 0; i < bundle.count; i++)
+    {
+        const asset_bundle_entry_t *entry = &bundle.index[i];
+        char name[ASSET_BUNDLE_NAME_LEN + 1] = {0};
+        memcpy(name, entry->name, ASSET_BUNDLE_NAME_LEN);
+        expect(asset_bundle_verify(&bundle, i), entry->type == ASSET_TYPE_FONT ? "font verified" : "image verified",
+               name);
+
+        // A flipped byte of the data, then of the index, is caught
+        uint8_t *byte = data + entry->offset + entry->size / 2;
+        *byte ^= 0x01;
+        expect(!asset_bundle_verify(&bundle, i), "flipped data byte rejected", name);
+        *byte ^= 0x01;
+    }
+    asset_bundle_t corrupt;
+    data[sizeof(asset_bundle_header_t) + 1] ^= 0x01;
+    expect(!asset_bundle_open(&corrupt, data, len), "flipped index byte rejected", path);
+    data[sizeof(asset_bundle_header_t) + 1] ^= 0x01;
+
+    check_fonts(&bundle);
+
+    printf("%d checks failed\n", failed);
+    free(data);
+    return failed ? 1 : 0;
+}
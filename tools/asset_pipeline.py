@@ -0,0 +1,607 @@
+"""Image asset pipeline.
+
+Generates display-ready LVGL images from the converter output in src/.
+Every asset is declared in src/assets.json:
+
+    {
+      "assets": [
+        {
+          "name": "helbur_small_opaque",   # C symbol and output file name
+          "source": "helbur_small.c",      # LVGL image converter output
+          "width": 176, "height": 30,      # final size on screen (optional)
+          "background": "0x223A44"         # pre-blend colour (optional)
+        }
+      ]
+    }
+
+Sources must be LV_IMG_CF_RGB565A8 or LV_IMG_CF_TRUE_COLOR (16 bit).
+The image is resampled (bilinear, premultiplied alpha) to its final size.
+When a background is given, it is blended onto that colour and emitted as
+opaque LV_IMG_CF_TRUE_COLOR, so LVGL draws it with a plain copy instead of
+a transformed, alpha-blended blit. Otherwise the alpha plane is kept.
+
+Assets marked "bundle": true are not compiled into the app. They are packed
+into the asset bundle named by the top-level "bundle" key, which is written
+to the "assets" data partition (partitions.csv) and mapped at runtime by
+src/display/asset_bundle_partition.c. Changing them only needs the bundle
+flashed again (pio run -t upload_assets), not a new firmware:
+
+    {
+      "bundle": "assets.bin",
+      "assets": [ {"name": "helbur_splash_opaque", ..., "bundle": true} ]
+    }
+
+The bundle is a header, an index of fixed size entries, then the data of
+every asset aligned to 16 bytes; the layout is defined in
+src/display/asset_bundle.h.
+
+The glyph bitmaps of a font subset from tools/font_subset.py can be bundled
+too, by naming the subset's source instead of an image:
+
+    {"name": "lv_font_montserrat_72", "font": "fonts/lv_font_montserrat_72.c", "bundle": true}
+
+The rest of the font, its glyph descriptors, character maps and kerning, is
+small and stays in the app: the font is compiled from a copy written to
+src/fonts/bundled/ without the glyph_bitmap array, whose descriptor is in RAM
+so that asset_bundle_mount can point it into the mapped bundle. The generated
+src/fonts/font_bundle.h, included by lv_conf.h, disables the subset the copy
+replaces and records the bitmap size and CRC-32 the copy was built for; a
+bundle holding other glyphs is not attached. Run after tools/font_subset.py,
+which may regenerate the subsets.
+
+Images are compressed, bundled or compiled in, with the codec chosen per
+image: "compress" is "auto" (default, the smaller of RLE and LZ4, or none
+when that saves less than 10%), "rle", "lz4" or "none". Compressed images
+are emitted as LV_IMG_CF_RAW (opaque) or LV_IMG_CF_RAW_ALPHA and drawn by
+src/display/img_decoder.c, which streams rows from bands of 8 rows or serves
+them from its decoded cache; the layout is defined in src/display/img_codec.h.
+RLE stores runs of whole pixels and is the cheaper one to decode, LZ4 also
+catches repeated patterns. tools/img_codec_bench.c times the decoders on the
+host.
+
+Run standalone (python tools/asset_pipeline.py) or as a PlatformIO
+pre-script (extra_scripts = pre:tools/asset_pipeline.py). Outputs are only
+rewritten when the manifest or a source is newer.
+"""
+
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+if "__file__" in globals():
+    ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+else:
+    ROOT = os.getcwd()  # PlatformIO runs pre-scripts from the project directory
+SCRIPT = os.path.join(ROOT, "tools", "asset_pipeline.py")
+SRC_DIR = os.path.join(ROOT, "src")
+MANIFEST = os.path.join(SRC_DIR, "assets.json")
+
+PARTITIONS = os.path.join(ROOT, "partitions.csv")
+
+BUNDLE_MAGIC = 0x54534148  # "HAST"
+BUNDLE_VERSION = 1
+BUNDLE_ALIGN = 16
+BUNDLE_NAME_LEN = 28
+BUNDLE_HEADER = struct.Struct("<IHHII")
+BUNDLE_ENTRY = struct.Struct("<%dsIIIBBHHH" % BUNDLE_NAME_LEN)
+ASSET_TYPE_IMAGE = 1
+ASSET_TYPE_FONT = 2
+LV_IMG_CF = {"LV_IMG_CF_RAW": 1, "LV_IMG_CF_RAW_ALPHA": 2, "LV_IMG_CF_TRUE_COLOR": 4, "LV_IMG_CF_RGB565A8": 20}
+
+CODEC_MAGIC = 0x5A4D4948  # "HIMZ"
+CODEC_HEADER = struct.Struct("<IBBHHH")
+CODECS = {"rle": 1, "lz4": 2}  # In order of preference, RLE decodes faster
+CODEC_BLOCK_ROWS = 8
+COMPRESS_MIN_SAVING = 10  # Percent, below it the image is drawn uncompressed
+
+MAP_RE = re.compile(r"uint8_t\s+(\w+)_map\[\]\s*=\s*\{(.*?)\};", re.S)
+HEADER_RE = re.compile(r"\.header\.(cf|w|h)\s*=\s*(\w+)")
+
+FONT_DIR = os.path.join(SRC_DIR, "fonts")
+BUNDLED_FONT_DIR = os.path.join(FONT_DIR, "bundled")
+FONT_BUNDLE_HEADER = os.path.join(FONT_DIR, "font_bundle.h")
+GLYPH_BITMAP_RE = re.compile(r"(/\*Store the image of the glyphs\*/\n)?static[^;{]*\bglyph_bitmap\[\]\s*=\s*\{(.*?)\};\n", re.S)
+FONT_DSC_RE = re.compile(r"#if [^\n]*\nstatic const lv_font_fmt_txt_dsc_t font_dsc = \{\n#else\n"
+                         r"static lv_font_fmt_txt_dsc_t font_dsc = \{\n#endif\n")
+FONT_GUARD_RE = re.compile(r"^#if (\w+)$", re.M)
+FONT_BPP_RE = re.compile(r"\.bpp = (\d+),")
+
+
+class Image:
+    """Straight (non-premultiplied) RGB888 + alpha image."""
+
+    def __init__(self, width, height, rgb, alpha):
+        self.width = width
+        self.height = height
+        self.rgb = rgb
+        self.alpha = alpha
+
+
+def rgb565_to_rgb888(value):
+    r = (value >> 11) & 0x1F
+    g = (value >> 5) & 0x3F
+    b = value & 0x1F
+    return ((r * 255 + 15) // 31, (g * 255 + 31) // 63, (b * 255 + 15) // 31)
+
+
+def rgb888_to_rgb565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def load_source(path):
+    with open(path) as f:
+        text = f.read()
+
+    match = MAP_RE.search(text)
+    if not match:
+        raise ValueError("%s: no image map found" % path)
+    data = bytes(int(tok, 16) for tok in re.findall(r"0x[0-9a-fA-F]+", match.group(2)))
+
+    header = dict(HEADER_RE.findall(text))
+    cf = header["cf"]
+    width = int(header["w"])
+    height = int(header["h"])
+    count = width * height
+
+    rgb = []
+    for i in range(count):
+        rgb.append(rgb565_to_rgb888(data[2 * i] | data[2 * i + 1] << 8))
+
+    if cf == "LV_IMG_CF_RGB565A8":
+        alpha = list(data[2 * count:3 * count])
+    elif cf == "LV_IMG_CF_TRUE_COLOR":
+        alpha = [255] * count
+    else:
+        raise ValueError("%s: unsupported colour format %s" % (path, cf))
+
+    return Image(width, height, rgb, alpha)
+
+
+def resample(img, width, height):
+    """Bilinear resampling on premultiplied alpha, sampling pixel centres."""
+    if (width, height) == (img.width, img.height):
+        return img
+
+    def premul(i):
+        a = img.alpha[i]
+        r, g, b = img.rgb[i]
+        return (r * a, g * a, b * a, a)
+
+    src = [premul(i) for i in range(img.width * img.height)]
+    rgb = []
+    alpha = []
+    for dy in range(height):
+        sy = max(0.0, min(img.height - 1.0, (dy + 0.5) * img.height / height - 0.5))
+        y0 = int(sy)
+        y1 = min(y0 + 1, img.height - 1)
+        fy = sy - y0
+        for dx in range(width):
+            sx = max(0.0, min(img.width - 1.0, (dx + 0.5) * img.width / width - 0.5))
+            x0 = int(sx)
+            x1 = min(x0 + 1, img.width - 1)
+            fx = sx - x0
+
+            p00 = src[y0 * img.width + x0]
+            p01 = src[y0 * img.width + x1]
+            p10 = src[y1 * img.width + x0]
+            p11 = src[y1 * img.width + x1]
+            acc = [
+                (p00[c] * (1 - fx) + p01[c] * fx) * (1 - fy) + (p10[c] * (1 - fx) + p11[c] * fx) * fy
+                for c in range(4)
+            ]
+
+            a = acc[3]
+            if a <= 0:
+                rgb.append((0, 0, 0))
+                alpha.append(0)
+            else:
+                rgb.append(tuple(min(255, int(acc[c] / a + 0.5)) for c in range(3)))
+                alpha.append(min(255, int(a + 0.5)))
+
+    return Image(width, height, rgb, alpha)
+
+
+def encode(img, background):
+    """Return (colour format, bytes) for the LVGL image descriptor."""
+    out = bytearray()
+    if background is None:
+        for r, g, b in img.rgb:
+            value = rgb888_to_rgb565(r, g, b)
+            out += bytes((value & 0xFF, value >> 8))
+        out += bytes(img.alpha)
+        return "LV_IMG_CF_RGB565A8", out
+
+    bg = ((background >> 16) & 0xFF, (background >> 8) & 0xFF, background & 0xFF)
+    for (r, g, b), a in zip(img.rgb, img.alpha):
+        mixed = [(c * a + k * (255 - a) + 127) // 255 for c, k in zip((r, g, b), bg)]
+        value = rgb888_to_rgb565(*mixed)
+        out += bytes((value & 0xFF, value >> 8))
+    return "LV_IMG_CF_TRUE_COLOR", out
+
+
+def line_format(width, height, cf, data):
+    """Pixel size and pixels as LVGL reads them line by line: RGB565, or RGB565 then alpha."""
+    if cf == "LV_IMG_CF_TRUE_COLOR":
+        return 2, bytes(data)
+    count = width * height
+    out = bytearray()
+    for i in range(count):
+        out += data[2 * i:2 * i + 2]
+        out.append(data[2 * count + i])
+    return 3, bytes(out)
+
+
+def rle_compress(data, px_size):
+    """Control byte c: bit 7 set is one pixel repeated (c & 0x7f) + 1 times, else c + 1 literal pixels."""
+    pixels = [data[i:i + px_size] for i in range(0, len(data), px_size)]
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run > 1:
+            out.append(0x80 | (run - 1))
+            out += pixels[i]
+            i += run
+            continue
+        count = 1
+        while (i + count < len(pixels) and count < 128 and
+               not (i + count + 1 < len(pixels) and pixels[i + count] == pixels[i + count + 1])):
+            count += 1
+        out.append(count - 1)
+        out += b"".join(pixels[i:i + count])
+        i += count
+    return bytes(out)
+
+
+def lz4_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def lz4_compress(data):
+    """Greedy LZ4 block format, following the end of block rules of the specification."""
+    n = len(data)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    while i < n - 12:
+        key = data[i:i + 4]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > 0xFFFF:
+            i += 1
+            continue
+
+        match = 4
+        while i + match < n - 5 and data[candidate + match] == data[i + match]:
+            match += 1
+        while i > anchor and candidate > 0 and data[i - 1] == data[candidate - 1]:
+            i -= 1
+            candidate -= 1
+            match += 1
+
+        literals = i - anchor
+        out.append(min(literals, 15) << 4 | min(match - 4, 15))
+        if literals >= 15:
+            lz4_length(out, literals - 15)
+        out += data[anchor:i]
+        out += struct.pack("<H", i - candidate)
+        if match - 4 >= 15:
+            lz4_length(out, match - 4 - 15)
+        i += match
+        anchor = i
+
+    literals = n - anchor
+    out.append(min(literals, 15) << 4)
+    if literals >= 15:
+        lz4_length(out, literals - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def compress(width, height, cf, data, mode):
+    """Return (colour format, bytes, codec) with the encoding chosen by mode, codec None when uncompressed."""
+    if mode == "none":
+        return cf, data, None
+    if mode != "auto" and mode not in CODECS:
+        raise ValueError("unknown compression %s" % mode)
+
+    px_size, pixels = line_format(width, height, cf, data)
+    row = width * px_size
+    candidates = []
+    for codec in CODECS:
+        if mode not in ("auto", codec):
+            continue
+        blocks = []
+        for y in range(0, height, CODEC_BLOCK_ROWS):
+            band = pixels[y * row:min(height, y + CODEC_BLOCK_ROWS) * row]
+            blocks.append(rle_compress(band, px_size) if codec == "rle" else lz4_compress(band))
+        offsets = [0]
+        for block in blocks:
+            offsets.append(offsets[-1] + len(block))
+        out = (CODEC_HEADER.pack(CODEC_MAGIC, CODECS[codec], px_size, CODEC_BLOCK_ROWS, width, height) +
+               struct.pack("<%dI" % len(offsets), *offsets) + b"".join(blocks))
+        candidates.append((len(out), codec, out))
+
+    size, codec, out = min(candidates, key=lambda candidate: candidate[0])
+    if mode == "auto" and size * 100 > len(data) * (100 - COMPRESS_MIN_SAVING):
+        return cf, data, None
+    return ("LV_IMG_CF_RAW" if px_size == 2 else "LV_IMG_CF_RAW_ALPHA"), out, codec
+
+
+def write_asset(name, img, cf, data, source):
+    guard = name.upper()
+    # Compressed data has no rows, wrap it like the LVGL converter does
+    bytes_per_row = 32 if cf in ("LV_IMG_CF_RAW", "LV_IMG_CF_RAW_ALPHA") else len(data) // img.height
+    rows = []
+    for start in range(0, len(data), bytes_per_row):
+        row = data[start:start + bytes_per_row]
+        rows.append("  " + ", ".join("0x%02x" % b for b in row) + ",")
+
+    c_text = """/* Generated by tools/asset_pipeline.py from src/assets.json ({source}) - do not edit */
+
+#include "lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_{guard}
+#define LV_ATTRIBUTE_IMG_{guard}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_{guard} uint8_t {name}_map[] = {{
+{rows}
+}};
+
+const lv_img_dsc_t {name} = {{
+  .header.cf = {cf},
+  .header.always_zero = 0,
+  .header.reserved = 0,
+  .header.w = {w},
+  .header.h = {h},
+  .data_size = {size},
+  .data = {name}_map,
+}};
+""".format(source=source, guard=guard, name=name, rows="\n".join(rows), cf=cf,
+           w=img.width, h=img.height, size=len(data))
+
+    h_text = """/* Generated by tools/asset_pipeline.py from src/assets.json ({source}) - do not edit */
+
+#ifndef {guard}_H
+#define {guard}_H
+
+#include <lvgl.h>
+
+extern const lv_img_dsc_t {name};
+
+#endif /* {guard}_H */
+""".format(source=source, guard=guard, name=name)
+
+    with open(os.path.join(SRC_DIR, name + ".c"), "w") as f:
+        f.write(c_text)
+    with open(os.path.join(SRC_DIR, name + ".h"), "w") as f:
+        f.write(h_text)
+
+
+def bundle_font(name, path):
+    """Return (bpp, glyph bitmap, C source of the font without it, guard of the subset it replaces)."""
+    with open(path) as f:
+        text = f.read()
+
+    match = GLYPH_BITMAP_RE.search(text)
+    guard = FONT_GUARD_RE.search(text)
+    bpp = FONT_BPP_RE.search(text)
+    if not match or not guard or not bpp:
+        raise ValueError("%s: not an LVGL font source" % path)
+    body = re.sub(r"/\*.*?\*/", "", match.group(2), flags=re.S)
+    bitmap = bytes(int(tok, 0) for tok in re.findall(r"0x[0-9a-fA-F]+|\d+", body))
+
+    source = os.path.relpath(path, ROOT).replace(os.sep, "/")
+    out = text[:match.start()] + "/*The glyph bitmaps are in the asset bundle*/\n" + text[match.end():]
+    out, dsc = FONT_DSC_RE.subn("/*In RAM: asset_bundle_mount points glyph_bitmap into the mapped bundle*/\n"
+                                "static lv_font_fmt_txt_dsc_t font_dsc = {\n", out)
+    out, bitmap_ref = re.subn(r"\.glyph_bitmap = glyph_bitmap,", ".glyph_bitmap = NULL,", out)
+    out, get = re.subn(r"\.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt, ",
+                       ".get_glyph_bitmap = asset_bundle_font_bitmap,", out)
+    out, include = re.subn(r'#include "lvgl.h"\n', '#include "lvgl.h"\n#include "display/asset_bundle.h"\n', out, 1)
+    if not (dsc and bitmap_ref and get and include):
+        raise ValueError("%s: unexpected font source layout, cannot bundle its glyphs" % path)
+    out = re.sub(r"\b%s\b" % guard.group(1), "FONT_BUNDLED_" + name[len("lv_font_"):].upper(), out)
+    out = re.sub(r"\A/\* Generated by [^\n]*\*/\n\n", "", out)
+    out = "/* Generated by tools/asset_pipeline.py from %s - do not edit */\n\n%s" % (source, out)
+    return int(bpp.group(1)), bitmap, out, guard.group(1)
+
+
+def write_if_changed(path, text):
+    """Keep the mtime, and a clean tree, when the output is the same."""
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == text:
+                return False
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def write_font_bundle(fonts):
+    """Copies of the bundled fonts in src/fonts/bundled/ and src/fonts/font_bundle.h; fonts is a list of
+    (name, glyph bitmap, C source, guard)."""
+    names = set(name for name, _, _, _ in fonts)
+    if os.path.isdir(BUNDLED_FONT_DIR):
+        for file in os.listdir(BUNDLED_FONT_DIR):
+            if file.endswith(".c") and file[:-2] not in names:
+                os.remove(os.path.join(BUNDLED_FONT_DIR, file))
+    for name, _, text, _ in fonts:
+        write_if_changed(os.path.join(BUNDLED_FONT_DIR, name + ".c"), text)
+
+    guards = "".join("#define %s 0\n" % guard for _, _, _, guard in fonts)
+    table = "".join("    FONT_BUNDLE_FONT(%s, %d, 0x%08x) \\\n" % (name, len(bitmap), zlib.crc32(bitmap))
+                    for name, bitmap, _, _ in fonts)
+    write_if_changed(FONT_BUNDLE_HEADER, """/* Generated by tools/asset_pipeline.py from src/assets.json - do not edit */
+
+#ifndef FONT_BUNDLE_H
+#define FONT_BUNDLE_H
+
+/* Subsets whose glyph bitmaps are in the asset bundle, compiled from src/fonts/bundled/ instead */
+{guards}
+/* Font, glyph bitmap bytes and CRC-32 the bundle must hold for it */
+#define FONT_BUNDLE_FONTS \\
+{table}
+#endif /* FONT_BUNDLE_H */
+""".format(guards=guards, table=table))
+
+
+def pack_bundle(path, assets):
+    """Write the asset bundle; assets is a list of (name, type, width, height, cf or bpp, bytes)."""
+    offset = BUNDLE_HEADER.size + BUNDLE_ENTRY.size * len(assets)
+    entries = []
+    blobs = []
+    for name, kind, width, height, cf, data in assets:
+        if len(name.encode()) > BUNDLE_NAME_LEN:
+            raise ValueError("%s: asset name longer than %d bytes" % (name, BUNDLE_NAME_LEN))
+        offset = (offset + BUNDLE_ALIGN - 1) // BUNDLE_ALIGN * BUNDLE_ALIGN
+        entries.append(BUNDLE_ENTRY.pack(name.encode(), offset, len(data), zlib.crc32(data),
+                                         kind, cf, width, height, 0))
+        blobs.append((offset, data))
+        offset += len(data)
+
+    index = b"".join(entries)
+    out = bytearray(offset)
+    out[:BUNDLE_HEADER.size] = BUNDLE_HEADER.pack(BUNDLE_MAGIC, BUNDLE_VERSION, len(assets), offset, zlib.crc32(index))
+    out[BUNDLE_HEADER.size:BUNDLE_HEADER.size + len(index)] = index
+    for start, data in blobs:
+        out[start:start + len(data)] = data
+
+    with open(path, "wb") as f:
+        f.write(out)
+    return len(out)
+
+
+def partition_offset(name):
+    """Offset and size of a partition in partitions.csv."""
+    with open(PARTITIONS) as f:
+        for line in f:
+            fields = [field.strip() for field in line.split("#")[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return int(fields[3], 0), int(fields[4], 0)
+    raise ValueError("no %s partition in %s" % (name, PARTITIONS))
+
+
+def remove_compiled(name):
+    """A bundled asset must not be linked into the app as well."""
+    for ext in (".c", ".h"):
+        path = os.path.join(SRC_DIR, name + ext)
+        if os.path.exists(path):
+            os.remove(path)
+
+
+def is_outdated(output, inputs):
+    if not os.path.exists(output):
+        return True
+    stamp = os.path.getmtime(output)
+    return any(os.path.getmtime(path) > stamp for path in inputs)
+
+
+def main(argv):
+    force = "--force" in argv
+
+    with open(MANIFEST) as f:
+        manifest = json.load(f)
+
+    bundled = [asset for asset in manifest["assets"] if asset.get("bundle")]
+    bundle_path = os.path.join(ROOT, manifest.get("bundle", "assets.bin"))
+    pack = bundled and (force or is_outdated(bundle_path, [MANIFEST, SCRIPT] +
+                                             [os.path.join(SRC_DIR, asset.get("source") or asset["font"])
+                                              for asset in bundled]))
+    images = []
+    fonts = []
+    raw_total = 0
+    stored_total = 0
+
+    for asset in manifest["assets"]:
+        name = asset["name"]
+        if "font" in asset:
+            # The copy and the header must follow the subset even when the bundle is current
+            if not asset.get("bundle"):
+                raise ValueError("%s: fonts are compiled in unless bundled, drop the entry" % name)
+            fonts.append((name,) + bundle_font(name, os.path.join(SRC_DIR, asset["font"])))
+            continue
+        source = os.path.join(SRC_DIR, asset["source"])
+        output = os.path.join(SRC_DIR, name + ".c")
+        if asset.get("bundle"):
+            remove_compiled(name)
+            if not pack:
+                continue
+        elif not force and not is_outdated(output, [MANIFEST, source, SCRIPT]):
+            continue
+
+        img = load_source(source)
+        width = asset.get("width", img.width)
+        height = asset.get("height", img.height)
+        background = asset.get("background")
+        if background is not None:
+            background = int(background, 16)
+
+        img = resample(img, width, height)
+        cf, data = encode(img, background)
+        raw_size = len(data)
+        cf, data, codec = compress(width, height, cf, bytes(data), asset.get("compress", "auto"))
+        raw_total += raw_size
+        stored_total += len(data)
+        if asset.get("bundle"):
+            images.append((name, ASSET_TYPE_IMAGE, width, height, LV_IMG_CF[cf], data))
+        else:
+            write_asset(name, img, cf, data, asset["source"])
+        saved = ", %s of %d bytes, %d%% saved" % (codec.upper(), raw_size, 100 - len(data) * 100 // raw_size) if codec else ""
+        print("asset %s: %dx%d %s, %d bytes%s%s" % (name, width, height, cf, len(data), saved,
+                                                    ", bundled" if asset.get("bundle") else ""))
+
+    if raw_total:
+        print("images: %d bytes in flash for %d bytes of pixels, %d bytes saved"
+              % (stored_total, raw_total, raw_total - stored_total))
+
+    write_font_bundle([(name, bitmap, text, guard) for name, bpp, bitmap, text, guard in fonts])
+    if pack:
+        for name, bpp, bitmap, _, _ in fonts:
+            images.append((name, ASSET_TYPE_FONT, 0, 0, bpp, bitmap))
+            print("font %s: %d bytes of glyph bitmaps, bundled" % (name, len(bitmap)))
+        size = pack_bundle(bundle_path, images)
+        offset, capacity = partition_offset("assets")
+        if size > capacity:
+            raise ValueError("bundle of %d bytes does not fit the %d byte assets partition" % (size, capacity))
+        print("bundle %s: %d assets, %d bytes; flash with: esptool.py write_flash 0x%x %s"
+              % (os.path.relpath(bundle_path, ROOT), len(images), size, offset, os.path.relpath(bundle_path, ROOT)))
+
+    return 0
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO (SCons)
+    UNDER_SCONS = True
+except NameError:
+    UNDER_SCONS = False
+
+if UNDER_SCONS:
+    main([])
+
+    with open(MANIFEST) as f:
+        _bundle = os.path.join(ROOT, json.load(f).get("bundle", "assets.bin"))
+    env.AddCustomTarget(  # noqa: F821
+        name="upload_assets",
+        dependencies=None,
+        actions=['"$PYTHONEXE" "$UPLOADER" --chip esp32s3 --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED '
+                 'write_flash 0x%x "%s"' % (partition_offset("assets")[0], _bundle)],
+        title="Upload assets",
+        description="Write the asset bundle to the assets partition")
+elif __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,745 @@
+"""Font subset pipeline.
+
+Generates LVGL fonts holding exactly the glyphs the UI draws with them.
+The UI sources in src/ are scanned for fonts referenced as
+&lv_font_montserrat_<size> and for the text shown in them:
+
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_30, ...);
+    lv_label_set_text(label, "CNS");                  # literal
+    lv_label_set_text(label, names[i]);               # string array in the same file
+    snprintf(buf, sizeof(buf), "%d", v);              # format of the last
+    lv_label_set_text(label, buf);                    #   printf into the buffer
+    lv_label_set_text_fmt(label, "(%d/%d)", a, b);    # format, conversions as their digits
+    digit_roll_create(parent, &lv_font_montserrat_72, ...);   # digits
+
+The screen layouts in src/layouts/*.json (tools/layout_compiler.py) are read
+as well: label text in the fonts of its styles, and digit roll digits. The
+fonts of the shared styles come from src/layouts/styles.json, also for
+
+    layout_add_style(label, STYLE_CAPTION);           # fonts of the style
+
+Objects are matched by their last identifier (gesture_ui.name_label and
+name_label are the same object). Text that cannot be resolved is reported;
+add it to the font's "extra" in src/fonts.json:
+
+    {
+      "ttf": ".pio/libdeps/dev/lvgl/scripts/built_in_font/Montserrat-Medium.ttf",
+      "bpp": 4,
+      "default": "lv_font_montserrat_14",      # LV_FONT_DEFAULT, kept built-in
+      "fonts": {
+        "lv_font_montserrat_72": {"extra": "+-", "ttf": "...", "bpp": 4}
+      }
+    }
+
+Each subset is generated with lv_font_conv into src/fonts/ under the name
+of the built-in font it replaces, and src/fonts/font_subsets.h disables
+those built-in sizes in lv_conf.h. Without lv_font_conv the same format is
+written with fontTools and Pillow's FreeType (pip install fonttools pillow),
+rendering within a level or two of it. When neither or the TTF is missing
+nothing is generated and the current fonts stay in use. The subsets are
+committed, and a subset whose header already lists the glyphs, face, size
+and bpp asked for is kept whichever converter wrote it, so a build only
+regenerates the fonts whose text or face changed. tools/asset_pipeline.py,
+run after this script, can move the glyph bitmaps of a subset to the asset
+bundle (src/assets.json).
+
+A font's "ttf" points at a face committed in the repo when it should not
+follow the manifest's: the 72 px digits and titles are Montserrat Bold,
+src/fonts/Montserrat-Bold.ttf (SIL Open Font License 1.1, Basic Latin and
+Latin-1 only).
+
+After a PlatformIO build, the flash (rodata) and RAM taken by every font is
+read from the linker map and written to font_report.txt in the build
+directory, with the change since the previous report.
+
+Run standalone (python tools/font_subset.py [--force] [--report firmware.map])
+or as a PlatformIO pre-script (extra_scripts = pre:tools/font_subset.py).
+Standalone, fonts named on the command line are the only ones regenerated,
+and --ttf path takes another face than the manifest's:
+
+    python tools/font_subset.py --force --ttf Montserrat-SemiBold.ttf lv_font_montserrat_72
+"""
+
+import glob
+import json
+import math
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+if "__file__" in globals():
+    ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+else:
+    ROOT = os.getcwd()  # PlatformIO runs pre-scripts from the project directory
+SCRIPT = os.path.join(ROOT, "tools", "font_subset.py")
+SRC_DIR = os.path.join(ROOT, "src")
+OUT_DIR = os.path.join(SRC_DIR, "fonts")
+MANIFEST = os.path.join(SRC_DIR, "fonts.json")
+SUBSETS_H = os.path.join(OUT_DIR, "font_subsets.h")
+LAYOUT_DIR = os.path.join(SRC_DIR, "layouts")
+STYLES = os.path.join(LAYOUT_DIR, "styles.json")
+
+STRING = r'"(?:[^"\\\n]|\\.)*"'
+COMMENT_RE = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+FONT_RE = re.compile(r"&\s*(lv_font_montserrat_\d+)\b")
+SET_FONT_RE = re.compile(r"lv_obj_set_style_text_font\(\s*([^,]+?)\s*,\s*&\s*(lv_font_montserrat_\d+)\b")
+SET_TEXT_RE = re.compile(r"lv_label_set_text(_fmt|_static)?\(\s*([^,]+?)\s*,\s*((?:%s\s*)+|[\w.>\-]+(?:\s*\[[^\]]*\])?)" % STRING)
+PRINTF_RE = re.compile(r"\bs(?:n)?printf\(\s*(\w+)\s*,(?:\s*[^,\"]+,)?\s*((?:%s\s*)+)" % STRING)
+ARRAY_RE = re.compile(r"(\w+)\s*\[\s*\w*\s*\]\s*=\s*\{((?:\s*%s\s*,?)+)\s*\}" % STRING)
+ADD_STYLE_RE = re.compile(r"layout_add_style\(\s*([^,]+?)\s*,\s*STYLE_(\w+)\s*\)")
+DIGITS_RE = re.compile(r"digit_roll_create\([^;]*?&\s*(lv_font_montserrat_\d+)\b")
+CONV_RE = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z|j|t)?([diouxXfFeEgGcsp%])")
+ESCAPES = {"n": "", "t": "", "r": "", "\\": "\\", '"': '"', "'": "'", "0": ""}
+
+NUMERIC = {
+    "d": "-0123456789", "i": "-0123456789", "u": "0123456789", "o": "01234567",
+    "x": "0123456789abcdef", "X": "0123456789ABCDEF",
+    "f": "-.0123456789", "F": "-.0123456789", "e": "-+.0123456789e", "E": "-+.0123456789E",
+    "g": "-+.0123456789e", "G": "-+.0123456789E",
+}
+
+
+def last_ident(expr):
+    names = re.findall(r"[A-Za-z_]\w*", expr.split("[")[0])
+    return names[-1] if names else expr
+
+
+def literals(text):
+    """Concatenated value of adjacent C string literals, escapes resolved."""
+    out = []
+    for lit in re.findall(STRING, text):
+        body = lit[1:-1]
+        out.append(re.sub(r"\\x([0-9a-fA-F]{2})|\\(.)",
+                          lambda m: chr(int(m.group(1), 16)) if m.group(1) else ESCAPES.get(m.group(2), m.group(2)),
+                          body))
+    return "".join(out)
+
+
+def format_chars(fmt):
+    """Characters a printf format can produce; None if a conversion is open ended (%s, %c)."""
+    chars = set()
+    open_ended = False
+    for conv in CONV_RE.finditer(fmt):
+        kind = conv.group(1)
+        if kind == "%":
+            chars.add("%")
+        elif kind in NUMERIC:
+            chars.update(NUMERIC[kind])
+        else:
+            open_ended = True
+    chars.update(CONV_RE.sub("", fmt))
+    return chars, open_ended
+
+
+def load_style_fonts(chars):
+    """Return {style: set of fonts} of the shared styles."""
+    style_fonts = {}
+    if not os.path.exists(STYLES):
+        return style_fonts
+    with open(STYLES) as f:
+        styles = json.load(f)["styles"]
+    for style, selectors in styles.items():
+        for props in selectors.values():
+            if "text_font" in props:
+                font = "lv_font_montserrat_%d" % int(props["text_font"])
+                style_fonts.setdefault(style, set()).add(font)
+                chars.setdefault(font, set())
+    return style_fonts
+
+
+def scan_layouts(texts, obj_fonts, chars, style_fonts):
+    """Add the objects of the screen layouts, by id, as the sources name them."""
+    for path in sorted(glob.glob(os.path.join(LAYOUT_DIR, "*.json"))):
+        if path == STYLES:
+            continue
+        with open(path) as f:
+            layout = json.load(f)
+        rel = os.path.relpath(path, ROOT)
+
+        def fonts_of(names):
+            names = [names] if isinstance(names, str) else names or []
+            return set().union(*(style_fonts.get(name, set()) for name in names))
+
+        inherited = fonts_of(layout.get("style"))  # Text fonts set on the screen are inherited
+        for obj in layout["objects"]:
+            fonts = fonts_of(obj.get("style")) or inherited
+            obj_fonts.setdefault(obj["id"], set()).update(fonts)
+            if obj["type"] == "label":
+                texts.append((obj["id"], set(obj["text"]), "%s: %s" % (rel, obj["id"]), False))
+            elif obj["type"] == "digit_roll":
+                chars.setdefault("lv_font_montserrat_%d" % int(obj["font"]), set()).update("0123456789")
+
+
+def scan_sources():
+    """Return ({font: set of chars}, [unresolved text descriptions])."""
+    files = []
+    for base, dirs, names in os.walk(SRC_DIR):
+        if os.path.abspath(base) == OUT_DIR:
+            continue
+        for name in names:
+            if name.endswith(".c") and not name.startswith("lv_font_"):
+                files.append(os.path.join(base, name))
+
+    texts = []          # (object, chars, where, open ended)
+    obj_fonts = {}      # object -> set of fonts
+    chars = {}
+    style_fonts = load_style_fonts(chars)
+    for path in sorted(files):
+        with open(path, encoding="utf-8") as f:
+            code = COMMENT_RE.sub("", f.read())
+        rel = os.path.relpath(path, ROOT)
+
+        for obj, font in SET_FONT_RE.findall(code):
+            obj_fonts.setdefault(last_ident(obj), set()).add(font)
+        for obj, style in ADD_STYLE_RE.findall(code):
+            obj_fonts.setdefault(last_ident(obj), set()).update(style_fonts.get(style.lower(), ()))
+        for font in FONT_RE.findall(code):
+            chars.setdefault(font, set())
+        for font in DIGITS_RE.findall(code):
+            chars.setdefault(font, set()).update("0123456789")
+
+        arrays = {name: body for name, body in ARRAY_RE.findall(code)}
+        for m in SET_TEXT_RE.finditer(code):
+            variant, obj, arg = m.groups()
+            where = "%s:%d" % (rel, code.count("\n", 0, m.start()) + 1)
+            obj = last_ident(obj)
+            if arg.startswith('"'):
+                text = literals(arg)
+                if variant == "_fmt":
+                    found, open_ended = format_chars(text)
+                    texts.append((obj, found, where, open_ended))
+                else:
+                    texts.append((obj, set(text), where, False))
+                continue
+
+            name = last_ident(arg)
+            if "[" in arg and name in arrays:
+                texts.append((obj, set(literals(arrays[name])), where, False))
+                continue
+
+            # A buffer: the last printf into it before this call gives the format
+            fmt = None
+            for p in PRINTF_RE.finditer(code, 0, m.start()):
+                if p.group(1) == name:
+                    fmt = literals(p.group(2))
+            if fmt is None:
+                texts.append((obj, set(), where, True))
+            else:
+                found, open_ended = format_chars(fmt)
+                texts.append((obj, found, where, open_ended))
+
+    scan_layouts(texts, obj_fonts, chars, style_fonts)
+
+    unresolved = []
+    for obj, found, where, open_ended in texts:
+        for font in obj_fonts.get(obj, ()):
+            chars.setdefault(font, set()).update(found)
+            if open_ended:
+                unresolved.append("%s: text of %s in %s" % (where, obj, font))
+
+    for font in chars:
+        chars[font].discard("\n")
+    return chars, unresolved
+
+
+def find_converter():
+    if shutil.which("lv_font_conv"):
+        return ["lv_font_conv"]
+    if shutil.which("npx"):
+        try:
+            subprocess.run(["npx", "--no-install", "lv_font_conv", "--version"], check=True,
+                           stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, timeout=60)
+            return ["npx", "--no-install", "lv_font_conv"]
+        except (subprocess.SubprocessError, OSError):
+            pass
+    try:
+        import fontTools.ttLib  # noqa: F401
+        import PIL.ImageFont  # noqa: F401
+        return BUILTIN
+    except ImportError:
+        return None
+
+
+BUILTIN = "builtin"  # convert() below, when lv_font_conv is not installed
+
+
+def gpos_kerning(tt, names):
+    """Horizontal kerning in font units between the given glyphs, from the GPOS kern lookups."""
+    kerning = {}
+    if "GPOS" not in tt:
+        return kerning
+    gpos = tt["GPOS"].table
+    wanted = set(names)
+    lookups = sorted(set(index for record in gpos.FeatureList.FeatureRecord if record.FeatureTag == "kern"
+                         for index in record.Feature.LookupListIndex))
+
+    def advance(value):
+        return getattr(value, "XAdvance", 0) or 0 if value is not None else 0
+
+    for index in lookups:
+        lookup = gpos.LookupList.Lookup[index]
+        subtables = [st.ExtSubTable if lookup.LookupType == 9 else st for st in lookup.SubTable]
+        done = set()  # Pairs an earlier subtable of this lookup applied to
+        for st in subtables:
+            if st.LookupType != 2:
+                continue
+            firsts = [g for g in st.Coverage.glyphs if g in wanted]
+            if st.Format == 1:
+                for i, first in enumerate(st.Coverage.glyphs):
+                    if first not in wanted:
+                        continue
+                    for record in st.PairSet[i].PairValueRecord:
+                        pair = (first, record.SecondGlyph)
+                        if record.SecondGlyph in wanted and pair not in done:
+                            done.add(pair)
+                            kerning[pair] = kerning.get(pair, 0) + advance(record.Value1)
+            elif st.Format == 2:
+                class1 = st.ClassDef1.classDefs
+                class2 = st.ClassDef2.classDefs
+                for first in firsts:
+                    row = st.Class1Record[class1.get(first, 0)].Class2Record
+                    for second in names:
+                        pair = (first, second)
+                        if pair in done:
+                            continue
+                        done.add(pair)
+                        value = advance(row[class2.get(second, 0)].Value1)
+                        if value:
+                            kerning[pair] = kerning.get(pair, 0) + value
+    return {pair: value for pair, value in kerning.items() if value}
+
+
+def c_bytes(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def convert(font, size, symbols, ttf, bpp, output):
+    """Write the LVGL font lv_font_conv --format lvgl --no-compress would, with fontTools and FreeType.
+
+    Glyphs are rendered hinted at size px per em and packed bpp bits per pixel
+    without row padding. Line height and base line come from the glyphs of the
+    subset, kerning from the GPOS kern feature, stored as pairs.
+    """
+    from fontTools.ttLib import TTFont
+    from PIL import Image, ImageDraw, ImageFont
+
+    tt = TTFont(ttf)
+    upem = tt["head"].unitsPerEm
+    cmap = tt.getBestCmap()
+    face = ImageFont.truetype(ttf, size)
+    codes = sorted(set(ord(c) for c in symbols if ord(c) in cmap))
+    names = [cmap[code] for code in codes]
+    levels = (1 << bpp) - 1
+
+    bitmap = []
+    glyphs = []
+    for code in codes:
+        canvas = Image.new("L", (size * 3, size * 3))
+        x0, y0 = size, size * 2
+        ImageDraw.Draw(canvas).text((x0, y0), chr(code), font=face, fill=255, anchor="ls")
+        adv_w = int(round(tt["hmtx"][cmap[code]][0] * size * 16.0 / upem))
+        box = canvas.getbbox()
+        if box is None:
+            glyphs.append((len(bitmap), adv_w, 0, 0, 0, 0, code))
+            continue
+        left, top, right, bottom = box
+        pixels = [v * levels // 255 for v in canvas.crop(box).getdata()]
+        packed = []
+        acc = bits = 0
+        for v in pixels:
+            acc = acc << bpp | v
+            bits += bpp
+            if bits == 8:
+                packed.append(acc)
+                acc = bits = 0
+        if bits:
+            packed.append(acc << (8 - bits))
+        glyphs.append((len(bitmap), adv_w, right - left, bottom - top, left - x0, y0 - bottom, code))
+        bitmap += packed
+
+    inked = [g for g in glyphs if g[2]]
+    ascent = max(g[5] + g[3] for g in inked) if inked else 0
+    descent = min(g[5] for g in inked) if inked else 0
+
+    out = ["/*******************************************************************************",
+           " * Size: %d px" % size,
+           " * Bpp: %d" % bpp,
+           " * Opts: tools/font_subset.py (fontTools, FreeType) --bpp %d --size %d --no-compress --font %s --symbols %s"
+           % (bpp, size, os.path.basename(ttf), symbols),
+           " ******************************************************************************/",
+           "",
+           '#include "lvgl.h"',
+           "",
+           "#ifndef %s" % font.upper(),
+           "#define %s 1" % font.upper(),
+           "#endif",
+           "",
+           "#if %s" % font.upper(),
+           "",
+           "/*-----------------",
+           " *    BITMAPS",
+           " *----------------*/",
+           "",
+           "/*Store the image of the glyphs*/",
+           "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {"]
+    for i, g in enumerate(glyphs):
+        end = glyphs[i + 1][0] if i + 1 < len(glyphs) else len(bitmap)
+        char = chr(g[6]).replace("\\", "\\\\").replace('"', '\\"')
+        out.append('    /* U+%04X "%s" */' % (g[6], char))
+        if end > g[0]:
+            out.append(c_bytes(["0x%x" % b for b in bitmap[g[0]:end]]) + ("," if end < len(bitmap) else ""))
+        out.append("")
+    out += ["};", "",
+            "",
+            "/*---------------------",
+            " *  GLYPH DESCRIPTION",
+            " *--------------------*/",
+            "",
+            "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {",
+            "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,"]
+    dsc = ["    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}" % g[:6]
+           for g in glyphs]
+    out += [",\n".join(dsc), "};", "",
+            "/*---------------------",
+            " *  CHARACTER MAPPING",
+            " *--------------------*/",
+            ""]
+
+    # Runs of 4 or more consecutive code points are ranges, the code points between them sparse lists
+    runs = []
+    for code in codes:
+        if runs and code == runs[-1][-1] + 1:
+            runs[-1].append(code)
+        else:
+            runs.append([code])
+    groups = []
+    for run in runs:
+        if len(run) >= 4:
+            groups.append(("range", run))
+        elif groups and groups[-1][0] == "sparse":
+            groups[-1][1].extend(run)
+        else:
+            groups.append(("sparse", list(run)))
+    cmaps = []
+    glyph_id = 1
+    for kind, group in groups:
+        start = group[0]
+        if kind == "range":
+            cmaps.append("        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                         "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                         ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY" % (start, len(group), glyph_id))
+        else:
+            n = len(cmaps)
+            out += ["static const uint16_t unicode_list_%d[] = {" % n,
+                    c_bytes(["0x%x" % (code - start) for code in group]), "};", ""]
+            cmaps.append("        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                         "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, "
+                         ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY"
+                         % (start, group[-1] - start + 1, glyph_id, n, len(group)))
+        glyph_id += len(group)
+    out += ["/*Collect the unicode lists and glyph_id offsets*/",
+            "static const lv_font_fmt_txt_cmap_t cmaps[] =",
+            "{",
+            ",\n".join("    {\n%s\n    }" % c for c in cmaps),
+            "};",
+            "",
+            "/*-----------------",
+            " *    KERNING",
+            " *----------------*/",
+            ""]
+
+    ids = {name: i + 1 for i, name in enumerate(names)}
+    kerning = sorted((ids[a], ids[b], value * size * 16.0 / upem)
+                     for (a, b), value in gpos_kerning(tt, names).items())
+    kerning = [(a, b, v) for a, b, v in kerning if round(v)]
+    scale = max([16] + [int(math.ceil(abs(v) * 16 / 127)) for a, b, v in kerning])
+    if kerning:
+        wide = len(glyphs) > 255
+        out += ["",
+                "/*Pair left and right glyphs for kerning*/",
+                "static const %s kern_pair_glyph_ids[] =" % ("uint16_t" if wide else "uint8_t"),
+                "{",
+                c_bytes(["%d, %d" % (a, b) for a, b, v in kerning], 4),
+                "};",
+                "",
+                "/* Kerning between the respective left and right glyphs",
+                " * 4.4 format which needs to scaled with `kern_scale`*/",
+                "static const int8_t kern_pair_values[] =",
+                "{",
+                c_bytes(["%d" % int(round(v * 16 / scale)) for a, b, v in kerning]),
+                "};",
+                "",
+                "/*Collect the kern pair's data in one place*/",
+                "static const lv_font_fmt_txt_kern_pair_t kern_pairs =",
+                "{",
+                "    .glyph_ids = kern_pair_glyph_ids,",
+                "    .values = kern_pair_values,",
+                "    .pair_cnt = %d," % len(kerning),
+                "    .glyph_ids_size = %d" % (1 if wide else 0),
+                "};",
+                ""]
+
+    post = tt["post"]
+    out += ["/*--------------------",
+            " *  ALL CUSTOM DATA",
+            " *--------------------*/",
+            "",
+            "#if LVGL_VERSION_MAJOR == 8",
+            "/*Store all the custom data of the font*/",
+            "static  lv_font_fmt_txt_glyph_cache_t cache;",
+            "#endif",
+            "",
+            "#if LVGL_VERSION_MAJOR >= 8",
+            "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+            "#else",
+            "static lv_font_fmt_txt_dsc_t font_dsc = {",
+            "#endif",
+            "    .glyph_bitmap = glyph_bitmap,",
+            "    .glyph_dsc = glyph_dsc,",
+            "    .cmaps = cmaps,",
+            "    .kern_dsc = %s," % ("&kern_pairs" if kerning else "NULL"),
+            "    .kern_scale = %d," % scale,
+            "    .cmap_num = %d," % len(cmaps),
+            "    .bpp = %d," % bpp,
+            "    .kern_classes = 0,",
+            "    .bitmap_format = 0,",
+            "#if LVGL_VERSION_MAJOR == 8",
+            "    .cache = &cache",
+            "#endif",
+            "};",
+            "",
+            "",
+            "/*-----------------",
+            " *  PUBLIC FONT",
+            " *----------------*/",
+            "",
+            "/*Initialize a public general font descriptor*/",
+            "#if LVGL_VERSION_MAJOR >= 8",
+            "const lv_font_t %s = {" % font,
+            "#else",
+            "lv_font_t %s = {" % font,
+            "#endif",
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/",
+            "    .line_height = %d,          /*The maximum line height required by the font*/" % (ascent - descent),
+            "    .base_line = %d,             /*Baseline measured from the bottom of the line*/" % -descent,
+            "#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)",
+            "    .subpx = LV_FONT_SUBPX_NONE,",
+            "#endif",
+            "#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8",
+            "    .underline_position = %d,"
+            % int(round((post.underlinePosition - post.underlineThickness / 2.0) * size / upem)),
+            "    .underline_thickness = %d," % int(round(post.underlineThickness * size / upem)),
+            "#endif",
+            "    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */",
+            "};",
+            "",
+            "",
+            "",
+            "#endif /*#if %s*/" % font.upper(),
+            ""]
+    with open(output, "w") as f:
+        f.write("\n".join(out))
+
+
+def bitmap_bytes(path):
+    with open(path) as f:
+        text = f.read()
+    match = re.search(r"glyph_bitmap\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    return len(re.findall(r"0x[0-9a-fA-F]+", match.group(1))) if match else 0
+
+
+def generate(conv, font, size, symbols, ttf, bpp):
+    """Run lv_font_conv and rename the guard, so that disabling the built-in size keeps the subset."""
+    output = os.path.join(OUT_DIR, font + ".c")
+    if conv == BUILTIN:
+        convert(font, size, symbols, ttf, bpp, output)
+    else:
+        subprocess.run(conv + ["--font", ttf, "--symbols", symbols, "--size", str(size), "--bpp", str(bpp),
+                               "--no-compress", "--format", "lvgl", "--lv-font-name", font, "-o", output], check=True)
+
+    with open(output) as f:
+        text = f.read()
+    guard = font.upper()
+    text = re.sub(r"\b%s\b" % guard, "FONT_SUBSET_" + guard[len("LV_FONT_"):], text)
+    # lvgl.h is on the include path itself, as for the other fonts in src/
+    text = re.sub(r'#ifdef LV_LVGL_H_INCLUDE_SIMPLE\n#include "lvgl.h"\n#else\n#include "lvgl/lvgl.h"\n#endif',
+                  '#include "lvgl.h"', text)
+    with open(output, "w") as f:
+        f.write("/* Generated by tools/font_subset.py from the UI sources - do not edit */\n\n" + text)
+    return output
+
+
+def write_subsets_header(fonts):
+    lines = [
+        "/* Generated by tools/font_subset.py from the UI sources - do not edit */",
+        "",
+        "#ifndef FONT_SUBSETS_H",
+        "#define FONT_SUBSETS_H",
+        "",
+        "/* Built-in sizes replaced by the subsets in this directory */",
+    ]
+    for font in fonts:
+        lines.append("#define %s 0" % font.upper())
+    lines += ["", "#define FONT_SUBSETS_DECLARE \\"]
+    lines += ["    LV_FONT_DECLARE(%s) \\" % font for font in fonts]
+    lines += ["", "#endif /* FONT_SUBSETS_H */", ""]
+    with open(SUBSETS_H, "w") as f:
+        f.write("\n".join(lines))
+
+
+OPTS_RE = re.compile(r"^ \* Opts: .*?--bpp (\d+) --size (\d+) .*?--font (\S+) --symbols (.*?)(?: --format .*)?$", re.M)
+
+
+def is_current(output, size, symbols, ttf, bpp):
+    """The subset already holds these glyphs from this face, whichever converter wrote it."""
+    if not os.path.exists(output):
+        return False
+    with open(output) as f:
+        match = OPTS_RE.search(f.read())
+    if match is None:
+        return False
+    opt_bpp, opt_size, opt_font, opt_symbols = match.groups()
+    return ((opt_bpp, opt_size, opt_symbols) == (str(bpp), str(size), symbols)
+            and os.path.basename(opt_font) == os.path.basename(ttf))
+
+
+def is_outdated(outputs, inputs):
+    if not all(os.path.exists(path) for path in outputs):
+        return True
+    stamp = min(os.path.getmtime(path) for path in outputs)
+    return any(os.path.getmtime(path) > stamp for path in inputs)
+
+
+def subset(force, only=None, ttf=None):
+    with open(MANIFEST) as f:
+        manifest = json.load(f)
+
+    chars, unresolved = scan_sources()
+    chars.pop(manifest.get("default"), None)
+    overrides = manifest.get("fonts", {})
+    for font, extra in overrides.items():
+        chars.setdefault(font, set()).update(extra.get("extra", ""))
+    for note in unresolved:
+        print("font_subset: warning: unresolved %s, add it to \"extra\" in src/fonts.json" % note)
+
+    fonts = sorted(chars, key=lambda name: int(name.rsplit("_", 1)[1]))
+    outputs = [SUBSETS_H] + [os.path.join(OUT_DIR, font + ".c") for font in fonts]
+    sources = []
+    for base, dirs, names in os.walk(SRC_DIR):
+        if os.path.abspath(base) != OUT_DIR:
+            sources += [os.path.join(base, n) for n in names if n.endswith((".c", ".json"))]
+    if not force and not is_outdated(outputs, sources + [MANIFEST, SCRIPT]):
+        return 0
+
+    ttfs = {font: ttf or os.path.join(ROOT, overrides.get(font, {}).get("ttf", manifest["ttf"])) for font in fonts}
+    params = {}
+    for font in fonts:
+        size = int(font.rsplit("_", 1)[1])
+        symbols = "".join(sorted(chars[font])) or " "
+        bpp = overrides.get(font, {}).get("bpp", manifest.get("bpp", 4))
+        params[font] = (size, symbols, ttfs[font], bpp)
+    # A subset holding the same glyphs of the same face is kept, whichever converter wrote it
+    targets = [font for font in fonts if (only is None or font in only)
+               and (force or not is_current(os.path.join(OUT_DIR, font + ".c"), *params[font]))]
+    for font in set(fonts) - set(targets):
+        if os.path.exists(os.path.join(OUT_DIR, font + ".c")):
+            os.utime(os.path.join(OUT_DIR, font + ".c"))  # Up to date for the next build's check
+
+    conv = find_converter() if targets else None
+    missing = sorted(set(ttfs[font] for font in targets if not os.path.exists(ttfs[font])))
+    if targets and (conv is None or missing):
+        reason = "lv_font_conv not found (npm i -g lv_font_conv)" if conv is None else "missing " + ", ".join(missing)
+        print("font_subset: %s, keeping the current fonts" % reason)
+        for font in targets:
+            print("font_subset: %s needs %r" % (font, params[font][1]))
+        return 0
+
+    os.makedirs(OUT_DIR, exist_ok=True)
+    for name in os.listdir(OUT_DIR):
+        if name.startswith("lv_font_") and name[:-2] not in fonts:
+            os.remove(os.path.join(OUT_DIR, name))
+
+    for font in targets:
+        size, symbols, font_ttf, bpp = params[font]
+        output = generate(conv, font, size, symbols, font_ttf, bpp)
+        print("font %s: %d glyphs %r, %d bytes of bitmaps" % (font, len(symbols), symbols, bitmap_bytes(output)))
+    # Fonts left out of this run keep their subset, or the built-in size if they have none yet
+    write_subsets_header([font for font in fonts if os.path.exists(os.path.join(OUT_DIR, font + ".c"))])
+    return 0
+
+
+MAP_SECTION_RE = re.compile(r"^ (\.[\w.$]+)\s*\n?\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S+)$", re.M)
+MAP_FONT_RE = re.compile(r"\((lv_font_\w+)\.c\.obj\)")
+
+
+def report(map_path, out_path):
+    """Flash and RAM taken by every font, from the input sections of the linker map."""
+    with open(map_path) as f:
+        text = f.read()
+
+    sizes = {}
+    for section, addr, size, obj in MAP_SECTION_RE.findall(text):
+        match = MAP_FONT_RE.search(obj)
+        if not match or int(addr, 16) == 0:
+            continue
+        kind = "rodata" if section.startswith(".rodata") else "ram" if section.startswith((".data", ".bss")) else "text"
+        entry = sizes.setdefault(match.group(1), {"rodata": 0, "text": 0, "ram": 0})
+        entry[kind] += int(size, 16)
+
+    previous = {}
+    if os.path.exists(out_path):
+        with open(out_path) as f:
+            for line in f:
+                fields = line.split()
+                if len(fields) == 4 and fields[1].isdigit():
+                    previous[fields[0]] = int(fields[1])
+
+    lines = ["%-28s %8s %8s %8s" % ("font", "rodata", "text", "ram")]
+    total = {"rodata": 0, "text": 0, "ram": 0}
+    for font in sorted(sizes):
+        entry = sizes[font]
+        lines.append("%-28s %8d %8d %8d" % (font, entry["rodata"], entry["text"], entry["ram"]))
+        for kind in total:
+            total[kind] += entry[kind]
+    lines.append("%-28s %8d %8d %8d" % ("total", total["rodata"], total["text"], total["ram"]))
+    with open(out_path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    print("\n".join(lines))
+    if "total" in previous:
+        print("font flash change since the last report: %+d bytes" % (total["rodata"] - previous["total"]))
+    return 0
+
+
+def main(argv):
+    if "--report" in argv:
+        map_path = argv[argv.index("--report") + 1]
+        return report(map_path, os.path.join(os.path.dirname(map_path), "font_report.txt"))
+    ttf = argv[argv.index("--ttf") + 1] if "--ttf" in argv else None
+    only = [arg for arg in argv if arg.startswith("lv_font_")] or None
+    return subset("--force" in argv, only, ttf)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO (SCons)
+    UNDER_SCONS = True
+except NameError:
+    UNDER_SCONS = False
+
+if UNDER_SCONS:
+    main([])
+
+    def _font_report(source, target, env):
+        map_path = os.path.join(env.subst("$BUILD_DIR"), env.subst("${PROGNAME}.map"))
+        if os.path.exists(map_path):
+            report(map_path, os.path.join(env.subst("$BUILD_DIR"), "font_report.txt"))
+
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", _font_report)  # noqa: F821
+elif __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
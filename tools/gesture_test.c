@@ -0,0 +1,269 @@
+/*
+ * Host tests of the gesture recogniser in src/task/gesture.c.
+ *
+ * Every case is a touch sequence at the 10 ms report rate with a little
+ * coordinate noise, as the GT911 reports it. One-finger cases are written
+ * to a touch trace and fed back the way the touch task replays traces, so
+ * the trace format is covered too; traces keep the first point only, so
+ * two-finger cases are fed directly. Each case lists the gestures it must
+ * produce, in order, and nothing else:
+ *
+ *   cc -O2 -Isrc/task tools/gesture_test.c src/task/touch_trace.c src/task/gesture.c -lm -o gesture_test
+ *   ./gesture_test
+ *
+ * Traces recorded on the device (CONFIG_TRACE_RECORD) are checked against
+ * the gestures expected from them, in order over all the dumps in the log:
+ *
+ *   ./gesture_test monitor.log "swipe left" "double tap"
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gesture.h"
+#include "touch_trace.h"
+
+#define MAX_SAMPLES  1024
+#define MAX_EXPECTED 4
+#define PERIOD_US    10000 // GT911 report period
+#define NOISE_PX     2     // Coordinate noise of a finger held still
+
+typedef struct {
+    const char *name;
+    void (*build)(void);
+    bool two_fingers;                     // Fed directly, traces hold the first point only
+    gesture_type_t expect[MAX_EXPECTED];  // Gestures in order, GESTURE_NONE terminated
+} gesture_case_t;
+
+static gesture_input_t samples[MAX_SAMPLES];
+static uint32_t sample_count;
+static int64_t now_us;
+static uint32_t seed;
+
+static touch_trace_record_t records[MAX_SAMPLES];
+
+static int16_t noise(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (int16_t)((seed >> 16) % (2 * NOISE_PX + 1)) - NOISE_PX;
+}
+
+static void add(int16_t x, int16_t y, int16_t x2, int16_t y2, uint8_t points)
+{
+    if (sample_count == MAX_SAMPLES)
+    {
+        fprintf(stderr, "case longer than %d samples\n", MAX_SAMPLES);
+        exit(1);
+    }
+    samples[sample_count++] = (gesture_input_t){now_us, x, y, x2, y2, points};
+    now_us += PERIOD_US;
+}
+
+// Finger(s) held for duration_us, the second one when points is 2
+static void hold(int16_t x, int16_t y, int16_t x2, int16_t y2, uint8_t points, int64_t duration_us)
+{
+    for (int64_t end = now_us + duration_us; now_us < end;)
+        add(x + noise(), y + noise(), x2 + noise(), y2 + noise(), points);
+}
+
+// One finger moved in a straight line at constant speed
+static void move(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int64_t duration_us)
+{
+    int32_t steps = (int32_t)(duration_us / PERIOD_US);
+    for (int32_t i = 0; i <= steps; i++)
+    {
+        int16_t x = x0 + (x1 - x0) * i / steps + noise();
+        int16_t y = y0 + (y1 - y0) * i / steps + noise();
+        add(x, y, x, y, 1);
+    }
+}
+
+// Two fingers moved apart or together, symmetric around (cx, cy) on the x axis
+static void spread(int16_t cx, int16_t cy, int16_t from_px, int16_t to_px, int64_t duration_us)
+{
+    int32_t steps = (int32_t)(duration_us / PERIOD_US);
+    for (int32_t i = 0; i <= steps; i++)
+    {
+        int16_t half = (from_px + (to_px - from_px) * i / steps) / 2;
+        add(cx - half + noise(), cy + noise(), cx + half + noise(), cy + noise(), 2);
+    }
+}
+
+static void release(void)
+{
+    const gesture_input_t *last = &samples[sample_count - 1];
+    add(last->x, last->y, last->x, last->y, 0);
+}
+
+static void wait(int64_t duration_us)
+{
+    now_us += duration_us;
+}
+
+static void tap(int16_t x, int16_t y)
+{
+    hold(x, y, x, y, 1, 100000);
+    release();
+}
+
+static void swipe_left(void) { move(600, 240, 300, 240, 200000); release(); }
+static void swipe_right(void) { move(300, 240, 600, 240, 200000); release(); }
+static void swipe_up(void) { move(400, 400, 400, 100, 200000); release(); }
+static void swipe_down(void) { move(400, 100, 400, 400, 200000); release(); }
+static void slow_drag(void) { move(600, 240, 300, 240, 900000); release(); }
+static void diagonal_drag(void) { move(300, 100, 500, 300, 200000); release(); }
+static void short_drag(void) { move(300, 240, 380, 240, 150000); release(); }
+static void single_tap(void) { tap(200, 200); }
+static void double_tap(void) { tap(200, 200); wait(150000); tap(205, 198); }
+static void taps_apart(void) { tap(200, 200); wait(150000); tap(400, 200); }
+static void taps_slow(void) { tap(200, 200); wait(500000); tap(200, 200); }
+static void long_press(void) { hold(300, 300, 300, 300, 1, 1200000); release(); }
+static void long_press_drift(void) { hold(300, 300, 300, 300, 1, 400000); move(300, 300, 340, 300, 600000); release(); }
+static void tap_then_long_press(void) { tap(200, 200); wait(150000); hold(200, 200, 200, 200, 1, 1000000); release(); }
+static void swipe_then_double_tap(void) { swipe_right(); wait(300000); double_tap(); }
+static void two_finger_tap(void) { hold(300, 300, 400, 300, 2, 120000); release(); }
+static void pinch_out(void) { spread(400, 240, 100, 300, 400000); release(); }
+static void pinch_in(void) { spread(400, 240, 300, 100, 400000); release(); }
+static void two_finger_hold(void) { hold(300, 300, 400, 300, 2, 1200000); release(); }
+
+static const gesture_case_t cases[] = {
+    {"swipe left", swipe_left, false, {GESTURE_SWIPE_LEFT}},
+    {"swipe right", swipe_right, false, {GESTURE_SWIPE_RIGHT}},
+    {"swipe up", swipe_up, false, {GESTURE_SWIPE_UP}},
+    {"swipe down", swipe_down, false, {GESTURE_SWIPE_DOWN}},
+    {"drag slower than a swipe", slow_drag, false, {GESTURE_NONE}},
+    {"diagonal drag", diagonal_drag, false, {GESTURE_NONE}},
+    {"drag shorter than a swipe", short_drag, false, {GESTURE_NONE}},
+    {"single tap, left to LVGL", single_tap, false, {GESTURE_NONE}},
+    {"double tap", double_tap, false, {GESTURE_DOUBLE_TAP}},
+    {"two taps apart", taps_apart, false, {GESTURE_NONE}},
+    {"two taps too slow", taps_slow, false, {GESTURE_NONE}},
+    {"long press", long_press, false, {GESTURE_LONG_PRESS}},
+    {"press drifting past the slop", long_press_drift, false, {GESTURE_NONE}},
+    {"tap then long press", tap_then_long_press, false, {GESTURE_LONG_PRESS}},
+    {"swipe then double tap", swipe_then_double_tap, false, {GESTURE_SWIPE_RIGHT, GESTURE_DOUBLE_TAP}},
+    {"two-finger tap", two_finger_tap, true, {GESTURE_TWO_FINGER_TAP}},
+    {"pinch out", pinch_out, true, {GESTURE_PINCH_OUT}},
+    {"pinch in", pinch_in, true, {GESTURE_PINCH_IN}},
+    {"two fingers held", two_finger_hold, true, {GESTURE_NONE}},
+};
+
+// Feed the samples, through a touch trace unless they hold two fingers, and collect the gestures
+static uint32_t run(bool direct, gesture_type_t *found, uint32_t max)
+{
+    gesture_recognizer_t rec;
+    gesture_t gesture;
+    touch_trace_t trace;
+    uint32_t n = 0;
+
+    gesture_init(&rec);
+    touch_trace_init(&trace, records, MAX_SAMPLES);
+    for (uint32_t i = 0; i < sample_count; i++)
+    {
+        const gesture_input_t *s = &samples[i];
+        touch_trace_append(&trace, s->time_us, s->x, s->y, s->points ? 40 : 0, s->points, s->points > 0);
+    }
+
+    int64_t t = 0;
+    for (uint32_t i = 0; i < sample_count; i++)
+    {
+        gesture_input_t in = samples[i];
+        if (!direct)
+        {
+            // As the touch task replays a trace
+            const touch_trace_record_t *r = &trace.records[i];
+            t += r->dt_us;
+            bool pressed = r->flags & TOUCH_TRACE_PRESSED;
+            in = (gesture_input_t){t, r->x, r->y, r->x, r->y, pressed ? r->points : 0};
+        }
+        if (gesture_feed(&rec, &in, &gesture) && n < max)
+            found[n++] = gesture.type;
+    }
+    return n;
+}
+
+static int run_cases(void)
+{
+    int failed = 0;
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        gesture_type_t found[MAX_EXPECTED + 1];
+        uint32_t expected = 0;
+
+        while (expected < MAX_EXPECTED && cases[c].expect[expected] != GESTURE_NONE)
+            expected++;
+
+        sample_count = 0;
+        now_us = 0;
+        seed = (uint32_t)c + 1;
+        cases[c].build();
+        uint32_t n = run(cases[c].two_fingers, found, MAX_EXPECTED + 1);
+
+        bool ok = n == expected && memcmp(found, cases[c].expect, n * sizeof(found[0])) == 0;
+        printf("%-4s %-32s", ok ? "ok" : "FAIL", cases[c].name);
+        for (uint32_t i = 0; i < n; i++)
+            printf("%s %s", i ? "," : "", gesture_name(found[i]));
+        printf("%s\n", n ? "" : " -");
+        failed += !ok;
+    }
+
+    printf("%d of %zu cases failed\n", failed, sizeof(cases) / sizeof(cases[0]));
+    return failed ? 1 : 0;
+}
+
+// Recorded traces, replayed as the touch task does, against the gesture names given
+static int run_log(const char *path, int expected, char **names)
+{
+    FILE *f = fopen(path, "r");
+    gesture_recognizer_t rec;
+    gesture_t gesture;
+    touch_trace_t trace;
+    int n = 0;
+    int failed = 0;
+    int traces = 0;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    gesture_init(&rec);
+    for (;;)
+    {
+        touch_trace_init(&trace, records, MAX_SAMPLES);
+        if (!touch_trace_load(&trace, f))
+            break;
+        traces++;
+
+        int64_t t = 0;
+        for (uint32_t i = 0; i < trace.header.count; i++)
+        {
+            const touch_trace_record_t *r = &trace.records[i];
+            t += r->dt_us;
+            bool pressed = r->flags & TOUCH_TRACE_PRESSED;
+            gesture_input_t in = {t, r->x, r->y, r->x, r->y, pressed ? r->points : 0};
+            if (!gesture_feed(&rec, &in, &gesture))
+                continue;
+            bool ok = n < expected && strcmp(gesture_name(gesture.type), names[n]) == 0;
+            printf("%-4s trace %d at %.3f s: %s, expected %s\n", ok ? "ok" : "FAIL", traces, t / 1e6,
+                   gesture_name(gesture.type), n < expected ? names[n] : "nothing");
+            failed += !ok;
+            n++;
+        }
+    }
+    fclose(f);
+
+    for (; n < expected; n++, failed++)
+        printf("FAIL missing %s\n", names[n]);
+    printf("%d traces, %d mismatches\n", traces, failed);
+    return traces && !failed ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        return run_log(argv[1], argc - 2, argv + 2);
+    return run_cases();
+}
@@ -0,0 +1,129 @@
+/*
+ * Host tests of the rep history ring in src/gui/history.c.
+ *
+ * Fills rings of a few capacities past their end and reads them back from
+ * every first index, in windows of every length the history screen asks
+ * for, so that reads across the end of the ring and past the newest entry
+ * are all covered. Entries carry their sequence number in time_s:
+ *
+ *   cc -O2 -Isrc/gui tools/history_test.c src/gui/history.c -o history_test
+ *   ./history_test
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "history.h"
+
+#define MAX_CAPACITY 300
+#define GUARD        0xA5 // Fill past the entries read, which must stay untouched
+
+static history_entry_t ring[MAX_CAPACITY];
+static history_entry_t out[MAX_CAPACITY + 1];
+
+static history_entry_t entry(uint32_t seq)
+{
+    return (history_entry_t){.time_s = seq, .kg = (int16_t)(seq % 50), .reps = (uint8_t)seq, .exercise = seq % 4};
+}
+
+static bool same(const history_entry_t *a, const history_entry_t *b)
+{
+    return a->time_s == b->time_s && a->kg == b->kg && a->reps == b->reps && a->exercise == b->exercise;
+}
+
+// Every window of the history, against the sequence numbers added; oldest is the first still kept
+static bool check_reads(uint32_t capacity, uint32_t added)
+{
+    uint32_t count = added < capacity ? added : capacity;
+    uint32_t oldest = added - count;
+
+    if (history_count() != count)
+    {
+        printf("FAIL capacity %u, %u added: count %u, expected %u\n", capacity, added, history_count(), count);
+        return false;
+    }
+    for (uint32_t first = 0; first <= count + 1; first++)
+    {
+        for (uint32_t n = 1; n <= count + 1; n++)
+        {
+            memset(out, GUARD, sizeof(out));
+            uint32_t got = history_read(first, n, out);
+            uint32_t want = first >= count ? 0 : n < count - first ? n : count - first;
+            if (got != want)
+            {
+                printf("FAIL capacity %u, %u added: read(%u, %u) gave %u entries, expected %u\n", capacity, added,
+                       first, n, got, want);
+                return false;
+            }
+            for (uint32_t i = 0; i < got; i++)
+            {
+                history_entry_t e = entry(oldest + first + i);
+                if (!same(&out[i], &e))
+                {
+                    printf("FAIL capacity %u, %u added: read(%u, %u)[%u] is rep %u, expected %u\n", capacity,
+                           added, first, n, i, out[i].time_s, oldest + first + i);
+                    return false;
+                }
+            }
+            const uint8_t *past = (const uint8_t *)&out[got];
+            for (size_t b = 0; b < sizeof(out[0]); b++)
+            {
+                if (past[b] != GUARD)
+                {
+                    printf("FAIL capacity %u, %u added: read(%u, %u) wrote past its entries\n", capacity, added,
+                           first, n);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Capacity, and the adds checked on the way: empty, partly filled, full, wrapped once and many times
+static bool run_capacity(uint32_t capacity)
+{
+    const uint32_t checks[] = {0, 1, capacity / 2, capacity - 1, capacity, capacity + 1, capacity * 2 - 1,
+                               capacity * 5 + 3};
+    uint32_t added = 0;
+    bool ok = true;
+
+    history_init(ring, capacity);
+    for (size_t c = 0; c < sizeof(checks) / sizeof(checks[0]) && ok; c++)
+    {
+        while (added < checks[c])
+        {
+            history_entry_t e = entry(added++);
+            history_add(&e);
+        }
+        ok = check_reads(capacity, added);
+    }
+    printf("%-4s capacity %3u, %4u reps added and read back in every window\n", ok ? "ok" : "FAIL", capacity, added);
+    return ok;
+}
+
+// No ring: adds are dropped and nothing is read
+static bool run_no_ring(void)
+{
+    history_entry_t e = entry(1);
+
+    history_init(NULL, 0);
+    history_add(&e);
+    bool ok = history_count() == 0 && history_read(0, 1, out) == 0;
+    printf("%-4s no ring, adds dropped\n", ok ? "ok" : "FAIL");
+    return ok;
+}
+
+int main(void)
+{
+    const uint32_t capacities[] = {1, 2, 7, 32, 33, MAX_CAPACITY};
+    int failed = 0;
+
+    for (size_t i = 0; i < sizeof(capacities) / sizeof(capacities[0]); i++)
+        failed += !run_capacity(capacities[i]);
+    failed += !run_no_ring();
+
+    printf("%d of %zu cases failed\n", failed, sizeof(capacities) / sizeof(capacities[0]) + 1);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+#ifndef HOST_ESP_CONSOLE_H
+#define HOST_ESP_CONSOLE_H
+
+// Host stand-in for the ESP-IDF console, for the host tests in tools/; commands are not registered
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_ERROR_CHECK(x) ((void)(x))
+
+typedef struct {
+    const char *command;
+    const char *help;
+    const char *hint;
+    int (*func)(int argc, char **argv);
+} esp_console_cmd_t;
+
+static inline esp_err_t esp_console_cmd_register(const esp_console_cmd_t *cmd)
+{
+    (void)cmd;
+    return ESP_OK;
+}
+
+#endif /* HOST_ESP_CONSOLE_H */
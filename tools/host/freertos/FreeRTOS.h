@@ -0,0 +1,138 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+/*
+ * Host stand-in for the FreeRTOS calls used by the display pipeline, on
+ * POSIX threads, for the host tests in tools/. Tasks are threads, the tick
+ * is 1 ms as in sdkconfig.defaults, and core pinning is ignored.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint8_t StackType_t;
+
+#define pdTRUE           1
+#define pdFALSE          0
+#define pdPASS           pdTRUE
+#define portMAX_DELAY    UINT32_MAX
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// Queue of fixed size items, also used for semaphores with an item size of 0
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint8_t *storage;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t count;
+    UBaseType_t head;
+} StaticQueue_t;
+
+typedef StaticQueue_t *QueueHandle_t;
+
+typedef struct {
+    pthread_t thread;
+    void (*fn)(void *);
+    void *arg;
+} StaticTask_t;
+
+typedef StaticTask_t *TaskHandle_t;
+
+static inline void host_deadline(struct timespec *ts, TickType_t ticks)
+{
+    clock_gettime(CLOCK_REALTIME, ts);
+    ts->tv_sec += ticks / 1000;
+    ts->tv_nsec += (long)(ticks % 1000) * 1000000;
+    if (ts->tv_nsec >= 1000000000)
+    {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000;
+    }
+}
+
+static inline bool host_ready(const StaticQueue_t *q, bool for_send)
+{
+    return for_send ? q->count < q->length : q->count > 0;
+}
+
+// Wait until there is room to send or an item to receive, or ticks pass, with q->lock held
+static inline bool host_wait(StaticQueue_t *q, bool for_send, TickType_t ticks)
+{
+    struct timespec deadline;
+    int err = 0;
+
+    host_deadline(&deadline, ticks);
+    while (!host_ready(q, for_send) && err != ETIMEDOUT)
+    {
+        if (ticks == portMAX_DELAY)
+            err = pthread_cond_wait(&q->changed, &q->lock);
+        else
+            err = pthread_cond_timedwait(&q->changed, &q->lock, &deadline);
+    }
+    return host_ready(q, for_send);
+}
+
+static inline QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size, uint8_t *storage,
+                                               StaticQueue_t *buf)
+{
+    memset(buf, 0, sizeof(*buf));
+    pthread_mutex_init(&buf->lock, NULL);
+    pthread_cond_init(&buf->changed, NULL);
+    buf->storage = storage;
+    buf->length = length;
+    buf->item_size = item_size;
+    return buf;
+}
+
+static inline BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks)
+{
+    pthread_mutex_lock(&q->lock);
+    bool room = host_wait(q, true, ticks);
+    if (room)
+    {
+        if (item)
+            memcpy(q->storage + (q->head + q->count) % q->length * q->item_size, item, q->item_size);
+        q->count++;
+        pthread_cond_broadcast(&q->changed);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return room ? pdTRUE : pdFALSE;
+}
+
+static inline BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks)
+{
+    pthread_mutex_lock(&q->lock);
+    bool got = host_wait(q, false, ticks);
+    if (got)
+    {
+        if (item)
+            memcpy(item, q->storage + q->head * q->item_size, q->item_size);
+        q->head = (q->head + 1) % q->length;
+        q->count--;
+        pthread_cond_broadcast(&q->changed);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return got ? pdTRUE : pdFALSE;
+}
+
+static inline void *host_task_entry(void *arg)
+{
+    StaticTask_t *task = arg;
+    task->fn(task->arg);
+    return NULL;
+}
+
+static inline BaseType_t xPortGetCoreID(void)
+{
+    return 1;
+}
+
+#endif /* HOST_FREERTOS_H */
@@ -0,0 +1,7 @@
+#ifndef HOST_FREERTOS_QUEUE_H
+#define HOST_FREERTOS_QUEUE_H
+
+// Queues are declared with the rest of the host stand-in in FreeRTOS.h
+#include "freertos/FreeRTOS.h"
+
+#endif /* HOST_FREERTOS_QUEUE_H */
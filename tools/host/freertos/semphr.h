@@ -0,0 +1,14 @@
+#ifndef HOST_FREERTOS_SEMPHR_H
+#define HOST_FREERTOS_SEMPHR_H
+
+#include "freertos/FreeRTOS.h"
+
+// Binary semaphores are queues of one item without data, as in FreeRTOS
+typedef StaticQueue_t StaticSemaphore_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define xSemaphoreCreateBinaryStatic(buf) xQueueCreateStatic(1, 0, NULL, (buf))
+#define xSemaphoreGive(sem)               xQueueSend((sem), NULL, 0)
+#define xSemaphoreTake(sem, ticks)        xQueueReceive((sem), NULL, (ticks))
+
+#endif /* HOST_FREERTOS_SEMPHR_H */
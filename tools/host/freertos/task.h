@@ -0,0 +1,26 @@
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include <unistd.h>
+
+#include "freertos/FreeRTOS.h"
+
+// Tasks run as detached threads; priority, stack and core are not modelled
+static inline TaskHandle_t xTaskCreateStaticPinnedToCore(void (*fn)(void *), const char *name, uint32_t stack_size,
+                                                         void *arg, UBaseType_t priority, StackType_t *stack,
+                                                         StaticTask_t *tcb, BaseType_t core_id)
+{
+    (void)name, (void)stack_size, (void)priority, (void)stack, (void)core_id;
+    tcb->fn = fn;
+    tcb->arg = arg;
+    pthread_create(&tcb->thread, NULL, host_task_entry, tcb);
+    pthread_detach(tcb->thread);
+    return tcb;
+}
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    usleep(ticks * 1000);
+}
+
+#endif /* HOST_FREERTOS_TASK_H */
@@ -0,0 +1,308 @@
+#ifndef HOST_LVGL_H
+#define HOST_LVGL_H
+
+/*
+ * Host stand-in for the parts of LVGL 8 the host tests in tools/ use: the
+ * display driver of the display pipeline, whose field names and flushing
+ * handshake follow lv_hal_disp.h, the objects, events, timers and ticks of
+ * the widgets in src/gui, and the fonts of src/fonts, implemented in
+ * tools/host/lvgl_host.c.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int16_t lv_coord_t;
+
+typedef union {
+    uint16_t full; // RGB565, LV_COLOR_DEPTH 16
+} lv_color_t;
+
+typedef struct {
+    lv_coord_t x1;
+    lv_coord_t y1;
+    lv_coord_t x2;
+    lv_coord_t y2;
+} lv_area_t;
+
+typedef struct {
+    void *buf1;
+    void *buf2;
+    void *buf_act;
+    uint32_t size;              // In pixels
+    volatile int flushing;      // 1 while the driver owns the buffer handed to flush_cb
+    volatile int flushing_last; // 1 when the last area of the frame is being flushed
+    volatile uint32_t last_area : 1;
+    volatile uint32_t last_part : 1;
+} lv_disp_draw_buf_t;
+
+typedef struct _lv_disp_drv_t {
+    lv_coord_t hor_res;
+    lv_coord_t ver_res;
+    lv_disp_draw_buf_t *draw_buf;
+    void (*flush_cb)(struct _lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+    void (*wait_cb)(struct _lv_disp_drv_t *drv);
+    void *user_data;
+} lv_disp_drv_t;
+
+static inline void lv_disp_flush_ready(lv_disp_drv_t *drv)
+{
+    drv->draw_buf->flushing = 0;
+    drv->draw_buf->flushing_last = 0;
+}
+
+static inline int lv_disp_flush_is_last(lv_disp_drv_t *drv)
+{
+    return drv->draw_buf->flushing_last;
+}
+
+/* Objects, events, timers and ticks, see tools/host/lvgl_host.c */
+
+#define LV_UNUSED(x) ((void)(x))
+#define LV_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define LV_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define LV_CLAMP(min, val, max) (LV_MAX(min, LV_MIN(val, max)))
+#define LV_ABS(x) ((x) > 0 ? (x) : (-(x)))
+
+#define LV_DISP_DEF_REFR_PERIOD 30
+
+typedef enum {
+    LV_RES_INV = 0,
+    LV_RES_OK,
+} lv_res_t;
+
+typedef enum {
+    LV_EVENT_ALL = 0,
+    LV_EVENT_PRESSED,
+    LV_EVENT_PRESSING,
+    LV_EVENT_PRESS_LOST,
+    LV_EVENT_CLICKED,
+    LV_EVENT_RELEASED,
+    LV_EVENT_DRAW_MAIN,
+    LV_EVENT_DELETE,
+} lv_event_code_t;
+
+typedef enum {
+    LV_OBJ_FLAG_HIDDEN = 1 << 0,
+    LV_OBJ_FLAG_CLICKABLE = 1 << 1,
+    LV_OBJ_FLAG_SCROLLABLE = 1 << 4,
+} lv_obj_flag_t;
+
+typedef struct {
+    lv_coord_t x;
+    lv_coord_t y;
+} lv_point_t;
+
+typedef struct _lv_obj_t lv_obj_t;
+typedef struct _lv_obj_class_t lv_obj_class_t;
+
+typedef struct {
+    lv_obj_t *target;
+    lv_event_code_t code;
+    void *param;
+} lv_event_t;
+
+typedef void (*lv_event_cb_t)(lv_event_t *e);
+
+struct _lv_obj_class_t {
+    const lv_obj_class_t *base_class;
+    void (*constructor_cb)(const lv_obj_class_t *class_p, lv_obj_t *obj);
+    void (*destructor_cb)(const lv_obj_class_t *class_p, lv_obj_t *obj);
+    void (*event_cb)(const lv_obj_class_t *class_p, lv_event_t *e);
+    uint32_t instance_size;
+};
+
+struct _lv_obj_t {
+    const lv_obj_class_t *class_p;
+    lv_obj_t *parent;
+    void *user_data;
+    lv_area_t coords;   // Position relative to the parent, as set, and size
+    uint32_t flags;
+    lv_obj_t *host_next; // All live objects, newest first
+    bool host_deleting; // Queued by lv_obj_del_async
+};
+
+typedef struct _lv_timer_t {
+    uint32_t period;
+    uint32_t last_run;
+    void (*timer_cb)(struct _lv_timer_t *timer);
+    void *user_data;
+    struct _lv_timer_t *host_next;
+} lv_timer_t;
+
+typedef void (*lv_timer_cb_t)(lv_timer_t *timer);
+
+typedef struct {
+    lv_timer_t *refr_timer;
+    lv_obj_t *act_scr;
+} lv_disp_t;
+
+typedef struct {
+    lv_point_t point;
+} lv_indev_t;
+
+extern const lv_obj_class_t lv_obj_class;
+
+lv_obj_t *lv_obj_class_create_obj(const lv_obj_class_t *class_p, lv_obj_t *parent);
+void lv_obj_class_init_obj(lv_obj_t *obj);
+lv_obj_t *lv_obj_create(lv_obj_t *parent);
+void lv_obj_del(lv_obj_t *obj);
+void lv_obj_del_async(lv_obj_t *obj);
+void lv_obj_remove_style_all(lv_obj_t *obj);
+void lv_obj_set_pos(lv_obj_t *obj, lv_coord_t x, lv_coord_t y);
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y);
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h);
+lv_coord_t lv_obj_get_y(const lv_obj_t *obj);
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t f);
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t f);
+bool lv_obj_has_flag(const lv_obj_t *obj, lv_obj_flag_t f);
+lv_res_t lv_obj_event_base(const lv_obj_class_t *class_p, lv_event_t *e);
+lv_res_t lv_event_send(lv_obj_t *obj, lv_event_code_t code, void *param);
+lv_obj_t *lv_event_get_target(lv_event_t *e);
+lv_event_code_t lv_event_get_code(lv_event_t *e);
+
+lv_indev_t *lv_indev_get_act(void);
+void lv_indev_get_point(const lv_indev_t *indev, lv_point_t *point);
+
+uint32_t lv_tick_get(void);
+uint32_t lv_tick_elaps(uint32_t prev_tick);
+
+lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data);
+void lv_timer_del(lv_timer_t *timer);
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period);
+uint32_t lv_timer_handler(void);
+uint8_t lv_timer_get_idle(void);
+uint16_t lv_anim_count_running(void);
+
+lv_disp_t *lv_disp_get_default(void);
+lv_timer_t *_lv_disp_get_refr_timer(lv_disp_t *disp);
+void lv_scr_load(lv_obj_t *scr);
+lv_obj_t *lv_scr_act(void);
+
+/* Fonts as lv_font_conv writes them, images as the asset bundle describes them */
+
+#define LVGL_VERSION_MAJOR 8
+#define LVGL_VERSION_MINOR 4
+#define LV_VERSION_CHECK(x, y, z) (x == LVGL_VERSION_MAJOR && (y < LVGL_VERSION_MINOR || y == LVGL_VERSION_MINOR))
+#define LV_ATTRIBUTE_LARGE_CONST
+
+typedef enum {
+    LV_FONT_SUBPX_NONE = 0,
+} lv_font_subpx_t;
+
+struct _lv_font_t;
+
+typedef struct {
+    const struct _lv_font_t *resolved_font;
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t bpp;
+} lv_font_glyph_dsc_t;
+
+typedef struct _lv_font_t {
+    bool (*get_glyph_dsc)(const struct _lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                          uint32_t letter_next);
+    const uint8_t *(*get_glyph_bitmap)(const struct _lv_font_t *font, uint32_t letter);
+    lv_coord_t line_height;
+    lv_coord_t base_line;
+    uint8_t subpx : 2;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    const void *dsc;
+    const struct _lv_font_t *fallback;
+    void *user_data;
+} lv_font_t;
+
+typedef struct {
+    uint32_t bitmap_index : 20;
+    uint32_t adv_w : 12;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+typedef enum {
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+} lv_font_fmt_txt_cmap_type_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    const uint16_t *unicode_list;
+    const void *glyph_id_ofs_list;
+    uint16_t list_length;
+    lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct {
+    const void *glyph_ids;
+    const int8_t *values;
+    uint32_t pair_cnt : 30;
+    uint32_t glyph_ids_size : 2;
+} lv_font_fmt_txt_kern_pair_t;
+
+typedef struct {
+    const int8_t *class_pair_values;
+    const uint8_t *left_class_mapping;
+    const uint8_t *right_class_mapping;
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+} lv_font_fmt_txt_kern_classes_t;
+
+typedef struct {
+    uint32_t last_letter;
+    uint32_t last_glyph_id;
+} lv_font_fmt_txt_glyph_cache_t;
+
+typedef struct {
+    const uint8_t *glyph_bitmap;
+    const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+    const lv_font_fmt_txt_cmap_t *cmaps;
+    const void *kern_dsc;
+    uint16_t kern_scale;
+    uint16_t cmap_num : 9;
+    uint16_t bpp : 4;
+    uint16_t kern_classes : 1;
+    uint16_t bitmap_format : 2;
+    lv_font_fmt_txt_glyph_cache_t *cache;
+} lv_font_fmt_txt_dsc_t;
+
+typedef struct {
+    uint32_t cf : 5;
+    uint32_t always_zero : 3;
+    uint32_t reserved : 2;
+    uint32_t w : 11;
+    uint32_t h : 11;
+} lv_img_header_t;
+
+typedef struct {
+    lv_img_header_t header;
+    uint32_t data_size;
+    const uint8_t *data;
+} lv_img_dsc_t;
+
+// Uncompressed fonts only (--no-compress), without kerning
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                                   uint32_t letter_next);
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter);
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next);
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+
+/* What the tests drive and look at */
+void host_lv_tick_inc(uint32_t ms);            // Advances the tick, running the timers due on the way
+void host_lv_set_point(lv_coord_t x, lv_coord_t y); // Point of the active input device
+void host_lv_set_idle(uint8_t idle_pct, uint16_t anims); // What lv_timer_get_idle and lv_anim_count_running return
+uint32_t host_lv_mem_used(void);               // Bytes of the live objects, as the LVGL heap would hold them
+uint32_t host_lv_obj_count(void);
+uint32_t host_lv_timer_count(void);
+
+#endif /* HOST_LVGL_H */
@@ -0,0 +1,384 @@
+/*
+ * Host stand-in for the LVGL 8 objects, events, timers and ticks used by the
+ * widgets in src/gui, for the host tests in tools/. Objects are plain
+ * allocations of their class's instance size, nothing is drawn. The tick
+ * only moves when a test advances it with host_lv_tick_inc, which runs the
+ * timers due on the way and the deletions queued by lv_obj_del_async, as
+ * lv_timer_handler does on the device.
+ */
+
+#include <stdlib.h>
+
+#include "lvgl.h"
+
+const lv_obj_class_t lv_obj_class = {
+    .instance_size = sizeof(lv_obj_t),
+};
+
+static lv_obj_t *objs;
+static lv_timer_t *timers;
+static uint32_t tick;
+static uint32_t mem_used;
+static uint8_t idle_pct = 100;
+static uint16_t anims;
+static lv_indev_t indev;
+static lv_timer_t refr_timer = {.period = LV_DISP_DEF_REFR_PERIOD};
+static lv_disp_t disp = {.refr_timer = &refr_timer};
+
+lv_obj_t *lv_obj_class_create_obj(const lv_obj_class_t *class_p, lv_obj_t *parent)
+{
+    lv_obj_t *obj = calloc(1, class_p->instance_size);
+    if (obj == NULL)
+        abort();
+    obj->class_p = class_p;
+    obj->parent = parent;
+    obj->flags = LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE;
+    obj->host_next = objs;
+    objs = obj;
+    mem_used += class_p->instance_size;
+    return obj;
+}
+
+void lv_obj_class_init_obj(lv_obj_t *obj)
+{
+    for (const lv_obj_class_t *c = obj->class_p; c; c = c->base_class)
+    {
+        if (c->constructor_cb)
+            c->constructor_cb(obj->class_p, obj);
+    }
+}
+
+lv_obj_t *lv_obj_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(&lv_obj_class, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+// Children first, then the object, calling the destructors of its classes
+void lv_obj_del(lv_obj_t *obj)
+{
+    for (lv_obj_t *child = objs; child;)
+    {
+        lv_obj_t *next = child->host_next;
+        if (child->parent == obj)
+        {
+            lv_obj_del(child);
+            next = objs; // The list changed under the walk
+        }
+        child = next;
+    }
+
+    lv_event_send(obj, LV_EVENT_DELETE, NULL);
+    for (const lv_obj_class_t *c = obj->class_p; c; c = c->base_class)
+    {
+        if (c->destructor_cb)
+            c->destructor_cb(obj->class_p, obj);
+    }
+    for (lv_obj_t **p = &objs; *p; p = &(*p)->host_next)
+    {
+        if (*p == obj)
+        {
+            *p = obj->host_next;
+            break;
+        }
+    }
+    if (disp.act_scr == obj)
+        disp.act_scr = NULL;
+    mem_used -= obj->class_p->instance_size;
+    free(obj);
+}
+
+void lv_obj_del_async(lv_obj_t *obj)
+{
+    obj->host_deleting = true;
+}
+
+void lv_obj_remove_style_all(lv_obj_t *obj)
+{
+    LV_UNUSED(obj);
+}
+
+void lv_obj_set_pos(lv_obj_t *obj, lv_coord_t x, lv_coord_t y)
+{
+    lv_coord_t w = obj->coords.x2 - obj->coords.x1;
+    lv_coord_t h = obj->coords.y2 - obj->coords.y1;
+    obj->coords = (lv_area_t){x, y, x + w, y + h};
+}
+
+void lv_obj_set_y(lv_obj_t *obj, lv_coord_t y)
+{
+    lv_obj_set_pos(obj, obj->coords.x1, y);
+}
+
+void lv_obj_set_size(lv_obj_t *obj, lv_coord_t w, lv_coord_t h)
+{
+    obj->coords.x2 = obj->coords.x1 + w - 1;
+    obj->coords.y2 = obj->coords.y1 + h - 1;
+}
+
+lv_coord_t lv_obj_get_y(const lv_obj_t *obj)
+{
+    return obj->coords.y1;
+}
+
+void lv_obj_add_flag(lv_obj_t *obj, lv_obj_flag_t f)
+{
+    obj->flags |= f;
+}
+
+void lv_obj_clear_flag(lv_obj_t *obj, lv_obj_flag_t f)
+{
+    obj->flags &= ~(uint32_t)f;
+}
+
+bool lv_obj_has_flag(const lv_obj_t *obj, lv_obj_flag_t f)
+{
+    return (obj->flags & f) == f;
+}
+
+// The base object handles nothing the host tests look at
+lv_res_t lv_obj_event_base(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p), LV_UNUSED(e);
+    return LV_RES_OK;
+}
+
+lv_res_t lv_event_send(lv_obj_t *obj, lv_event_code_t code, void *param)
+{
+    lv_event_t e = {.target = obj, .code = code, .param = param};
+
+    for (const lv_obj_class_t *c = obj->class_p; c; c = c->base_class)
+    {
+        if (c->event_cb)
+        {
+            c->event_cb(c, &e);
+            break;
+        }
+    }
+    return LV_RES_OK;
+}
+
+lv_obj_t *lv_event_get_target(lv_event_t *e)
+{
+    return e->target;
+}
+
+lv_event_code_t lv_event_get_code(lv_event_t *e)
+{
+    return e->code;
+}
+
+lv_indev_t *lv_indev_get_act(void)
+{
+    return &indev;
+}
+
+void lv_indev_get_point(const lv_indev_t *in, lv_point_t *point)
+{
+    *point = in->point;
+}
+
+uint32_t lv_tick_get(void)
+{
+    return tick;
+}
+
+uint32_t lv_tick_elaps(uint32_t prev_tick)
+{
+    return tick - prev_tick;
+}
+
+lv_timer_t *lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void *user_data)
+{
+    lv_timer_t *timer = calloc(1, sizeof(*timer));
+    if (timer == NULL)
+        abort();
+    *timer = (lv_timer_t){period, tick, timer_xcb, user_data, timers};
+    timers = timer;
+    return timer;
+}
+
+void lv_timer_del(lv_timer_t *timer)
+{
+    for (lv_timer_t **p = &timers; *p; p = &(*p)->host_next)
+    {
+        if (*p == timer)
+        {
+            *p = timer->host_next;
+            free(timer);
+            return;
+        }
+    }
+}
+
+void lv_timer_set_period(lv_timer_t *timer, uint32_t period)
+{
+    timer->period = period;
+}
+
+// Runs the timers due, one at a time as a timer may delete others, then the queued deletions
+uint32_t lv_timer_handler(void)
+{
+    bool ran;
+    do
+    {
+        ran = false;
+        for (lv_timer_t *t = timers; t; t = t->host_next)
+        {
+            if (lv_tick_elaps(t->last_run) >= t->period)
+            {
+                t->last_run = tick;
+                t->timer_cb(t);
+                ran = true;
+                break;
+            }
+        }
+    } while (ran);
+
+    for (lv_obj_t *obj = objs; obj;)
+    {
+        if (obj->host_deleting)
+        {
+            lv_obj_del(obj);
+            obj = objs;
+            continue;
+        }
+        obj = obj->host_next;
+    }
+    return 1;
+}
+
+uint8_t lv_timer_get_idle(void)
+{
+    return idle_pct;
+}
+
+uint16_t lv_anim_count_running(void)
+{
+    return anims;
+}
+
+lv_disp_t *lv_disp_get_default(void)
+{
+    return &disp;
+}
+
+lv_timer_t *_lv_disp_get_refr_timer(lv_disp_t *d)
+{
+    return d->refr_timer;
+}
+
+void lv_scr_load(lv_obj_t *scr)
+{
+    disp.act_scr = scr;
+}
+
+lv_obj_t *lv_scr_act(void)
+{
+    return disp.act_scr;
+}
+
+// Glyph id of a letter, 0 when the font has none, as lv_font_fmt_txt.c maps them
+static uint32_t glyph_id(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t letter)
+{
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++)
+    {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if (letter < cmap->range_start || rcp >= cmap->range_length)
+            continue;
+
+        switch (cmap->type)
+        {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            return cmap->glyph_id_start + rcp;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            return cmap->glyph_id_start + ((const uint8_t *)cmap->glyph_id_ofs_list)[rcp];
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+            for (uint16_t j = 0; j < cmap->list_length; j++)
+            {
+                if (cmap->unicode_list[j] != rcp)
+                    continue;
+                if (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY)
+                    return cmap->glyph_id_start + j;
+                return cmap->glyph_id_start + ((const uint16_t *)cmap->glyph_id_ofs_list)[j];
+            }
+            break;
+        }
+    }
+    return 0;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter,
+                                   uint32_t letter_next)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = font->dsc;
+    uint32_t gid = glyph_id(fdsc, letter);
+    LV_UNUSED(letter_next);
+
+    if (gid == 0)
+        return false;
+    const lv_font_fmt_txt_glyph_dsc_t *g = &fdsc->glyph_dsc[gid];
+    *dsc = (lv_font_glyph_dsc_t){font, (g->adv_w + 8) >> 4, g->box_w, g->box_h, g->ofs_x, g->ofs_y, fdsc->bpp};
+    return true;
+}
+
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter)
+{
+    const lv_font_fmt_txt_dsc_t *fdsc = font->dsc;
+    uint32_t gid = glyph_id(fdsc, letter);
+    return gid ? &fdsc->glyph_bitmap[fdsc->glyph_dsc[gid].bitmap_index] : NULL;
+}
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next)
+{
+    return font->get_glyph_dsc(font, dsc, letter, letter_next);
+}
+
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    return font->get_glyph_bitmap(font, letter);
+}
+
+void host_lv_tick_inc(uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++)
+    {
+        tick++;
+        lv_timer_handler();
+    }
+}
+
+void host_lv_set_point(lv_coord_t x, lv_coord_t y)
+{
+    indev.point = (lv_point_t){x, y};
+}
+
+void host_lv_set_idle(uint8_t idle, uint16_t running)
+{
+    idle_pct = idle;
+    anims = running;
+}
+
+uint32_t host_lv_mem_used(void)
+{
+    return mem_used;
+}
+
+uint32_t host_lv_obj_count(void)
+{
+    uint32_t n = 0;
+    for (const lv_obj_t *obj = objs; obj; obj = obj->host_next)
+        n++;
+    return n;
+}
+
+uint32_t host_lv_timer_count(void)
+{
+    uint32_t n = 0;
+    for (const lv_timer_t *t = timers; t; t = t->host_next)
+        n++;
+    return n;
+}
@@ -0,0 +1,133 @@
+/*
+ * Host benchmark of the compressed image decoders in src/display/img_codec.c.
+ *
+ * Decodes every compressed image of an asset bundle built by
+ * tools/asset_pipeline.py, checks the bands decode to their full size, and
+ * reports the flash saved and the time to decode the whole image, which is
+ * what drawing it once costs when it is not in the decoded cache:
+ *
+ *   cc -O2 -Isrc/display tools/img_codec_bench.c src/display/img_codec.c src/display/asset_bundle.c -o img_codec_bench
+ *   ./img_codec_bench assets.bin
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "asset_bundle.h"
+#include "img_codec.h"
+
+#define BENCH_MIN_NS 200000000LL // Repeat each image for at least 200 ms
+
+static long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static bool decode_all(const img_codec_header_t *img, uint8_t *out)
+{
+    size_t block_size = img_codec_block_size(img);
+    for (uint16_t b = 0; b < img_codec_blocks(img); b++)
+    {
+        if (!img_codec_decode_block(img, b, out + b * block_size))
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : "assets.bin";
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(len);
+    if (data == NULL || fread(data, 1, len, f) != (size_t)len)
+    {
+        fprintf(stderr, "%s: read failed\n", path);
+        return 1;
+    }
+    fclose(f);
+
+    asset_bundle_t bundle;
+    if (!asset_bundle_open(&bundle, data, len))
+    {
+        fprintf(stderr, "%s: not a valid asset bundle\n", path);
+        return 1;
+    }
+
+    size_t stored_total = 0, decoded_total = 0;
+    int failed = 0;
+    for (int i = 0; i < bundle.count; i++)
+    {
+        const asset_bundle_entry_t *entry = &bundle.index[i];
+        if (entry->type != ASSET_TYPE_IMAGE)
+            continue;
+        if (!asset_bundle_verify(&bundle, i))
+        {
+            printf("%-28.28s corrupt\n", entry->name);
+            failed++;
+            continue;
+        }
+
+        const img_codec_header_t *img = img_codec_open(bundle.base + entry->offset, entry->size);
+        if (img == NULL)
+        {
+            printf("%-28.28s %ux%u uncompressed, %lu bytes\n", entry->name, entry->w, entry->h,
+                   (unsigned long)entry->size);
+            stored_total += entry->size;
+            decoded_total += entry->size;
+            continue;
+        }
+
+        size_t size = (size_t)img->w * img->h * img->px_size;
+        uint8_t *out = malloc(size + img_codec_block_size(img));
+        uint8_t *copy = malloc(size);
+        if (!decode_all(img, out))
+        {
+            printf("%-28.28s decode failed\n", entry->name);
+            failed++;
+            free(out);
+            free(copy);
+            continue;
+        }
+
+        long long runs = 0, start = now_ns(), elapsed;
+        do
+        {
+            decode_all(img, out);
+            runs++;
+        } while ((elapsed = now_ns() - start) < BENCH_MIN_NS);
+        long long copies = 0;
+        start = now_ns();
+        long long copy_elapsed;
+        do
+        {
+            memcpy(copy, out, size);
+            copies++;
+        } while ((copy_elapsed = now_ns() - start) < BENCH_MIN_NS);
+
+        printf("%-28.28s %ux%u %s, %lu of %lu bytes (%lu%% saved), decode %.1fus/frame, copy %.1fus/frame\n",
+               entry->name, img->w, img->h, img->codec == IMG_CODEC_RLE ? "RLE" : "LZ4", (unsigned long)entry->size,
+               (unsigned long)size, (unsigned long)(100 - entry->size * 100 / size), elapsed / 1000.0 / runs,
+               copy_elapsed / 1000.0 / copies);
+        stored_total += entry->size;
+        decoded_total += size;
+        free(out);
+        free(copy);
+    }
+
+    printf("%lu bytes in flash for %lu bytes of pixels, %lu bytes saved\n", (unsigned long)stored_total,
+           (unsigned long)decoded_total, (unsigned long)(decoded_total - stored_total));
+    free(data);
+    return failed ? 1 : 0;
+}
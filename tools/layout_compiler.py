@@ -0,0 +1,387 @@
+"""Layout compiler.
+
+Turns the screen layouts in src/layouts/<name>.json into const tables that
+src/gui/layout.c instantiates at runtime (src/layouts/<name>_layout.c/.h).
+
+Styles are shared by all screens and the hand-written UI code. They are
+declared once in src/layouts/styles.json, keyed by part|state:
+
+    {
+      "styles": {
+        "caption": {"main": {"text_color": "0x87A2AB", "text_font": 30}},
+        "switch": {"indicator|checked": {"bg_color": "0x2E4E5C", "height": 30}}
+      }
+    }
+
+and compiled into the style registry (src/layouts/styles.c/.h): const styles
+(LV_STYLE_CONST_INIT) that stay in flash, with one STYLE_<NAME> id per style
+for layout_add_style(). A style property is one of STYLE_PROPS, fonts are
+given by their Montserrat size.
+
+A screen layout references styles by name:
+
+    {
+      "design": [1024, 600],             # resolution the coordinates are given for
+      "style": "screen",                 # style(s) of the screen object (optional)
+      "objects": [
+        {"id": "cns_label", "type": "label", "text": "CNS", "style": "caption", "pos": [620, 50]},
+        {"id": "kg_slider", "type": "arc", "size": [300, 300], "align": "center",
+         "range": [15, 50], "value": 15, "angles": [135, 45],
+         "boards": {"800x480": {"size": [260, 260]}}}
+      ]
+    }
+
+Object types are label (text), img (src, an image of the asset bundle), switch,
+arc (range, value, angles) and digit_roll (font, color, bg_color, digits).
+Flags are hidden, clickable and no_knob.
+
+Tables are generated for every board resolution in BOARDS: coordinates are
+scaled from the design resolution, and the size of arcs by the smaller of the
+two scales; images, fonts and styles are not resized (per-board values in
+"boards" replace the computed ones). An aligned object with a size is
+turned into an absolute position, placed so that its centre is where the
+design puts it, scaled; objects sharing a centre in the design share it on
+every board. Objects sized by their content (labels, digit rolls) keep
+their alignment and are placed by LVGL.
+
+The objects are listed in the generated header as <NAME>_<ID> indices into
+the array filled by layout_create(), so code keeps direct handles to them.
+
+Run standalone (python tools/layout_compiler.py [--force]) or as a
+PlatformIO pre-script (extra_scripts = pre:tools/layout_compiler.py).
+Outputs are only rewritten when the layout or this script is newer.
+"""
+
+import glob
+import json
+import os
+import sys
+
+if "__file__" in globals():
+    ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+else:
+    ROOT = os.getcwd()  # PlatformIO runs pre-scripts from the project directory
+SCRIPT = os.path.join(ROOT, "tools", "layout_compiler.py")
+LAYOUT_DIR = os.path.join(ROOT, "src", "layouts")
+STYLES = os.path.join(LAYOUT_DIR, "styles.json")
+MAX_STYLES = 32  # Bits of layout_obj_t.styles
+
+# Board resolutions, see the LCD_H_RES / LCD_V_RES of the board headers in src/display/
+BOARDS = [(1024, 600), (800, 480)]
+
+TYPES = {
+    "label": "LAYOUT_LABEL",
+    "img": "LAYOUT_IMG",
+    "switch": "LAYOUT_SWITCH",
+    "arc": "LAYOUT_ARC",
+    "digit_roll": "LAYOUT_DIGIT_ROLL",
+}
+FLAGS = {"hidden": "LAYOUT_HIDDEN", "clickable": "LAYOUT_CLICKABLE", "no_knob": "LAYOUT_NO_KNOB"}
+ALIGNS = ["top_left", "top_mid", "top_right", "bottom_left", "bottom_mid", "bottom_right",
+          "left_mid", "right_mid", "center"]
+SCALED_TYPES = {"arc"}  # Drawn at any size, the other widgets keep their design size
+PARTS = ["main", "scrollbar", "indicator", "knob", "selected", "items"]
+STATES = ["default", "checked", "focused", "pressed", "disabled", "edited"]
+
+
+def color(value):
+    rgb = int(value, 16)
+    return "LV_COLOR_MAKE(0x%02X, 0x%02X, 0x%02X)" % (rgb >> 16, (rgb >> 8) & 0xFF, rgb & 0xFF)
+
+
+def font(size):
+    return "&lv_font_montserrat_%d" % int(size)
+
+
+def number(value):
+    return "%d" % int(value)
+
+
+# Property: (LV_STYLE_CONST_* macros it sets, value conversion)
+STYLE_PROPS = {
+    "bg_color": (["BG_COLOR"], color),
+    "bg_opa": (["BG_OPA"], number),
+    "text_color": (["TEXT_COLOR"], color),
+    "text_font": (["TEXT_FONT"], font),
+    "arc_width": (["ARC_WIDTH"], number),
+    "arc_color": (["ARC_COLOR"], color),
+    "arc_opa": (["ARC_OPA"], number),
+    "width": (["WIDTH"], number),
+    "height": (["HEIGHT"], number),
+    "size": (["WIDTH", "HEIGHT"], number),
+    "pad_all": (["PAD_TOP", "PAD_BOTTOM", "PAD_LEFT", "PAD_RIGHT"], number),
+}
+
+
+def selector(key):
+    """("indicator_checked", "LV_PART_INDICATOR | LV_STATE_CHECKED") for "indicator|checked"."""
+    names = key.split("|")
+    part = names[0] if names[0] in PARTS else "main"
+    state = names[-1] if names[-1] in STATES else "default"
+    if set(names) - {part, state}:
+        raise ValueError("unknown selector %s" % key)
+    suffix = part if state == "default" else "%s_%s" % (part, state)
+    return suffix, "LV_PART_%s | LV_STATE_%s" % (part.upper(), state.upper())
+
+
+def align_pos(align, pw, ph, w, h, x, y):
+    """Absolute position of an object of w x h aligned on a pw x ph screen, as lv_obj_align()."""
+    ax = {"left": 0, "mid": (pw - w) // 2, "right": pw - w}
+    ay = {"top": 0, "mid": (ph - h) // 2, "bottom": ph - h}
+    if align == "center":
+        return ax["mid"] + x, ay["mid"] + y
+    if align in ("left_mid", "right_mid"):
+        return ax[align.split("_")[0]] + x, ay["mid"] + y
+    vertical, horizontal = align.split("_")
+    return ax[horizontal] + x, ay[vertical] + y
+
+
+def place(obj, design, board):
+    """Return (align, x, y, w, h) of an object on one board."""
+    sx = board[0] / design[0]
+    sy = board[1] / design[1]
+    override = obj.get("boards", {}).get("%dx%d" % board, {})
+
+    pos = obj.get("pos", (0, 0))
+    x, y = round(pos[0] * sx), round(pos[1] * sy)
+    w, h = 0, 0
+    if "size" in obj:
+        scale = min(sx, sy) if obj["type"] in SCALED_TYPES else 1
+        w, h = round(obj["size"][0] * scale), round(obj["size"][1] * scale)
+    if "pos" in override:
+        x, y = override["pos"]
+    if "size" in override:
+        w, h = override["size"]
+
+    align = obj.get("align")
+    if align is None:
+        return "LV_ALIGN_DEFAULT", x, y, w, h
+    if align not in ALIGNS:
+        raise ValueError("%s: unknown align %s" % (obj["id"], align))
+    if w and "size" in obj and "pos" not in override:
+        # The centre is scaled as one value: offsets and sizes rounded apart would part objects sharing an anchor
+        dw, dh = obj["size"]
+        dx, dy = align_pos(align, design[0], design[1], dw, dh, pos[0], pos[1])
+        return "LV_ALIGN_DEFAULT", round((dx + dw / 2) * sx - w / 2), round((dy + dh / 2) * sy - h / 2), w, h
+    if w:
+        x, y = align_pos(align, board[0], board[1], w, h, x, y)
+        return "LV_ALIGN_DEFAULT", x, y, w, h
+    return "LV_ALIGN_%s" % align.upper(), x, y, w, h
+
+
+def style_names(value):
+    if value is None:
+        return []
+    return [value] if isinstance(value, str) else list(value)
+
+
+def compile_layout(path, styles):
+    name = os.path.splitext(os.path.basename(path))[0]
+    with open(path) as f:
+        layout = json.load(f)
+    design = layout.get("design", BOARDS[0])
+    prefix = name.upper()
+    source = os.path.relpath(path, ROOT).replace(os.sep, "/")
+
+    def style_bits(names, what):
+        bits = ["LAYOUT_STYLE(STYLE_%s)" % n.upper() for n in style_names(names) if n in styles]
+        if len(bits) != len(style_names(names)):
+            raise ValueError("%s: unknown style in %s" % (what, names))
+        return " | ".join(bits) or "0"
+
+    screen_styles = style_bits(layout.get("style"), "screen")
+
+    objects = layout["objects"]
+    ids = []
+    rows = {}
+    for obj in objects:
+        oid = obj["id"]
+        if obj["type"] not in TYPES:
+            raise ValueError("%s: unknown type %s" % (oid, obj["type"]))
+        obj_styles = style_bits(obj.get("style"), oid)
+        flags = " | ".join(FLAGS[flag] for flag in obj.get("flags", ())) or "0"
+        fields = [".type = %s" % TYPES[obj["type"]], ".flags = %s" % flags]
+        if obj_styles != "0":
+            fields.append(".styles = %s" % obj_styles)
+        if obj["type"] == "label":
+            fields.append(".text = %s" % json.dumps(obj["text"]))
+        elif obj["type"] == "img":
+            fields.append(".text = %s" % json.dumps(obj["src"]))
+        elif obj["type"] == "arc":
+            start, end = obj.get("angles", (135, 45))
+            fields.append(".min = %d, .max = %d, .value = %d, .start_angle = %d, .end_angle = %d"
+                          % (obj["range"][0], obj["range"][1], obj.get("value", obj["range"][0]), start, end))
+        elif obj["type"] == "digit_roll":
+            fields.append(".font = %s, .color = 0x%06X, .bg_color = 0x%06X, .value = %d"
+                          % (font(obj["font"]), int(obj["color"], 16), int(obj["bg_color"], 16), obj["digits"]))
+        ids.append("%s_%s" % (prefix, oid.upper()))
+        rows[oid] = fields
+
+    variants = []
+    tables = []
+    for board in layout.get("boards", BOARDS):
+        board = tuple(board)
+        table = "objs_%dx%d" % board
+        lines = []
+        for obj, index in zip(objects, ids):
+            align, x, y, w, h = place(obj, design, board)
+            pos = ".align = %s, .x = %d, .y = %d" % (align, x, y)
+            if w:
+                pos += ", .w = %d, .h = %d" % (w, h)
+            lines.append("    [%s] = {%s}," % (index, ", ".join(rows[obj["id"]][:2] + [pos] + rows[obj["id"]][2:])))
+        tables.append("static const layout_obj_t %s[%s_OBJ_COUNT] = {\n%s\n};" % (table, prefix, "\n".join(lines)))
+        variants.append("    {%d, %d, %s}," % (board[0], board[1], table))
+
+    c_text = """/* Generated by tools/layout_compiler.py from {source} - do not edit */
+
+#include "{name}_layout.h"
+#include "styles.h"
+
+{tables}
+
+static const layout_variant_t variants[] = {{
+{variants}
+}};
+
+const layout_screen_t {name}_layout = {{
+    .name = "{name}",
+    .styles = {screen_styles},
+    .obj_count = {prefix}_OBJ_COUNT,
+    .variant_count = {variant_count},
+    .variants = variants,
+}};
+""".format(source=source, name=name, tables="\n\n".join(tables), variants="\n".join(variants),
+           screen_styles=screen_styles, prefix=prefix, variant_count=len(variants))
+
+    h_text = """/* Generated by tools/layout_compiler.py from {source} - do not edit */
+
+#ifndef {prefix}_LAYOUT_H
+#define {prefix}_LAYOUT_H
+
+#include "../gui/layout.h"
+
+// Objects of the screen, indices into the array filled by layout_create()
+enum {{
+{ids}
+    {prefix}_OBJ_COUNT
+}};
+
+extern const layout_screen_t {name}_layout;
+
+#endif /* {prefix}_LAYOUT_H */
+""".format(source=source, prefix=prefix, name=name, ids="\n".join("    %s," % i for i in ids))
+
+    base = os.path.join(LAYOUT_DIR, name + "_layout")
+    with open(base + ".c", "w") as f:
+        f.write(c_text)
+    with open(base + ".h", "w") as f:
+        f.write(h_text)
+    return len(objects), len(variants)
+
+
+def compile_styles(path):
+    """Write the style registry, return the style names in id order."""
+    with open(path) as f:
+        styles = json.load(f)["styles"]
+    if len(styles) > MAX_STYLES:
+        raise ValueError("%d styles, at most %d" % (len(styles), MAX_STYLES))
+    source = os.path.relpath(path, ROOT).replace(os.sep, "/")
+
+    consts = []
+    sets = []
+    for style, selectors in styles.items():
+        parts = []
+        for key, props in selectors.items():
+            suffix, sel = selector(key)
+            var = "style_%s_%s" % (style, suffix)
+            lines = []
+            for prop, value in props.items():
+                if prop not in STYLE_PROPS:
+                    raise ValueError("%s: unknown style property %s" % (style, prop))
+                macros, convert = STYLE_PROPS[prop]
+                lines += ["    LV_STYLE_CONST_%s(%s)," % (macro, convert(value)) for macro in macros]
+            consts.append("static const lv_style_const_prop_t %s_props[] = {\n%s\n    LV_STYLE_PROP_INV,\n};\n"
+                          "static LV_STYLE_CONST_INIT(%s, %s_props);" % (var, "\n".join(lines), var, var))
+            parts.append("    {&%s, %s}," % (var, sel))
+        sets.append("static const layout_style_t %s_parts[] = {\n%s\n};" % (style, "\n".join(parts)))
+
+    c_text = """/* Generated by tools/layout_compiler.py from {source} - do not edit */
+
+#include "styles.h"
+
+// Const styles, read by LVGL from flash and shared by every object using them
+
+{consts}
+
+{sets}
+
+const layout_style_set_t layout_styles[STYLE_COUNT] = {{
+{table}
+}};
+""".format(source=source, consts="\n\n".join(consts), sets="\n\n".join(sets),
+           table="\n".join("    [STYLE_%s] = {%s_parts, sizeof(%s_parts) / sizeof(%s_parts[0])},"
+                           % (style.upper(), style, style, style) for style in styles))
+
+    h_text = """/* Generated by tools/layout_compiler.py from {source} - do not edit */
+
+#ifndef STYLES_H
+#define STYLES_H
+
+#include "../gui/layout.h"
+
+// Style registry, ids for layout_add_style()
+enum {{
+{ids}
+    STYLE_COUNT
+}};
+
+#endif /* STYLES_H */
+""".format(source=source, ids="\n".join("    STYLE_%s," % style.upper() for style in styles))
+
+    base = os.path.join(LAYOUT_DIR, "styles")
+    with open(base + ".c", "w") as f:
+        f.write(c_text)
+    with open(base + ".h", "w") as f:
+        f.write(h_text)
+    return list(styles)
+
+
+def is_outdated(output, inputs):
+    if not os.path.exists(output):
+        return True
+    stamp = os.path.getmtime(output)
+    return any(os.path.getmtime(path) > stamp for path in inputs)
+
+
+def main(argv):
+    force = "--force" in argv
+    styles = None
+    if force or is_outdated(os.path.join(LAYOUT_DIR, "styles.c"), [STYLES, SCRIPT]):
+        styles = compile_styles(STYLES)
+        print("styles: %d shared styles" % len(styles))
+
+    for path in sorted(glob.glob(os.path.join(LAYOUT_DIR, "*.json"))):
+        if path == STYLES:
+            continue
+        name = os.path.splitext(os.path.basename(path))[0]
+        output = os.path.join(LAYOUT_DIR, name + "_layout.c")
+        if not force and not is_outdated(output, [path, STYLES, SCRIPT]):
+            continue
+        if styles is None:
+            with open(STYLES) as f:
+                styles = list(json.load(f)["styles"])
+        count, variants = compile_layout(path, styles)
+        print("layout %s: %d objects, %d resolutions" % (name, count, variants))
+    return 0
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO (SCons)
+    UNDER_SCONS = True
+except NameError:
+    UNDER_SCONS = False
+
+if UNDER_SCONS:
+    main([])
+elif __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,238 @@
+/*
+ * Host replay of LVGL allocation traces through the tiered LVGL heap.
+ *
+ * Record a trace on the device with the console ("lvheap trace", use the
+ * screens, "lvheap dump") and save the log. This replays every allocation
+ * through the SRAM pool of src/display/mem_pool.c with the tier rule of
+ * src/display/lvgl_heap.h, checks the pool after each call, and reports the
+ * peak usage per tier, the spills to PSRAM and the fragmentation:
+ *
+ *   cc -O2 -Isrc/display tools/lvgl_heap_replay.c src/display/mem_pool.c -o lvgl_heap_replay
+ *   ./lvgl_heap_replay monitor.log [passes] [sram_bytes]
+ *
+ * Without a log it replays tools/traces/lvgl_heap_screens.log, a synthetic
+ * trace of the splash, main and history screens written by
+ * tools/lvgl_heap_trace.py, three times.
+ *
+ * Each pass frees what the trace left allocated before the next one, as if
+ * its screens were deleted, so leaks of the pool structure show up as
+ * fragmentation growing from pass to pass. Blocks allocated before the
+ * recording started are unknown to the trace; their frees are skipped.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl_heap.h"
+
+#define DEFAULT_TRACE  "tools/traces/lvgl_heap_screens.log"
+#define DEFAULT_PASSES 3
+#define MAX_EVENTS     65536
+#define MAP_SLOTS      (2 * MAX_EVENTS) // Open addressing, at most half full
+
+typedef struct {
+    char op;
+    uint32_t ptr;
+    uint32_t new_ptr;
+    uint32_t size;
+} event_t;
+
+// Device address of a live block and where it lives in the replay
+typedef struct {
+    uint32_t key;       // 0 for a free slot
+    void *ptr;
+    uint32_t size;
+} slot_t;
+
+static event_t events[MAX_EVENTS];
+static slot_t map[MAP_SLOTS];
+static mem_pool_t sram;
+static struct {
+    uint32_t used;
+    uint32_t peak;
+} psram;
+static uint32_t spills, unknown, worst_frag;
+
+static slot_t *find(uint32_t key, bool insert)
+{
+    uint32_t i = (key * 2654435761u) % MAP_SLOTS;
+    slot_t *tomb = NULL;
+
+    for (;; i = (i + 1) % MAP_SLOTS)
+    {
+        if (map[i].key == key)
+            return &map[i];
+        if (map[i].key == 1 && tomb == NULL)
+            tomb = &map[i];
+        if (map[i].key == 0)
+            return insert ? (tomb ? tomb : &map[i]) : NULL;
+    }
+}
+
+// Same routing as lvgl_heap_alloc, PSRAM is plain malloc with the size kept
+static void *alloc(uint32_t size)
+{
+    void *ptr = NULL;
+    if (lvgl_heap_tier_for(size) == LVGL_HEAP_SRAM)
+    {
+        ptr = mem_pool_alloc(&sram, size);
+        if (ptr == NULL)
+            spills++;
+    }
+    if (ptr == NULL)
+    {
+        ptr = malloc(size);
+        psram.used += size;
+        if (psram.used > psram.peak)
+            psram.peak = psram.used;
+    }
+    return ptr;
+}
+
+static void release(slot_t *s)
+{
+    if (mem_pool_owns(&sram, s->ptr))
+    {
+        mem_pool_free(&sram, s->ptr);
+    }
+    else
+    {
+        free(s->ptr);
+        psram.used -= s->size;
+    }
+    s->key = 1; // Tombstone
+}
+
+static void track(uint32_t key, void *ptr, uint32_t size)
+{
+    if (key == 0)
+        return; // Failed on the device
+    slot_t *s = find(key, true);
+    s->key = key;
+    s->ptr = ptr;
+    s->size = size;
+}
+
+static bool replay(const event_t *e)
+{
+    slot_t *s;
+
+    switch (e->op)
+    {
+    case 'a':
+        track(e->new_ptr, alloc(e->size), e->size);
+        break;
+    case 'f':
+        s = find(e->ptr, false);
+        if (s == NULL)
+        {
+            unknown++;
+            break;
+        }
+        release(s);
+        break;
+    case 'r':
+        s = find(e->ptr, false);
+        if (e->new_ptr == 0)
+            break; // Failed on the device, the old block was kept
+        if (s == NULL)
+            unknown++;
+        // Like lvgl_heap_realloc: in place when large enough and in the right tier
+        else if (e->ptr == e->new_ptr && mem_pool_owns(&sram, s->ptr) &&
+                 e->size <= mem_pool_usable_size(s->ptr))
+        {
+            s->size = e->size;
+            break;
+        }
+        else
+            release(s);
+        track(e->new_ptr, alloc(e->size), e->size);
+        break;
+    }
+    return mem_pool_check(&sram);
+}
+
+static size_t load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[128];
+    size_t n = 0;
+    bool inside = false;
+
+    if (f == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), f) && n < MAX_EVENTS)
+    {
+        event_t *e = &events[n];
+        if (strncmp(line, "LVGL HEAP TRACE BEGIN", 21) == 0)
+            inside = true;
+        else if (strncmp(line, "LVGL HEAP TRACE END", 19) == 0)
+            inside = false;
+        else if (!inside)
+            continue;
+        else if (sscanf(line, "a %x %u", &e->new_ptr, &e->size) == 2)
+            e->op = 'a', n++;
+        else if (sscanf(line, "f %x", &e->ptr) == 1)
+            e->op = 'f', n++;
+        else if (sscanf(line, "r %x %x %u", &e->ptr, &e->new_ptr, &e->size) == 3)
+            e->op = 'r', n++;
+    }
+    fclose(f);
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = argc > 1 ? argv[1] : DEFAULT_TRACE;
+    size_t count = load(path);
+    int passes = argc > 2 ? atoi(argv[2]) : argc > 1 ? 1 : DEFAULT_PASSES;
+    size_t sram_bytes = argc > 3 ? strtoul(argv[3], NULL, 0) : LVGL_HEAP_SRAM_BYTES;
+    uint8_t *buf = aligned_alloc(MEM_POOL_ALIGN, (sram_bytes + MEM_POOL_ALIGN - 1) & ~(size_t)(MEM_POOL_ALIGN - 1));
+
+    if (count == 0 || buf == NULL || !mem_pool_init(&sram, buf, sram_bytes))
+    {
+        fprintf(stderr, "%s: no trace, or pool of %zu bytes too small\n", path, sram_bytes);
+        return 1;
+    }
+    printf("%zu allocator calls, %d passes, %zu byte SRAM pool, small up to %d bytes\n", count, passes, sram_bytes,
+           LVGL_HEAP_SMALL_MAX);
+
+    for (int p = 0; p < passes; p++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!replay(&events[i]))
+            {
+                fprintf(stderr, "pass %d, call %zu: pool corrupted\n", p + 1, i + 1);
+                return 1;
+            }
+            mem_pool_stats_t st;
+            mem_pool_get_stats(&sram, &st);
+            if (st.frag_pct > worst_frag)
+                worst_frag = st.frag_pct;
+        }
+
+        mem_pool_stats_t st;
+        mem_pool_get_stats(&sram, &st);
+        printf("pass %d: SRAM %u used in %u blocks, peak %u, largest free %u, %u%% fragmented; "
+               "PSRAM %u used, peak %u; %u spills\n",
+               p + 1, st.used, st.blocks, st.peak, st.largest_free, st.frag_pct, psram.used, psram.peak, spills);
+
+        for (size_t i = 0; i < MAP_SLOTS; i++)
+        {
+            if (map[i].key > 1)
+                release(&map[i]);
+        }
+        memset(map, 0, sizeof(map));
+    }
+
+    mem_pool_stats_t st;
+    mem_pool_get_stats(&sram, &st);
+    printf("Worst fragmentation %u%%, %u frees of blocks older than the trace, %u blocks left in the pool\n",
+           worst_frag, unknown / passes, st.blocks);
+    return st.blocks == 0 && mem_pool_check(&sram) ? 0 : 1;
+}
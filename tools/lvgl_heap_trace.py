@@ -0,0 +1,291 @@
+#!/usr/bin/env python3
+"""
+Synthetic LVGL heap trace of the splash, main and history screens.
+
+Writes the allocations LVGL 8.4 makes for the screens of src/layouts and
+src/gui/history_screen.c, in the "lvheap dump" format that
+tools/lvgl_heap_replay.c reads, for replaying without a device:
+
+    python tools/lvgl_heap_trace.py > tools/traces/lvgl_heap_screens.log
+
+The sequence follows a boot and a session:
+- the splash is built, the main screen preloaded during it, the splash deleted;
+- reps are counted, rolling the digits, and the weight is changed;
+- the history screen is opened on 5000 rows and scrolled through with
+  drags and throws, rebinding the row labels;
+- the history is evicted and rebuilt, as the screen manager does.
+
+Object sizes are LVGL 8.4's on a 32-bit target. Local style properties,
+child arrays, event lists and label texts grow with realloc as LVGL grows
+them; label texts set with a format are freed and allocated again. Draw
+buffers over LVGL_HEAP_SMALL_MAX, the ones that go to PSRAM, come from the
+draw buffer pool (lv_mem_buf_get) growing to the widest area drawn.
+"""
+
+import random
+
+# sizeof() on the ESP32-S3
+OBJ = 44
+SPEC_ATTR = 48
+LABEL = 76
+IMG = 80
+ARC = 68
+SWITCH = 52
+DIGIT_ROLL = 96
+VLIST = 44 + 24 * 4 + 24 * 4 + 72   # vlist_t with VLIST_MAX_ROWS rows
+STYLE = 8                           # lv_style_t of local properties
+STYLE_ENTRY = 8                     # _lv_obj_style_t
+STYLE_PROP = 6                      # Value and id of a local property
+EVENT_DSC = 12
+TIMER = 28 + 8                      # lv_timer_t and its list node
+ANIM = 84 + 8                       # lv_anim_t and its list node
+
+EXERCISES = ["DEADLIFT", "SQUAT", "BENCH PRESS", "ROW"]
+
+
+class Heap:
+    """Device addresses of the blocks and the trace of the calls."""
+
+    def __init__(self):
+        self.next = 0x3FC9A000
+        self.events = []
+
+    def _addr(self, size):
+        addr = self.next
+        self.next += (size + 7) & ~7
+        return addr
+
+    def alloc(self, size):
+        addr = self._addr(size)
+        self.events.append("a %x %d" % (addr, size))
+        return addr
+
+    def free(self, addr):
+        if addr:
+            self.events.append("f %x" % addr)
+
+    def realloc(self, addr, size, old_size):
+        if addr == 0:
+            return self.alloc(size)
+        # Grown blocks usually move, shrunk ones stay
+        new = addr if size <= old_size else self._addr(size)
+        self.events.append("r %x %x %d" % (addr, new, size))
+        return new
+
+
+class Obj:
+    def __init__(self, heap, size, parent=None):
+        self.heap = heap
+        self.addr = heap.alloc(size)
+        self.parent = parent
+        self.children = []
+        self.spec = 0
+        self.child_arr = 0
+        self.styles = 0
+        self.style_cnt = 0
+        self.local = 0
+        self.local_props = 0
+        self.local_arr = 0
+        self.events = 0
+        self.event_cnt = 0
+        self.text = 0
+        self.text_len = 0
+        if parent:
+            parent._add_child(self)
+
+    def _spec_attr(self):
+        if self.spec == 0:
+            self.spec = self.heap.alloc(SPEC_ATTR)
+
+    def _add_child(self, child):
+        self._spec_attr()
+        n = len(self.children)
+        self.child_arr = self.heap.realloc(self.child_arr, (n + 1) * 4, n * 4)
+        self.children.append(child)
+
+    def add_style(self):
+        n = self.style_cnt
+        self.styles = self.heap.realloc(self.styles, (n + 1) * STYLE_ENTRY, n * STYLE_ENTRY)
+        self.style_cnt += 1
+
+    def set_prop(self, count=1):
+        for _ in range(count):
+            if self.local == 0:
+                self.add_style()
+                self.local = self.heap.alloc(STYLE)
+            self.local_props += 1
+            # The first property is kept inline in the lv_style_t
+            if self.local_props > 1:
+                n = self.local_props
+                self.local_arr = self.heap.realloc(self.local_arr, n * STYLE_PROP, (n - 1) * STYLE_PROP)
+
+    def add_event(self):
+        self._spec_attr()
+        n = self.event_cnt
+        self.events = self.heap.realloc(self.events, (n + 1) * EVENT_DSC, n * EVENT_DSC)
+        self.event_cnt += 1
+
+    def set_text(self, text):
+        size = len(text) + 1
+        old = self.text
+        self.text = self.heap.realloc(old, size, self.text_len)
+        self.text_len = max(size, self.text_len) if self.text == old else size
+
+    def set_text_fmt(self, text):
+        self.heap.free(self.text)
+        self.text = self.heap.alloc(len(text) + 1)
+        self.text_len = len(text) + 1
+
+    def delete(self):
+        for child in reversed(self.children):
+            child.delete()
+        self.children = []
+        for addr in (self.text, self.events, self.local_arr, self.local, self.styles, self.child_arr, self.spec):
+            self.heap.free(addr)
+        self.heap.free(self.addr)
+
+
+def label(heap, parent, text, props=2):
+    obj = Obj(heap, LABEL, parent)
+    obj.add_style()
+    obj.set_text(text)
+    obj.set_prop(props)
+    return obj
+
+
+def splash(heap):
+    screen = Obj(heap, OBJ)
+    screen.add_style()
+    logo = Obj(heap, IMG, screen)
+    logo.set_prop(3)    # Size and align
+    return screen
+
+
+def main_screen(heap):
+    screen = Obj(heap, OBJ)
+    screen.add_style()
+    logo = Obj(heap, IMG, screen)
+    logo.set_prop(4)
+    logo.add_event()
+    label(heap, screen, "CNS")
+    switch = Obj(heap, SWITCH, screen)
+    switch.add_style()
+    switch.set_prop(4)
+    switch.add_event()
+    label(heap, screen, "ADP")
+    label(heap, screen, "KG")
+    kg_value = label(heap, screen, "15")
+    for hidden in (False, True):
+        arc = Obj(heap, ARC, screen)
+        arc.add_style()
+        if not hidden:
+            arc.add_style()
+            arc.add_event()
+        arc.set_prop(3)
+    label(heap, screen, "REPS")
+    roll = Obj(heap, DIGIT_ROLL, screen)
+    roll.set_prop(2)
+    roll.add_event()
+    label(heap, screen, "DEADLIFT", 3)
+    label(heap, screen, "ADAPTIVE MODE", 3)
+    return screen, kg_value
+
+
+def row_text(rng, i):
+    t = i * 7
+    return "%2d:%02d:%02d   %s   %s %d KG   %d REPS" % (
+        t // 3600, t // 60 % 60, t % 60, rng.choice(EXERCISES), rng.choice(["CNS", "ADP"]),
+        rng.randint(15, 50), rng.randint(1, 30))
+
+
+def history_screen(heap, rng, rows_in_view, first):
+    screen = Obj(heap, OBJ)
+    screen.add_style()
+    title = label(heap, screen, "HISTORY", 3)
+    title.add_event()
+    vlist = Obj(heap, VLIST, screen)
+    vlist.set_prop(4)
+    rows = []
+    for s in range(rows_in_view):
+        row = Obj(heap, LABEL, vlist)
+        row.add_style()
+        row.set_prop(2)
+        row.set_text("Text")    # Default text of a new label
+        rows.append(row)
+    for s, row in enumerate(rows):
+        row.set_text_fmt(row_text(rng, first + s))
+    return screen, rows
+
+
+def scroll(heap, rng, rows, first, to):
+    """Rebind the rows leaving the view to those entering it."""
+    n = len(rows)
+    step = 1 if to > first else -1
+    for i in range(first, to, step):
+        entering = i + n if step > 0 else i - 1
+        if entering < 0:
+            break
+        rows[entering % n].set_text_fmt(row_text(rng, entering))
+    return to
+
+
+def main():
+    rng = random.Random(41)
+    heap = Heap()
+    draw_bufs = [0, 0, 0]
+    draw_sizes = [0, 0, 0]
+
+    def draw(width):
+        # lv_mem_buf_get keeps the buffers, growing one when a wider area is drawn
+        i = min(range(3), key=lambda j: draw_sizes[j])
+        if draw_sizes[i] < width:
+            draw_bufs[i] = heap.realloc(draw_bufs[i], width, draw_sizes[i])
+            draw_sizes[i] = width
+
+    preload_timer = heap.alloc(TIMER)
+    splash_obj = splash(heap)
+    splash_timer = heap.alloc(TIMER)
+    draw(400)
+    main_obj, kg_value = main_screen(heap)
+    heap.free(splash_timer)
+    splash_obj.delete()
+    draw(300)
+    draw(1024)
+
+    # A session: reps roll the digits, the weight goes up and down
+    for rep in range(60):
+        a = heap.alloc(ANIM)
+        draw(rng.choice([120, 300, 1024]))
+        heap.free(a)
+        if rep % 6 == 5:
+            for kg in range(15 + rep // 6, 20 + rep // 6):
+                kg_value.set_text(str(kg))
+
+    for visit in range(3):
+        rows_in_view = 16
+        count = 5000 + visit * 60
+        first = count - rows_in_view
+        history, rows = history_screen(heap, rng, rows_in_view, first)
+        draw(944)
+        for _ in range(8):
+            to = max(0, min(count - rows_in_view, first + rng.randint(-400, 400)))
+            throw = heap.alloc(TIMER)
+            first = scroll(heap, rng, rows, first, to)
+            heap.free(throw)
+        # Back on the main screen, the history is evicted to the budget
+        history.delete()
+        for rep in range(10):
+            a = heap.alloc(ANIM)
+            heap.free(a)
+
+    main_obj.delete()
+    heap.free(preload_timer)
+
+    print("Synthetic trace of tools/lvgl_heap_trace.py: splash, main and history screens")
+    print("LVGL HEAP TRACE BEGIN %d" % len(heap.events))
+    print("\n".join(heap.events))
+    print("LVGL HEAP TRACE END")
+
+
+if __name__ == "__main__":
+    main()
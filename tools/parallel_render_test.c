@@ -0,0 +1,234 @@
+/*
+ * Host tests of the render/flush pipeline in src/display/parallel_render.c.
+ *
+ * The pipeline itself is compiled unchanged against the host stand-ins in
+ * tools/host, FreeRTOS on POSIX threads and the LVGL 8 display driver. The
+ * main thread renders frames in bands into two draw buffers and hands them
+ * over as LVGL's draw_buf_flush does in partial double-buffered mode, while
+ * the flush task copies them into a framebuffer with random delays in place
+ * of the VSYNC wait and the panel copy:
+ *
+ *   cc -O2 -pthread -Itools/host -Isrc/display tools/parallel_render_test.c src/display/parallel_render.c -o parallel_render_test
+ *   ./parallel_render_test [frames] [seed]
+ *
+ * It checks that every band reaches the framebuffer whole, once and in
+ * order, that no band is rendered into the buffer still being flushed,
+ * that every frame is complete on the panel, that no wait for the flush
+ * task misses its wake-up, and that rendering does overlap flushing. Every
+ * few frames the pipeline is switched to synchronous flushing and back, as
+ * parallel_render_enable allows between frames.
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "parallel_render.h"
+
+#define HOR_RES         800
+#define VER_RES         480
+#define BAND_LINES      10   // LVGL_DRAW_BUF_LINES
+#define BANDS           (VER_RES / BAND_LINES)
+#define FLUSH_DELAY_US  300  // Longest wait for VSYNC in a flush
+#define RENDER_DELAY_US 200  // Longest render time of a band
+#define LOST_WAKEUP_US  50000
+#define SYNC_EVERY      8    // Frames between switches to synchronous flushing
+#define SYNC_FRAMES     2
+
+static lv_color_t fb[HOR_RES * VER_RES];
+static lv_color_t buf1[HOR_RES * BAND_LINES];
+static lv_color_t buf2[HOR_RES * BAND_LINES];
+static lv_disp_draw_buf_t draw_buf = {.buf1 = buf1, .buf2 = buf2, .buf_act = buf1, .size = HOR_RES * BAND_LINES};
+static lv_disp_drv_t drv = {.hor_res = HOR_RES, .ver_res = VER_RES, .draw_buf = &draw_buf};
+
+// Bands handed over and not flushed yet, in order; filled by the renderer, drained by the flush
+static struct {
+    uint32_t frame;
+    lv_coord_t y1;
+} expected[4];
+static atomic_uint submitted;
+static atomic_uint flushed;
+
+static _Atomic(const lv_color_t *) flushing_map; // Draw buffer the flush is reading
+static atomic_uint errors;
+static uint32_t overlapped;                      // Bands rendered while the previous one was flushing
+static uint32_t waits;
+static int64_t longest_wait_us;
+static unsigned int render_seed = 1;
+static unsigned int flush_seed = 2;
+
+void boot_mem_register(const char *name, const void *addr, size_t size)
+{
+    (void)name, (void)addr, (void)size;
+}
+
+static int64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void fail(const char *what, uint32_t frame, lv_coord_t y)
+{
+    if (atomic_fetch_add(&errors, 1) < 10)
+        printf("FAIL %s, frame %u line %d\n", what, frame, y);
+}
+
+static uint16_t pixel(uint32_t frame, int x, int y)
+{
+    return (uint16_t)(frame * 7919 + y * 31 + x);
+}
+
+static bool band_matches(const lv_color_t *map, uint32_t frame, lv_coord_t y1)
+{
+    for (int y = 0; y < BAND_LINES; y++)
+        for (int x = 0; x < HOR_RES; x++)
+            if (map[y * HOR_RES + x].full != pixel(frame, x, y1 + y))
+                return false;
+    return true;
+}
+
+// Stands in for lvgl_flush_area: the VSYNC wait, then the copy to the panel
+static void flush_area(lv_disp_drv_t *d, const lv_area_t *area, lv_color_t *color_map)
+{
+    uint32_t n = atomic_load(&flushed);
+    uint32_t frame = expected[n % 4].frame;
+
+    atomic_store(&flushing_map, color_map);
+    if (n == atomic_load(&submitted) || area->y1 != expected[n % 4].y1 || area->y2 != area->y1 + BAND_LINES - 1)
+        fail("band flushed out of order", frame, area->y1);
+    if (!d->draw_buf->flushing)
+        fail("band flushed without the buffer marked as flushing", frame, area->y1);
+
+    usleep(rand_r(&flush_seed) % FLUSH_DELAY_US);
+    for (int y = 0; y < BAND_LINES; y++)
+    {
+        memcpy(&fb[(area->y1 + y) * HOR_RES], &color_map[y * HOR_RES], HOR_RES * sizeof(lv_color_t));
+        if (y == BAND_LINES / 2)
+            usleep(rand_r(&flush_seed) % FLUSH_DELAY_US);
+    }
+    if (!band_matches(color_map, frame, area->y1))
+        fail("band overwritten while it was flushed", frame, area->y1);
+
+    atomic_store(&flushing_map, NULL);
+    atomic_fetch_add(&flushed, 1);
+}
+
+// Stands in for lvgl_flush_cb
+static void flush_cb(lv_disp_drv_t *d, const lv_area_t *area, lv_color_t *color_map)
+{
+    if (parallel_render_is_enabled())
+    {
+        parallel_render_submit(d, area, color_map);
+        return;
+    }
+    flush_area(d, area, color_map);
+    lv_disp_flush_ready(d);
+}
+
+// As LVGL spins on draw_buf->flushing, calling wait_cb
+static void wait_flushed(void)
+{
+    while (draw_buf.flushing)
+    {
+        int64_t start = now_us();
+        drv.wait_cb(&drv);
+        int64_t waited = now_us() - start;
+        waits++;
+        if (waited > longest_wait_us)
+            longest_wait_us = waited;
+    }
+}
+
+// Render one band into the active buffer and hand it over, as LVGL's draw_buf_flush does
+static void render_band(uint32_t frame, lv_coord_t y1, bool last)
+{
+    lv_color_t *map = draw_buf.buf_act;
+
+    if (atomic_load(&flushing_map) == map)
+        fail("band rendered into the buffer being flushed", frame, y1);
+    overlapped += draw_buf.flushing != 0;
+    for (int y = 0; y < BAND_LINES; y++)
+        for (int x = 0; x < HOR_RES; x++)
+            map[y * HOR_RES + x].full = pixel(frame, x, y1 + y);
+    usleep(rand_r(&render_seed) % RENDER_DELAY_US);
+
+    // Partial double buffering: wait until the other buffer is released
+    wait_flushed();
+    draw_buf.flushing = 1;
+    draw_buf.flushing_last = last;
+
+    uint32_t n = atomic_load(&submitted);
+    expected[n % 4].frame = frame;
+    expected[n % 4].y1 = y1;
+    atomic_store(&submitted, n + 1);
+
+    lv_area_t area = {0, y1, HOR_RES - 1, y1 + BAND_LINES - 1};
+    drv.flush_cb(&drv, &area, map);
+    draw_buf.buf_act = map == buf1 ? buf2 : buf1;
+}
+
+static bool frame_on_panel(uint32_t frame)
+{
+    for (int y = 0; y < VER_RES; y++)
+        for (int x = 0; x < HOR_RES; x++)
+            if (fb[y * HOR_RES + x].full != pixel(frame, x, y))
+                return false;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 200;
+    uint32_t incomplete = 0;
+    uint32_t sync_frames = 0;
+
+    if (argc > 2)
+    {
+        render_seed = (unsigned int)atoi(argv[2]);
+        flush_seed = render_seed + 1;
+    }
+
+    drv.flush_cb = flush_cb;
+    drv.wait_cb = parallel_render_wait_cb;
+    parallel_render_init(flush_area, 1);
+
+    int64_t start = now_us();
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        // Switched between frames, with the last band of the previous one possibly still in flight
+        bool sync = frame % SYNC_EVERY >= SYNC_EVERY - SYNC_FRAMES;
+        parallel_render_enable(!sync);
+        sync_frames += sync;
+
+        for (int band = 0; band < BANDS; band++)
+            render_band(frame, band * BAND_LINES, band == BANDS - 1);
+
+        // Only to check the panel; LVGL itself moves on to the next frame
+        wait_flushed();
+        if (!frame_on_panel(frame))
+        {
+            fail("frame incomplete on the panel", frame, 0);
+            incomplete++;
+        }
+    }
+    int64_t elapsed = now_us() - start;
+
+    if (atomic_load(&flushed) != atomic_load(&submitted))
+        fail("bands lost", frames, 0);
+    if (longest_wait_us > LOST_WAKEUP_US)
+        fail("wait for the flush task missed its wake-up", frames, 0);
+    if (overlapped == 0)
+        fail("rendering never overlapped flushing", frames, 0);
+
+    printf("%u frames (%u synchronous), %u bands flushed, %u incomplete frames\n", frames, sync_frames,
+           atomic_load(&flushed), incomplete);
+    printf("%u bands rendered while the previous one flushed, %u waits, longest %lld us, %.1f ms per frame\n",
+           overlapped, waits, (long long)longest_wait_us, elapsed / 1000.0 / frames);
+    printf("%u errors\n", atomic_load(&errors));
+    return atomic_load(&errors) ? 1 : 0;
+}
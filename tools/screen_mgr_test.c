@@ -0,0 +1,286 @@
+/*
+ * Host tests of the screen manager in src/gui/screen_mgr.c.
+ *
+ * Runs the manager on the host LVGL stand-in of tools/host, where the LVGL
+ * heap is what the live objects take, through a boot and a session: the
+ * splash shown, the main screen preloaded in its idle frames, the splash
+ * deleted on leaving it, then visits of screens that together overflow
+ * SCREEN_MGR_BUDGET. After every step the cached bytes must be what the
+ * built, unpinned screens not shown took to create:
+ *
+ *   cc -O2 -Itools/host -Isrc/gui -Isrc/display tools/screen_mgr_test.c src/gui/screen_mgr.c \
+ *      tools/host/lvgl_host.c -o screen_mgr_test
+ *   ./screen_mgr_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "screen_mgr.h"
+#include "lvgl_heap.h"
+
+#define BLOCK_SIZE 1000 // Heap taken by one block object of the test screens
+
+enum {
+    SPLASH,
+    MAIN,
+    HISTORY,
+    SETTINGS,
+    INFO,
+    SCREENS,
+};
+
+static const lv_obj_class_t block_class = {
+    .base_class = &lv_obj_class,
+    .instance_size = BLOCK_SIZE,
+};
+
+static uint32_t builds[SCREENS];
+static uint32_t binds[SCREENS];
+static uint32_t unbinds[SCREENS];
+
+// A screen of blocks, its size standing for the widgets of the real one
+static lv_obj_t *build(uint8_t id, uint32_t blocks)
+{
+    lv_obj_t *screen = lv_obj_create(NULL);
+    for (uint32_t i = 0; i < blocks; i++)
+        lv_obj_class_init_obj(lv_obj_class_create_obj(&block_class, screen));
+    screen->user_data = (void *)(uintptr_t)(id + 1);
+    builds[id]++;
+    return screen;
+}
+
+static lv_obj_t *splash_create(void)
+{
+    return build(SPLASH, 3);
+}
+
+static lv_obj_t *main_create(void)
+{
+    return build(MAIN, 30); // Over the budget alone, but pinned
+}
+
+static lv_obj_t *history_create(void)
+{
+    return build(HISTORY, 10);
+}
+
+static lv_obj_t *settings_create(void)
+{
+    return build(SETTINGS, 10);
+}
+
+static lv_obj_t *info_create(void)
+{
+    return build(INFO, 10);
+}
+
+static uint8_t screen_id(const lv_obj_t *screen)
+{
+    return (uint8_t)((uintptr_t)screen->user_data - 1);
+}
+
+static void show(lv_obj_t *screen)
+{
+    binds[screen_id(screen)]++;
+}
+
+static void hide(lv_obj_t *screen)
+{
+    unbinds[screen_id(screen)]++;
+}
+
+static const screen_def_t defs[SCREENS] = {
+    [SPLASH] = {"splash", SCREEN_DISCARD, MAIN, splash_create, NULL, NULL},
+    [MAIN] = {"main", SCREEN_PINNED, HISTORY, main_create, show, hide},
+    [HISTORY] = {"history", 0, MAIN, history_create, show, hide},
+    [SETTINGS] = {"settings", 0, MAIN, settings_create, show, hide},
+    [INFO] = {"info", 0, MAIN, info_create, show, hide},
+};
+
+static int failed;
+
+// The manager counts the LVGL heap around each creation
+uint32_t lvgl_heap_used(void)
+{
+    return host_lv_mem_used();
+}
+
+static void expect(bool ok, const char *what)
+{
+    printf("%-4s %s\n", ok ? "ok" : "FAIL", what);
+    failed += !ok;
+}
+
+// Heap of a screen as built, the screen object and its blocks
+static uint32_t cost(uint8_t id)
+{
+    static const uint32_t blocks[SCREENS] = {3, 30, 10, 10, 10};
+    return sizeof(lv_obj_t) + blocks[id] * BLOCK_SIZE;
+}
+
+// What stats.cached must be: the built screens that are not shown and not pinned
+static uint32_t expected_cached(void)
+{
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < SCREENS; i++)
+    {
+        if (screen_mgr_get(i) && i != screen_mgr_active() && !(defs[i].flags & SCREEN_PINNED))
+            sum += cost(i);
+    }
+    return sum;
+}
+
+static void check_cached(const char *after)
+{
+    screen_mgr_stats_t stats;
+    char what[96];
+
+    screen_mgr_get_stats(&stats);
+    snprintf(what, sizeof(what), "cached %lu bytes after %s, within the budget", (unsigned long)stats.cached, after);
+    expect(stats.cached == expected_cached() && stats.cached <= SCREEN_MGR_BUDGET, what);
+}
+
+// Busy frames: the preload timer must wait
+static void run_busy(uint32_t ms)
+{
+    host_lv_set_idle(10, 0);
+    host_lv_tick_inc(ms);
+}
+
+static void run_idle(uint32_t ms)
+{
+    host_lv_set_idle(100, 0);
+    host_lv_tick_inc(ms);
+    host_lv_set_idle(10, 0);
+}
+
+static void test_splash(void)
+{
+    screen_mgr_stats_t stats;
+
+    run_busy(1);
+    screen_mgr_init(defs, SCREENS);
+    expect(screen_mgr_show(SPLASH) && lv_scr_act() == screen_mgr_get(SPLASH), "splash shown");
+    check_cached("showing the splash");
+
+    run_busy(5 * SCREEN_MGR_PRELOAD_PERIOD);
+    host_lv_set_idle(100, 1);
+    host_lv_tick_inc(5 * SCREEN_MGR_PRELOAD_PERIOD);
+    expect(screen_mgr_get(MAIN) == NULL, "no preload while frames are busy or an animation runs");
+
+    run_idle(SCREEN_MGR_PRELOAD_PERIOD);
+    screen_mgr_get_stats(&stats);
+    expect(screen_mgr_get(MAIN) && stats.preloaded == 1 && builds[MAIN] == 1,
+           "main preloaded in an idle frame of the splash");
+    expect(screen_mgr_active() == SPLASH && lv_scr_act() == screen_mgr_get(SPLASH) && binds[MAIN] == 0,
+           "splash still shown, main not bound");
+    check_cached("preloading the pinned main screen");
+
+    run_idle(5 * SCREEN_MGR_PRELOAD_PERIOD);
+    expect(builds[MAIN] == 1, "main preloaded once");
+}
+
+static void test_leave_splash(void)
+{
+    screen_mgr_stats_t stats;
+    lv_obj_t *main_obj = screen_mgr_get(MAIN);
+    uint32_t objs = host_lv_obj_count();
+    uint32_t mem = host_lv_mem_used();
+
+    run_busy(10);
+    expect(screen_mgr_show(MAIN), "main shown");
+    screen_mgr_get_stats(&stats);
+    expect(stats.hits == 1 && stats.created == 2 && builds[MAIN] == 1, "main shown from the cache, not built again");
+    expect(lv_scr_act() == main_obj && binds[MAIN] == 1, "main loaded and bound");
+    expect(screen_mgr_get(SPLASH) == NULL && stats.evicted == 1, "splash discarded");
+    expect(host_lv_obj_count() == objs, "splash deleted after the event being handled");
+    check_cached("leaving the splash");
+
+    run_busy(1);
+    expect(host_lv_obj_count() == objs - 4 && host_lv_mem_used() == mem - cost(SPLASH),
+           "splash and its children deleted on the next timer run");
+}
+
+static void test_history(void)
+{
+    screen_mgr_stats_t stats;
+
+    run_idle(SCREEN_MGR_PRELOAD_PERIOD);
+    screen_mgr_get_stats(&stats);
+    expect(screen_mgr_get(HISTORY) && stats.preloaded == 2 && binds[HISTORY] == 0, "history preloaded from main");
+    check_cached("preloading history");
+
+    run_busy(10);
+    expect(screen_mgr_show(HISTORY), "history shown");
+    screen_mgr_get_stats(&stats);
+    expect(stats.hits == 2 && builds[HISTORY] == 1 && binds[HISTORY] == 1 && unbinds[MAIN] == 1,
+           "history shown from the cache, main unbound");
+    check_cached("showing history");
+
+    run_busy(10);
+    expect(screen_mgr_show(MAIN), "back to main");
+    screen_mgr_get_stats(&stats);
+    expect(stats.hits == 3 && unbinds[HISTORY] == 1 && screen_mgr_get(HISTORY), "main from the cache, history kept");
+    check_cached("going back to main");
+}
+
+// Three 10 kB screens do not fit in the 24 kB budget: the least recently shown goes, never main or the next one
+static void test_eviction(void)
+{
+    screen_mgr_stats_t stats;
+    uint32_t evicted;
+
+    screen_mgr_get_stats(&stats);
+    evicted = stats.evicted;
+
+    run_busy(10);
+    screen_mgr_show(SETTINGS);
+    check_cached("showing settings");
+    run_busy(10);
+    screen_mgr_show(INFO);
+    check_cached("showing info");
+    screen_mgr_get_stats(&stats);
+    expect(stats.evicted == evicted && screen_mgr_get(HISTORY) && screen_mgr_get(SETTINGS),
+           "history and settings cached within the budget");
+
+    run_busy(10);
+    screen_mgr_show(MAIN);
+    check_cached("three screens cached over the budget");
+    screen_mgr_get_stats(&stats);
+    expect(stats.evicted == evicted + 1 && screen_mgr_get(SETTINGS) == NULL,
+           "least recently shown evicted, settings");
+    expect(screen_mgr_get(HISTORY) && screen_mgr_get(INFO) && screen_mgr_get(MAIN),
+           "history kept as the next screen, info as the more recent");
+
+    run_busy(10);
+    expect(screen_mgr_preload(SETTINGS), "settings preloaded over the budget");
+    screen_mgr_get_stats(&stats);
+    expect(stats.evicted == evicted + 2 && screen_mgr_get(HISTORY) == NULL && screen_mgr_get(INFO),
+           "room made by evicting history, now the least recently shown");
+    check_cached("preloading settings");
+    expect(!screen_mgr_preload(SETTINGS), "a built screen is not preloaded again");
+
+    run_busy(10);
+    screen_mgr_show(HISTORY);
+    expect(builds[HISTORY] == 2 && screen_mgr_get(MAIN), "evicted screen built again on show, main pinned");
+    check_cached("showing an evicted screen");
+
+    run_busy(1);
+    uint32_t held = 0;
+    for (uint8_t i = 0; i < SCREENS; i++)
+        held += screen_mgr_get(i) ? cost(i) : 0;
+    expect(host_lv_mem_used() == held, "evicted screens freed");
+}
+
+int main(void)
+{
+    test_splash();
+    test_leave_splash();
+    test_history();
+    test_eviction();
+
+    printf("%d checks failed\n", failed);
+    return failed ? 1 : 0;
+}
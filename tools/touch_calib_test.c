@@ -0,0 +1,178 @@
+/*
+ * Host tests of the touch calibration solver in src/display/touch_calib.c.
+ *
+ * Each case maps the calibration targets back through a known panel
+ * mapping (mirrored, offset, scaled, rotated or with swapped axes) to the
+ * raw points a finger on them would report, with or without tapping
+ * errors, and checks that touch_calib_solve finds the mapping again: the
+ * fit is accepted or rejected as expected, and touch_calib_apply lands
+ * within the tolerance of the true mapping over the whole panel and a
+ * margin past its edges, where raw samples may fall. Exact taps come within
+ * the rounding of the raw points; 3 taps with errors get no averaging and
+ * drift the most towards the edges:
+ *
+ *   cc -O2 -Isrc/display tools/touch_calib_test.c src/display/touch_calib.c -lm -o touch_calib_test
+ *   ./touch_calib_test
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "touch_calib.h"
+
+#define PANEL_W      800
+#define PANEL_H      480
+#define INSET_PCT    10  // CALIB_SCREEN_INSET
+#define MARGIN_PX    100 // Raw samples checked past the panel edges
+#define GRID_STEP_PX 8
+
+// Screen = [a b c; d e f] * [raw_x raw_y 1]
+typedef struct {
+    double a, b, c;
+    double d, e, f;
+} mapping_t;
+
+typedef struct {
+    const char *name;
+    mapping_t map;
+    int count;                                           // Targets tapped, in calib_screen.c order
+    touch_calib_point_t tap_err[TOUCH_CALIB_MAX_POINTS]; // Raw offset of each tap from the target
+    bool accept;                                         // Solved and within TOUCH_CALIB_MAX_ERR_PX
+    double tolerance_px;                                 // Largest distance from the true mapping
+} calib_case_t;
+
+// As calib_screen.c places them
+static const touch_calib_point_t target_pct[TOUCH_CALIB_MAX_POINTS] = {
+    {INSET_PCT, INSET_PCT},
+    {100 - INSET_PCT, INSET_PCT},
+    {100 - INSET_PCT, 100 - INSET_PCT},
+    {INSET_PCT, 100 - INSET_PCT},
+    {50, 50},
+};
+
+#define MIRRORED {-1, 0, PANEL_W, 0, -1, PANEL_H + 150} // TOUCH_CALIB_DEFAULT of the boards
+
+static const calib_case_t cases[] = {
+    {"identity, 3 points", {1, 0, 0, 0, 1, 0}, 3, {{0}}, true, 1.5},
+    {"identity, 5 points", {1, 0, 0, 0, 1, 0}, 5, {{0}}, true, 1.5},
+    {"board default", MIRRORED, 5, {{0}}, true, 1.5},
+    {"offset", {1, 0, -37, 0, 1, 21}, 5, {{0}}, true, 1.5},
+    {"scaled, 1024x600 controller", {0.78125, 0, 0, 0, 0.8, 0}, 5, {{0}}, true, 1.5},
+    {"swapped axes", {0, 1, 0, 1, 0, 0}, 5, {{0}}, true, 1.5},
+    {"rotated 2 degrees", {0.99939, -0.03490, 12, 0.03490, 0.99939, -8}, 5, {{0}}, true, 1.5},
+    {"skewed and scaled", {1.1, 0.05, -20, -0.03, 0.95, 30}, 5, {{0}}, true, 1.5},
+    {"board default, tapping errors", MIRRORED, 5, {{3, -2}, {-2, 3}, {2, 2}, {-3, -1}, {1, -2}}, true, 6},
+    {"offset, tapping errors, 3 points", {1, 0, -37, 0, 1, 21}, 3, {{3, -2}, {-2, 3}, {2, 2}}, true, 12},
+    {"one tap far off the target", MIRRORED, 5, {{0}, {0}, {40, 30}, {0}, {0}}, false, 0},
+    {"one tap on the wrong target", MIRRORED, 5, {{0}, {0}, {0}, {0, -PANEL_H * 8 / 10}, {0}}, false, 0},
+};
+
+static void map_point(const mapping_t *m, double rx, double ry, double *sx, double *sy)
+{
+    *sx = m->a * rx + m->b * ry + m->c;
+    *sy = m->d * rx + m->e * ry + m->f;
+}
+
+// Raw point a finger on screen point (sx, sy) reports
+static bool unmap_point(const mapping_t *m, double sx, double sy, double *rx, double *ry)
+{
+    double det = m->a * m->e - m->b * m->d;
+    if (fabs(det) < 1e-9)
+        return false;
+    *rx = (m->e * (sx - m->c) - m->b * (sy - m->f)) / det;
+    *ry = (m->a * (sy - m->f) - m->d * (sx - m->c)) / det;
+    return true;
+}
+
+// Largest distance of touch_calib_apply from the true mapping, over the panel and the margin around it
+static double max_deviation(const mapping_t *m, const touch_calib_t *calib)
+{
+    double worst = 0;
+
+    for (int sy = -MARGIN_PX; sy <= PANEL_H + MARGIN_PX; sy += GRID_STEP_PX)
+    {
+        for (int sx = -MARGIN_PX; sx <= PANEL_W + MARGIN_PX; sx += GRID_STEP_PX)
+        {
+            double rx, ry, ex, ey;
+            unmap_point(m, sx, sy, &rx, &ry);
+            int32_t x = (int32_t)lround(rx);
+            int32_t y = (int32_t)lround(ry);
+            map_point(m, x, y, &ex, &ey);
+            touch_calib_apply(calib, &x, &y);
+            worst = fmax(worst, hypot(x - ex, y - ey));
+        }
+    }
+    return worst;
+}
+
+static bool run_case(const calib_case_t *c)
+{
+    touch_calib_point_t raw[TOUCH_CALIB_MAX_POINTS];
+    touch_calib_point_t screen[TOUCH_CALIB_MAX_POINTS];
+    touch_calib_t calib;
+    int32_t max_err = -1;
+
+    for (int i = 0; i < c->count; i++)
+    {
+        double rx, ry;
+        screen[i].x = PANEL_W * target_pct[i].x / 100;
+        screen[i].y = PANEL_H * target_pct[i].y / 100;
+        if (!unmap_point(&c->map, screen[i].x, screen[i].y, &rx, &ry))
+            return false;
+        raw[i].x = (int32_t)lround(rx) + c->tap_err[i].x;
+        raw[i].y = (int32_t)lround(ry) + c->tap_err[i].y;
+    }
+
+    bool solved = touch_calib_solve(raw, screen, c->count, &calib, &max_err);
+    bool accepted = solved && max_err <= TOUCH_CALIB_MAX_ERR_PX;
+    double deviation = accepted ? max_deviation(&c->map, &calib) : 0;
+    bool ok = accepted == c->accept && deviation <= c->tolerance_px;
+
+    printf("%-4s %-36s", ok ? "ok" : "FAIL", c->name);
+    if (solved)
+        printf(" fit error %2ldpx", (long)max_err);
+    if (accepted)
+        printf(", %.2fpx off over the panel", deviation);
+    printf("%s\n", accepted ? "" : ", rejected");
+    return ok;
+}
+
+// Points the solver must refuse rather than return a matrix for
+static const touch_calib_point_t targets[TOUCH_CALIB_MAX_POINTS] = {{80, 48}, {720, 48}, {720, 432}, {80, 432}, {400, 240}};
+static const touch_calib_point_t collinear[TOUCH_CALIB_MAX_POINTS] = {{80, 48}, {240, 144}, {400, 240}, {560, 336}, {720, 432}};
+static const touch_calib_point_t repeated[TOUCH_CALIB_MAX_POINTS] = {{300, 200}, {300, 200}, {300, 200}, {300, 200}, {300, 200}};
+
+static const struct {
+    const char *name;
+    const touch_calib_point_t *raw;
+    int count;
+} refused[] = {
+    {"collinear taps", collinear, 5},
+    {"one point tapped over and over", repeated, 5},
+    {"two points", targets, 2},
+    {"more than TOUCH_CALIB_MAX_POINTS", targets, TOUCH_CALIB_MAX_POINTS + 1}, // Refused before reading them
+};
+
+static bool run_refused(size_t i)
+{
+    touch_calib_t calib;
+    bool ok = !touch_calib_solve(refused[i].raw, targets, refused[i].count, &calib, NULL);
+
+    printf("%-4s %-36s%s\n", ok ? "ok" : "FAIL", refused[i].name, ok ? " refused" : " solved");
+    return ok;
+}
+
+int main(void)
+{
+    size_t total = sizeof(cases) / sizeof(cases[0]) + sizeof(refused) / sizeof(refused[0]);
+    int failed = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        failed += !run_case(&cases[i]);
+    for (size_t i = 0; i < sizeof(refused) / sizeof(refused[0]); i++)
+        failed += !run_refused(i);
+
+    printf("%d of %zu cases failed\n", failed, total);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * Host tests of the touch filter in src/display/touch_filter.c.
+ *
+ * Replays touch traces through the filter the way the touch driver feeds
+ * it, one sample per report, and checks the jitter and latency it reports
+ * in its statistics. The cases are the synthetic strokes the filter was
+ * tuned on, at 100 Hz with +/-2 px of noise: a finger held still and a
+ * 600 px/s straight drag, and the canned arc drag of touch_trace_replay.c
+ * (src/task/trace_bench.c), clean and with the same noise:
+ *
+ *   cc -O2 -Isrc/display -Isrc/task tools/touch_filter_test.c src/display/touch_filter.c src/task/touch_trace.c \
+ *      -lm -o touch_filter_test
+ *   ./touch_filter_test
+ *
+ * Traces recorded on the device (CONFIG_TRACE_RECORD) are replayed and
+ * measured, checking only that the filter never adds jitter:
+ *
+ *   ./touch_filter_test monitor.log
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "touch_filter.h"
+#include "touch_trace.h"
+
+#define MAX_SAMPLES   8192
+#define PERIOD_US     10000   // GT911 report period, TOUCH_POLL_PERIOD_MS
+#define NOISE_PX      2       // Coordinate noise of the GT911
+#define ARC_DRAG_US   1500000 // TRACE_BENCH_DRAG_US
+#define STROKE_US     1500000
+
+typedef struct {
+    double raw_jitter;  // px per sample
+    double out_jitter;
+    double lag_ms;      // Smoothing lag at the stroke's speed
+    double lead_ms;     // Predicted lead at that speed
+} filter_result_t;
+
+typedef struct {
+    const char *name;
+    void (*build)(touch_trace_t *trace);
+    double max_out_jitter;  // px per sample
+    double max_jitter_ratio; // Output over raw jitter
+    double max_lag_ms;      // 0 when the finger does not move
+    double min_net_ms;      // Lead minus lag, the latency hidden
+} filter_case_t;
+
+static touch_trace_record_t records[MAX_SAMPLES];
+static uint32_t seed;
+
+static int noise(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed >> 16) % (2 * NOISE_PX + 1)) - NOISE_PX;
+}
+
+static void add_noise(touch_trace_t *trace)
+{
+    seed = 1;
+    for (uint32_t i = 0; i < trace->header.count; i++)
+    {
+        if (!(trace->records[i].flags & TOUCH_TRACE_PRESSED))
+            continue;
+        trace->records[i].x += noise();
+        trace->records[i].y += noise();
+    }
+}
+
+static void line(touch_trace_t *trace, double x0, double y0, double vx, double vy)
+{
+    int64_t t = 0;
+    for (uint32_t i = 0; i <= STROKE_US / PERIOD_US; i++, t += PERIOD_US)
+        touch_trace_append(trace, t, (uint16_t)(x0 + vx * t / 1e6 + 0.5), (uint16_t)(y0 + vy * t / 1e6 + 0.5), 40, 1,
+                           true);
+    touch_trace_append(trace, t, trace->records[trace->header.count - 1].x,
+                       trace->records[trace->header.count - 1].y, 0, 0, false);
+}
+
+static void still_finger(touch_trace_t *trace)
+{
+    line(trace, 400, 240, 0, 0);
+    add_noise(trace);
+}
+
+static void straight_drag(touch_trace_t *trace)
+{
+    line(trace, 100, 240, 600, 0);
+    add_noise(trace);
+}
+
+static void arc_drag(touch_trace_t *trace)
+{
+    touch_trace_make_arc_drag(trace, 400, 240, 150, 135, 405, ARC_DRAG_US, PERIOD_US);
+}
+
+static void noisy_arc_drag(touch_trace_t *trace)
+{
+    arc_drag(trace);
+    add_noise(trace);
+}
+
+// Feeds the pressed samples at their recorded times; the next press is a new stroke, as a new track_id is in
+// touch_process_coordinates
+static void run_filter(const touch_trace_t *trace, filter_result_t *result)
+{
+    touch_filter_t filter;
+    touch_filter_stats_t stats;
+    int64_t t = 0;
+
+    touch_filter_init(&filter, NULL);
+    for (uint32_t i = 0; i < trace->header.count; i++)
+    {
+        const touch_trace_record_t *r = &trace->records[i];
+        t += r->dt_us;
+        if (!(r->flags & TOUCH_TRACE_PRESSED))
+        {
+            touch_filter_restart(&filter);
+            continue;
+        }
+        uint16_t x = r->x;
+        uint16_t y = r->y;
+        touch_filter_update(&filter, t, &x, &y);
+    }
+
+    touch_filter_get_stats(&filter, &stats);
+    double samples = stats.samples ? stats.samples : 1;
+    result->raw_jitter = stats.raw_jitter / 16.0 / samples;
+    result->out_jitter = stats.out_jitter / 16.0 / samples;
+    result->lag_ms = stats.speed ? stats.filter_lag * 1000.0 / stats.speed : 0;
+    result->lead_ms = stats.speed ? stats.lead * 1000.0 / stats.speed : 0;
+}
+
+static void print_result(const char *name, const filter_result_t *r)
+{
+    printf("%-22s jitter %.2f -> %.2f px, lag %.1f ms, lead %.1f ms\n", name, r->raw_jitter, r->out_jitter,
+           r->lag_ms, r->lead_ms);
+}
+
+static bool run_case(const filter_case_t *c)
+{
+    touch_trace_t trace;
+    filter_result_t r;
+
+    touch_trace_init(&trace, records, MAX_SAMPLES);
+    c->build(&trace);
+    run_filter(&trace, &r);
+
+    bool ok = r.out_jitter <= c->max_out_jitter && r.out_jitter <= r.raw_jitter * c->max_jitter_ratio;
+    if (c->max_lag_ms > 0)
+        ok = ok && r.lag_ms <= c->max_lag_ms && r.lead_ms - r.lag_ms >= c->min_net_ms;
+    printf("%-4s ", ok ? "ok" : "FAIL");
+    print_result(c->name, &r);
+    return ok;
+}
+
+static int replay_log(const char *path)
+{
+    touch_trace_t trace;
+    int n = 0;
+    int failed = 0;
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    while (!feof(f))
+    {
+        touch_trace_init(&trace, records, MAX_SAMPLES);
+        if (!touch_trace_load(&trace, f))
+            break;
+
+        filter_result_t r;
+        char name[32];
+        run_filter(&trace, &r);
+        snprintf(name, sizeof(name), "trace %d", ++n);
+        printf("%-4s ", r.out_jitter <= r.raw_jitter ? "ok" : "FAIL");
+        print_result(name, &r);
+        failed += r.out_jitter > r.raw_jitter;
+    }
+    fclose(f);
+
+    if (n == 0)
+    {
+        fprintf(stderr, "%s: no TRACE BEGIN ... TRACE END dump\n", path);
+        return 1;
+    }
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    // Bounds of the figures measured when the filter was tuned: still 3.05 -> 0.39 px; 600 px/s drag
+    // 3.12 -> 0.72 px, lag 7.8 ms, lead 18.2 ms
+    static const filter_case_t cases[] = {
+        {"still finger", still_finger, 0.45, 0.15, 0, 0},
+        {"600 px/s drag", straight_drag, 0.80, 0.25, 9.0, 9.0},
+        // 470 px/s around a 150 px radius, the curve adding to the jitter of the straight drag
+        {"arc drag", arc_drag, 0.40, 0.60, 9.0, 9.0},
+        {"arc drag, noisy", noisy_arc_drag, 0.95, 0.35, 9.0, 9.0},
+    };
+    int failed = 0;
+
+    if (argc > 1)
+        return replay_log(argv[1]);
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+        failed += !run_case(&cases[i]);
+    printf("%d of %zu cases failed\n", failed, sizeof(cases) / sizeof(cases[0]));
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * Host replay of touch traces through the gesture recogniser.
+ *
+ * Record a trace on the device (CONFIG_TRACE_RECORD) and save the serial
+ * log; every TRACE BEGIN ... TRACE END dump in it is read back with
+ * touch_trace_load and fed to src/task/gesture.c the way the touch task
+ * replays it, at the recorded times:
+ *
+ *   cc -O2 -Isrc/task tools/touch_trace_replay.c src/task/touch_trace.c src/task/gesture.c -lm -o touch_trace_replay
+ *   ./touch_trace_replay monitor.log
+ *
+ * Without a log it replays the canned arc drag of src/task/trace_bench.c.
+ * For each trace it prints the strokes, their length and speed, the longest
+ * gap between samples, and the gestures recognised.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gesture.h"
+#include "touch_trace.h"
+
+#define MAX_SAMPLES     8192
+#define ARC_DRAG_US     1500000 // Canned drag of trace_bench.c
+#define ARC_PERIOD_US   10000   // TOUCH_POLL_PERIOD_MS
+
+static touch_trace_record_t records[MAX_SAMPLES];
+
+static void replay(const touch_trace_t *trace, int n)
+{
+    gesture_recognizer_t rec;
+    gesture_t gesture;
+    int64_t t = 0;
+    int64_t stroke_us = 0;
+    uint32_t strokes = 0;
+    uint32_t max_gap = 0;
+    double length = 0;
+    double stroke_length = 0;
+    const touch_trace_record_t *prev = NULL;
+
+    printf("trace %d: %u samples, %.3f s\n", n, trace->header.count, touch_trace_duration_us(trace) / 1e6);
+    gesture_init(&rec);
+    for (uint32_t i = 0; i < trace->header.count; i++)
+    {
+        const touch_trace_record_t *r = &trace->records[i];
+        bool pressed = r->flags & TOUCH_TRACE_PRESSED;
+
+        t += r->dt_us;
+        if (i > 0 && r->dt_us > max_gap)
+            max_gap = r->dt_us;
+
+        if (pressed && (prev == NULL || !(prev->flags & TOUCH_TRACE_PRESSED)))
+        {
+            strokes++;
+            stroke_us = t;
+            stroke_length = 0;
+        }
+        else if (pressed)
+        {
+            double dx = (double)r->x - prev->x;
+            double dy = (double)r->y - prev->y;
+            stroke_length += sqrt(dx * dx + dy * dy);
+        }
+        else if (prev && (prev->flags & TOUCH_TRACE_PRESSED))
+        {
+            double ms = (t - stroke_us) / 1000.0;
+            printf("  stroke %u: %.0f px in %.0f ms, %.0f px/s\n", strokes, stroke_length, ms,
+                   ms > 0 ? stroke_length * 1000 / ms : 0);
+            length += stroke_length;
+        }
+
+        // Traces hold the first point only, as in the touch task's replay
+        gesture_input_t in = {
+            .time_us = t,
+            .x = r->x,
+            .y = r->y,
+            .x2 = r->x,
+            .y2 = r->y,
+            .points = pressed ? r->points : 0,
+        };
+        if (gesture_feed(&rec, &in, &gesture))
+            printf("  %8.3f s  %s at (%d, %d)\n", gesture.time_us / 1e6, gesture_name(gesture.type), gesture.x,
+                   gesture.y);
+        prev = r;
+    }
+    printf("  %u strokes, %.0f px, longest gap between samples %u ms\n", strokes, length, max_gap / 1000);
+}
+
+int main(int argc, char **argv)
+{
+    touch_trace_t trace;
+    int n = 0;
+
+    touch_trace_init(&trace, records, MAX_SAMPLES);
+    if (argc < 2)
+    {
+        if (!touch_trace_make_arc_drag(&trace, 400, 240, 150, 135, 405, ARC_DRAG_US, ARC_PERIOD_US))
+            return 1;
+        replay(&trace, 1);
+        return 0;
+    }
+
+    FILE *f = fopen(argv[1], "r");
+    if (f == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    while (!feof(f))
+    {
+        touch_trace_init(&trace, records, MAX_SAMPLES);
+        if (!touch_trace_load(&trace, f))
+        {
+            if (!feof(f))
+            {
+                fprintf(stderr, "%s: trace %d is malformed or longer than %d samples\n", argv[1], n + 1, MAX_SAMPLES);
+                return 1;
+            }
+            break;
+        }
+        replay(&trace, ++n);
+    }
+    fclose(f);
+
+    if (n == 0)
+    {
+        fprintf(stderr, "%s: no TRACE BEGIN ... TRACE END dump\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Host tests of the view-model in src/gui/view_model.c.
+ *
+ * Observers record every call and the model they were called with. Checks
+ * that a new binding is synchronised with the model at once, that a write
+ * only calls the observers of its field, that writing the value a field
+ * already has calls none, and that unbound observers and full tables are
+ * handled:
+ *
+ *   cc -O2 -Isrc/gui tools/view_model_test.c src/gui/view_model.c -o view_model_test
+ *   ./view_model_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "view_model.h"
+
+typedef struct {
+    uint32_t calls;
+    view_model_t seen; // Model at the last call
+} observer_t;
+
+static const view_model_t initial = {
+    .mode = VIEW_MODE_CNS,
+    .weight = 15,
+    .effort = 0,
+    .reps = 0,
+    .exercise = 0,
+    .link = VIEW_LINK_UNKNOWN,
+};
+
+static int failed;
+
+static void observe(const view_model_t *vm, void *user_data)
+{
+    observer_t *o = user_data;
+    o->calls++;
+    o->seen = *vm;
+}
+
+static void expect(bool ok, const char *what)
+{
+    printf("%-4s %s\n", ok ? "ok" : "FAIL", what);
+    failed += !ok;
+}
+
+static bool same(const view_model_t *a, const view_model_t *b)
+{
+    return a->mode == b->mode && a->weight == b->weight && a->effort == b->effort && a->reps == b->reps &&
+           a->exercise == b->exercise && a->link == b->link;
+}
+
+static void expect_stats(uint32_t sets, uint32_t unchanged, uint32_t notified, const char *what)
+{
+    view_model_stats_t stats;
+    view_model_get_stats(&stats);
+    expect(stats.sets == sets && stats.unchanged == unchanged && stats.notified == notified, what);
+}
+
+static void test_bind_sync(void)
+{
+    observer_t weight = {0};
+    observer_t reps = {0};
+
+    view_model_init(&initial);
+    view_model_set(VIEW_FIELD_WEIGHT, 40);
+    view_model_set(VIEW_FIELD_LINK, VIEW_LINK_UP);
+
+    // Bound after the writes, as a screen shown later is
+    expect(view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_WEIGHT), observe, &weight), "weight observer bound");
+    expect(weight.calls == 1 && same(&weight.seen, view_model_get()) && weight.seen.weight == 40 &&
+               weight.seen.link == VIEW_LINK_UP,
+           "bound observer called at once with the current model");
+    expect(view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_REPS), observe, &reps) && reps.calls == 1,
+           "reps observer synchronised too");
+    expect_stats(2, 0, 2, "writes before any binding notify nobody, each bind notifies once");
+}
+
+static void test_notify(void)
+{
+    observer_t weight = {0};
+    observer_t both = {0};
+    observer_t mode = {0};
+
+    view_model_init(&initial);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_WEIGHT), observe, &weight);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_WEIGHT) | VIEW_FIELD_BIT(VIEW_FIELD_EFFORT), observe, &both);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_MODE), observe, &mode);
+
+    expect(view_model_set(VIEW_FIELD_WEIGHT, 20), "weight changed");
+    expect(weight.calls == 2 && both.calls == 2 && mode.calls == 1 && weight.seen.weight == 20,
+           "only the observers of the weight called, with the new value");
+    expect(view_model_set(VIEW_FIELD_EFFORT, 33) && weight.calls == 2 && both.calls == 3 && both.seen.effort == 33,
+           "effort calls the observer bound to both fields only");
+    expect(view_model_set(VIEW_FIELD_REPS, 1) && weight.calls == 2 && both.calls == 3 && mode.calls == 1,
+           "a field nobody observes calls nobody");
+    expect(view_model_get()->reps == 1, "unobserved field still written");
+    expect_stats(3, 0, 3 + 3, "three writes, three binds and three notifications counted");
+}
+
+static void test_unchanged(void)
+{
+    observer_t weight = {0};
+    observer_t reps = {0};
+
+    view_model_init(&initial);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_WEIGHT), observe, &weight);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_REPS), observe, &reps);
+
+    expect(!view_model_set(VIEW_FIELD_WEIGHT, initial.weight) && weight.calls == 1,
+           "writing the initial weight calls nobody");
+    view_model_set(VIEW_FIELD_REPS, 5);
+    for (int i = 0; i < 10; i++)
+        view_model_set(VIEW_FIELD_REPS, 5);
+    expect(reps.calls == 2 && reps.seen.reps == 5, "ten writes of the same reps notify once");
+    expect(!view_model_set(VIEW_FIELD_COUNT, 1) && weight.calls == 1 && reps.calls == 2,
+           "write to no field ignored");
+    expect_stats(13, 12, 2 + 1, "unchanged writes counted, not notified");
+}
+
+static void test_unbind(void)
+{
+    observer_t a = {0};
+    observer_t b = {0};
+
+    view_model_init(&initial);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_REPS), observe, &a);
+    view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_REPS), observe, &b);
+    view_model_unbind(observe, &a);
+    view_model_set(VIEW_FIELD_REPS, 3);
+    expect(a.calls == 1 && b.calls == 2, "unbound observer no longer called, the other one still is");
+
+    // The freed slot is reused, and a full table refuses more
+    int bound = 0;
+    observer_t extra[VIEW_MODEL_BINDINGS];
+    memset(extra, 0, sizeof(extra));
+    for (int i = 0; i < VIEW_MODEL_BINDINGS; i++)
+        bound += view_model_bind(VIEW_FIELD_BIT(VIEW_FIELD_LINK), observe, &extra[i]);
+    expect(bound == VIEW_MODEL_BINDINGS - 1 && extra[VIEW_MODEL_BINDINGS - 1].calls == 0,
+           "table full after reusing the free slot, the last bind refused and not called");
+
+    view_model_init(&initial);
+    view_model_set(VIEW_FIELD_REPS, 4);
+    expect(b.calls == 2, "init drops every binding");
+}
+
+int main(void)
+{
+    test_bind_sync();
+    test_notify();
+    test_unchanged();
+    test_unbind();
+
+    printf("%d checks failed\n", failed);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,393 @@
+/*
+ * Host tests of the virtualised list in src/gui/vlist.c.
+ *
+ * The list is compiled unchanged against the LVGL stand-in of tools/host,
+ * with a source of numbered rows that records what the list asks of it.
+ * After every step the rows shown are checked: each visible object is bound
+ * to the row its position shows, no row is shown twice, the view is covered
+ * without gaps, and every bound row was fetched first. Drags and throws are
+ * fed as the input device reports them, at the 16 ms frame period:
+ *
+ *   cc -O2 -Itools/host -Isrc/gui tools/vlist_test.c src/gui/vlist.c src/gui/refr_period.c tools/host/lvgl_host.c -o vlist_test
+ *   ./vlist_test
+ *
+ * It covers 5000 rows, jumps to any row, a drag that rebinds only the rows
+ * entering the view, throws that stop by themselves or at the end of the
+ * list, rows appended while at the end or elsewhere, and a list preloaded
+ * empty and shown once the source has rows, with no refresh in between.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vlist.h"
+
+#define LIST_W   720
+#define LIST_H   510 // History screen on the 1024x600 board
+#define ROW_H    48  // HISTORY_SCREEN_ROW_H
+#define ROWS     5000
+#define FRAME_MS VLIST_FRAME_MS
+#define THROW_MS 3000 // Longest a throw may take to stop
+
+static struct {
+    uint32_t count;
+    uint32_t fetched_first; // Last fetch
+    uint32_t fetched_end;
+    uint32_t binds;
+    uint32_t unfetched;     // Rows bound outside the last fetch
+} source;
+
+static lv_obj_t *screen;
+static lv_obj_t *rows[VLIST_MAX_ROWS];
+static uint32_t row_count;
+
+static uint32_t source_count(void *user_data)
+{
+    return source.count;
+}
+
+static void source_fetch(uint32_t first, uint32_t count, void *user_data)
+{
+    source.fetched_first = first;
+    source.fetched_end = first + count;
+}
+
+static lv_obj_t *source_create_row(lv_obj_t *parent, void *user_data)
+{
+    lv_obj_t *row = lv_obj_create(parent);
+    if (row_count < VLIST_MAX_ROWS)
+        rows[row_count] = row;
+    row_count++;
+    return row;
+}
+
+// The row object remembers its index, plus one so that NULL is unbound
+static void source_bind(lv_obj_t *row, uint32_t index, void *user_data)
+{
+    row->user_data = (void *)(uintptr_t)(index + 1);
+    source.binds++;
+    if (index < source.fetched_first || index >= source.fetched_end)
+        source.unfetched++;
+}
+
+static const vlist_source_t row_source = {
+    .count = source_count,
+    .fetch = source_fetch,
+    .create_row = source_create_row,
+    .bind = source_bind,
+};
+
+static lv_obj_t *create_list(uint32_t count)
+{
+    memset(&source, 0, sizeof(source));
+    source.count = count;
+    row_count = 0;
+    if (screen)
+        lv_obj_del(screen);
+    screen = lv_obj_create(NULL);
+    return vlist_create(screen, LIST_W, LIST_H, ROW_H, &row_source);
+}
+
+static int32_t max_scroll(void)
+{
+    int32_t content = (int32_t)source.count * ROW_H;
+    return content > LIST_H ? content - LIST_H : 0;
+}
+
+/**
+ * @brief Check the Rows Shown
+ *
+ * Returns the scroll offset the visible rows agree on, or -1 with the reason
+ * printed when they do not show a consistent, gapless view of the source.
+ */
+static int32_t check_rows(const char *step)
+{
+    int32_t scroll = -1;
+    uint32_t shown = 0;
+    uint32_t index[VLIST_MAX_ROWS];
+
+    if (row_count > VLIST_MAX_ROWS)
+    {
+        printf("  %s: %u row objects, more than VLIST_MAX_ROWS\n", step, row_count);
+        return -1;
+    }
+    for (uint32_t s = 0; s < row_count; s++)
+    {
+        if (lv_obj_has_flag(rows[s], LV_OBJ_FLAG_HIDDEN))
+            continue;
+        if (rows[s]->user_data == NULL)
+        {
+            printf("  %s: object %u shown unbound\n", step, s);
+            return -1;
+        }
+        uint32_t i = (uint32_t)(uintptr_t)rows[s]->user_data - 1;
+        int32_t at = (int32_t)i * ROW_H - lv_obj_get_y(rows[s]);
+        if (i >= source.count || (scroll >= 0 && at != scroll))
+        {
+            printf("  %s: row %u of %u shown at y %d, the others at scroll %d\n", step, i, source.count,
+                   lv_obj_get_y(rows[s]), scroll);
+            return -1;
+        }
+        for (uint32_t k = 0; k < shown; k++)
+        {
+            if (index[k] == i)
+            {
+                printf("  %s: row %u shown twice\n", step, i);
+                return -1;
+            }
+        }
+        scroll = at;
+        index[shown++] = i;
+    }
+    if (source.count == 0)
+        return shown ? -1 : 0;
+    if (scroll < 0 || scroll > max_scroll())
+    {
+        printf("  %s: scrolled to %d, out of 0..%d\n", step, scroll, max_scroll());
+        return -1;
+    }
+
+    // Every row overlapping the view is shown
+    uint32_t first = scroll / ROW_H;
+    uint32_t end = (scroll + LIST_H + ROW_H - 1) / ROW_H;
+    end = end < source.count ? end : source.count;
+    for (uint32_t i = first; i < end; i++)
+    {
+        bool found = false;
+        for (uint32_t k = 0; k < shown && !found; k++)
+            found = index[k] == i;
+        if (!found)
+        {
+            printf("  %s: row %u in view at scroll %d is not shown\n", step, i, scroll);
+            return -1;
+        }
+    }
+    if (source.unfetched)
+    {
+        printf("  %s: %u rows bound before they were fetched\n", step, source.unfetched);
+        return -1;
+    }
+    return scroll;
+}
+
+static void frames(uint32_t n)
+{
+    host_lv_tick_inc(n * FRAME_MS);
+}
+
+static void press(lv_obj_t *list, lv_coord_t y)
+{
+    host_lv_set_point(LIST_W / 2, y);
+    lv_event_send(list, LV_EVENT_PRESSED, NULL);
+}
+
+// Drag by dy px, in steps of step px a frame; negative dy moves the content up, towards the end
+static void drag(lv_obj_t *list, lv_coord_t *y, int32_t dy, int32_t step)
+{
+    for (int32_t moved = 0; moved != dy;)
+    {
+        int32_t d = LV_ABS(dy - moved) < step ? dy - moved : dy < 0 ? -step : step;
+        moved += d;
+        *y += d;
+        frames(1);
+        host_lv_set_point(LIST_W / 2, *y);
+        lv_event_send(list, LV_EVENT_PRESSING, NULL);
+    }
+}
+
+static void release(lv_obj_t *list)
+{
+    lv_event_send(list, LV_EVENT_RELEASED, NULL);
+}
+
+// Frames until the throw timer is gone, or -1 if it runs past THROW_MS
+static int32_t wait_throw(void)
+{
+    for (int32_t n = 0; n * FRAME_MS < THROW_MS; n++)
+    {
+        if (host_lv_timer_count() == 0)
+            return n;
+        frames(1);
+    }
+    return -1;
+}
+
+static bool expect(bool ok, const char *what)
+{
+    if (!ok)
+        printf("  %s\n", what);
+    return ok;
+}
+
+static bool test_create(void)
+{
+    create_list(ROWS);
+    return expect(check_rows("created") == 0, "not at the first row") &
+           expect(row_count < VLIST_MAX_ROWS, "row objects not limited to the view and margins") &
+           expect(source.binds == (LIST_H + ROW_H - 1) / ROW_H + VLIST_MARGIN_ROWS, "rows bound past the margin");
+}
+
+static bool test_jumps(void)
+{
+    const uint32_t targets[] = {2500, ROWS - 1, ROWS, UINT32_MAX, 0, 123, ROWS - 20, 1, 4096};
+    lv_obj_t *list = create_list(ROWS);
+    bool ok = true;
+
+    for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++)
+    {
+        char step[32];
+        snprintf(step, sizeof(step), "jump to %u", targets[t]);
+        vlist_scroll_to(list, targets[t]);
+        int32_t want = LV_MIN((int64_t)LV_MIN(targets[t], ROWS) * ROW_H, max_scroll());
+        int32_t got = check_rows(step);
+        if (got != want)
+        {
+            printf("  %s: at scroll %d, expected %d\n", step, got, want);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+static bool test_drag(void)
+{
+    lv_obj_t *list = create_list(ROWS);
+    vlist_stats_t stats;
+    lv_coord_t y = 400;
+    bool ok = true;
+
+    vlist_scroll_to(list, 1000);
+    int32_t start = check_rows("before the drag");
+
+    // One row up, slowly: only the row entering at the bottom margin is bound
+    press(list, y);
+    drag(list, &y, -ROW_H, 4);
+    vlist_get_stats(list, &stats);
+    ok &= expect(check_rows("one row dragged") == start + ROW_H, "not scrolled by the drag");
+    ok &= expect(stats.binds == 1, "more than the entering row bound for a one-row drag");
+    ok &= expect(lv_disp_get_default()->refr_timer->period == VLIST_FRAME_MS, "display not at the frame period");
+
+    // Back down by five rows
+    drag(list, &y, 5 * ROW_H, 8);
+    ok &= expect(check_rows("dragged back") == start - 4 * ROW_H, "not following the finger back");
+
+    // Held still before lifting: no throw
+    frames(10);
+    release(list);
+    ok &= expect(host_lv_timer_count() == 0, "held finger threw the list");
+    ok &= expect(lv_disp_get_default()->refr_timer->period == LV_DISP_DEF_REFR_PERIOD, "refresh period not restored");
+    return ok;
+}
+
+static bool test_throw(void)
+{
+    lv_obj_t *list = create_list(ROWS);
+    lv_coord_t y = 450;
+    bool ok = true;
+
+    vlist_scroll_to(list, 2000);
+    press(list, y);
+    drag(list, &y, -200, 20);
+    int32_t released = check_rows("throw released");
+    release(list);
+    ok &= expect(host_lv_timer_count() == 1, "fast release did not throw");
+
+    int32_t n = wait_throw();
+    int32_t stopped = check_rows("throw stopped");
+    ok &= expect(n > 0, "throw did not stop by itself");
+    ok &= expect(stopped > released + 10 * ROW_H / 5, "throw did not carry on past the release");
+    ok &= expect(lv_disp_get_default()->refr_timer->period == LV_DISP_DEF_REFR_PERIOD, "refresh period not restored");
+    printf("  throw carried %d px in %d frames\n", stopped - released, n);
+
+    // A throw towards the end stops there
+    vlist_scroll_to(list, ROWS - 14);
+    press(list, y = 450);
+    drag(list, &y, -300, 30);
+    release(list);
+    ok &= expect(wait_throw() >= 0, "throw at the end kept running");
+    ok &= expect(check_rows("thrown to the end") == max_scroll(), "throw did not stop at the end");
+
+    // A new press stops a running throw
+    vlist_scroll_to(list, 3000);
+    press(list, y = 450);
+    drag(list, &y, -200, 20);
+    release(list);
+    frames(3);
+    press(list, y);
+    ok &= expect(host_lv_timer_count() == 0, "press did not stop the throw");
+    int32_t caught = check_rows("throw caught");
+    frames(10);
+    ok &= expect(check_rows("after the catch") == caught, "list moved after the throw was caught");
+    release(list);
+    return ok;
+}
+
+static bool test_append(void)
+{
+    lv_obj_t *list = create_list(ROWS);
+    bool ok = true;
+
+    // At the end, the list follows the rows appended
+    vlist_scroll_to(list, ROWS);
+    for (int i = 0; i < 3; i++)
+    {
+        source.count++;
+        vlist_refresh(list);
+        ok &= expect(check_rows("appended at the end") == max_scroll(), "list at its end did not follow");
+    }
+
+    // Elsewhere it stays put
+    vlist_scroll_to(list, 100);
+    int32_t at = check_rows("scrolled up");
+    source.count += 10;
+    vlist_refresh(list);
+    ok &= expect(check_rows("appended while scrolled up") == at, "list scrolled up moved on append");
+
+    // Growing from a list shorter than the view
+    list = create_list(3);
+    ok &= expect(check_rows("three rows") == 0, "short list not at its top");
+    source.count = 30;
+    vlist_refresh(list);
+    ok &= expect(check_rows("grown past the view") == max_scroll(), "short list did not follow its rows");
+    return ok;
+}
+
+// The history screen is preloaded before any rep, then shown with rows and no refresh in between
+static bool test_preload_empty(void)
+{
+    lv_obj_t *list = create_list(0);
+    bool ok = true;
+
+    ok &= expect(check_rows("preloaded empty") == 0, "empty list shows rows");
+    source.count = 300;
+    vlist_scroll_to(list, source.count);
+    ok &= expect(check_rows("shown with 300 rows") == max_scroll(), "not on the latest rows when shown");
+    return ok;
+}
+
+static const struct {
+    const char *name;
+    bool (*run)(void);
+} cases[] = {
+    {"5000 rows, created at the top", test_create},
+    {"jumps to any row", test_jumps},
+    {"drag rebinds the entering rows", test_drag},
+    {"throws stop", test_throw},
+    {"appended rows", test_append},
+    {"preloaded empty, shown with rows", test_preload_empty},
+};
+
+int main(void)
+{
+    int failed = 0;
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++)
+    {
+        bool ok = cases[c].run();
+        printf("%-4s %s\n", ok ? "ok" : "FAIL", cases[c].name);
+        failed += !ok;
+    }
+    printf("%d of %zu cases failed\n", failed, sizeof(cases) / sizeof(cases[0]));
+    return failed ? 1 : 0;
+}